@@ -230,6 +230,41 @@ set(MPIX_IALLGATHER_CODE
      }")
 El_check_c_source_compiles("${MPIX_IALLGATHER_CODE}" 
   EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
+set(MPI_SHARED_MEMORY_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       MPI_Comm nodeComm;
+       MPI_Comm_split_type
+       ( MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodeComm );
+       char* buffer;
+       MPI_Win window;
+       MPI_Win_allocate_shared
+       ( 8, 1, MPI_INFO_NULL, nodeComm, &buffer, &window );
+       MPI_Win_lock_all( MPI_MODE_NOCHECK, window );
+       MPI_Win_sync( window );
+       MPI_Win_unlock_all( window );
+       MPI_Win_free( &window );
+       MPI_Finalize();
+       return 0;
+     }")
+El_check_c_source_compiles("${MPI_SHARED_MEMORY_CODE}"
+  EL_HAVE_MPI3_SHARED_MEMORY)
+set(OMPI_COMM_TYPE_SOCKET_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       MPI_Comm socketComm;
+       MPI_Comm_split_type
+       ( MPI_COMM_WORLD, OMPI_COMM_TYPE_SOCKET, 0, MPI_INFO_NULL,
+         &socketComm );
+       MPI_Finalize();
+       return 0;
+     }")
+El_check_c_source_compiles("${OMPI_COMM_TYPE_SOCKET_CODE}"
+  EL_HAVE_OMPI_COMM_TYPE_SOCKET)
 set(MPI_INIT_THREAD_CODE
     "#include \"mpi.h\"
      int main( int argc, char* argv[] )
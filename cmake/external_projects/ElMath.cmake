@@ -555,5 +555,5 @@ else()
   include(external_projects/ElMath/ParMETIS)
 endif()
 if(NOT EL_HAVE_METIS)
-  message(FATAL_ERROR "METIS support is required for Elemental but existing support was not detected and downloading was prevented")
+  message(STATUS "METIS support was not detected and downloading was prevented, so the built-in multilevel nested dissection will be used")
 endif()
@@ -26,6 +26,8 @@ main( int argc, char* argv[] )
           (El::Input("--scaling","scaling strategy",0));
         const El::Int maxIts = El::Input("--maxIts","max number of iter's",100);
         const double tol = El::Input("--tol","convergence tolerance",1e-6);
+        const bool newtonSchulz =
+          El::Input("--newtonSchulz","switch to Newton-Schulz?",true);
         const bool progress =
           El::Input("--progress","print sign progress?",true);
         const bool print = El::Input("--print","print matrix?",false);
@@ -46,6 +48,7 @@ main( int argc, char* argv[] )
         signCtrl.tol = tol;
         signCtrl.progress = progress;
         signCtrl.scaling = scaling;
+        signCtrl.newtonSchulz = newtonSchulz;
 
         El::Timer timer;
         // Compute sgn(A)
@@ -49,6 +49,9 @@ int main( int argc, char* argv[] )
           El::Input("--variableEnumType","variable enum type?",false);
         const El::Int multiEnumWindow =
           El::Input("--multiEnumWindow","window for y-sparse enumeration",15);
+        const El::Int numConcurrentWindows =
+          El::Input
+          ("--numConcurrentWindows","concurrent enumerations per BKZ stage",1);
         const El::Int phaseLength =
           El::Input("--phaseLength","YSPARSE_ENUM phase length",10);
         const double enqueueProb =
@@ -178,6 +181,7 @@ int main( int argc, char* argv[] )
         ctrl.variableEnumType = variableEnumType;
         ctrl.enumTypeFunc = El::MakeFunction(enumTypeLambda);
         ctrl.multiEnumWindow = multiEnumWindow;
+        ctrl.numConcurrentWindows = numConcurrentWindows;
         ctrl.time = timeBKZ;
         ctrl.progress = progressBKZ;
         ctrl.recursive = recursiveBKZ;
@@ -649,6 +649,30 @@ void NormalFromEVD
   const AbstractDistMatrix<Complex<Real>>& w,
   const AbstractDistMatrix<Complex<Real>>& Z );
 
+// Batched Gemm and Trsm
+// =====================
+// Apply the same operation to every member of a batch of small, independent
+// matrices (see BatchMatrix). The loops over the batch are the innermost
+// (and are vectorized for the interleaved layout) while chunks of the batch
+// are distributed over the OpenMP threads.
+namespace batched {
+
+// C[k] := alpha op(A[k]) op(B[k]) + beta C[k]
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const BatchMatrix<T>& A, const BatchMatrix<T>& B,
+  T beta,        BatchMatrix<T>& C );
+
+// B[k] := alpha op(A[k])^{-1} B[k] or alpha B[k] op(A[k])^{-1}
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const BatchMatrix<F>& A, BatchMatrix<F>& B );
+
+} // namespace batched
+
 } // namespace El
 
 #endif // ifndef EL_BLAS3_HPP
@@ -16,18 +16,57 @@ namespace El {
 // Lyapunov
 // ========
 template<typename F>
-void Lyapunov
+SignInfo Lyapunov
 ( const Matrix<F>& A,
   const Matrix<F>& C,
         Matrix<F>& X,
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 template<typename F>
-void Lyapunov
+SignInfo Lyapunov
 ( const ElementalMatrix<F>& A,
   const ElementalMatrix<F>& C, 
         ElementalMatrix<F>& X,
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+// Low-rank Lyapunov
+// =================
+// A is assumed to be a sparse Hermitian positive-definite matrix and B a
+// tall-skinny matrix. Z is then returned such that X ~= Z Z^H approximately
+// solves
+//    A X + X A^H = B B^H
+// via the low-rank Alternating Direction Implicit (ADI) iteration.
+
+template<typename Real>
+struct LowRankLyapunovCtrl
+{
+    Int maxIts=100;
+
+    // Stop once || W^H W ||_2 <= relTol || B^H B ||_2, where W W^H is the
+    // residual of the current low-rank approximation
+    Real relTol=Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    // The (positive) shifts are applied cyclically. If none are specified,
+    // numShifts of them are logarithmically spaced over estimates of the
+    // extremal eigenvalues of A, formed from a Lanczos decomposition of size
+    // basisSize and numInverseIts steps of inverse iteration.
+    Matrix<Real> shifts;
+    Int numShifts=8;
+    Int basisSize=20;
+    Int numInverseIts=5;
+
+    // Controls the nested-dissection reordering shared by the shifted matrices
+    BisectCtrl bisectCtrl;
+
+    bool progress=false;
+};
+
+template<typename F>
+void LowRankLyapunov
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<F>& B,
+        DistMultiVec<F>& Z,
+  const LowRankLyapunovCtrl<Base<F>>& ctrl=LowRankLyapunovCtrl<Base<F>>() );
+
 // Riccati
 // =======
 template<typename F>
@@ -59,23 +98,23 @@ void Riccati
 // Sylvester
 // =========
 template<typename F>
-void Sylvester
+SignInfo Sylvester
 ( Int m, Matrix<F>& W, Matrix<F>& X,
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 template<typename F>
-void Sylvester
+SignInfo Sylvester
 ( Int m, ElementalMatrix<F>& W, ElementalMatrix<F>& X,
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
 template<typename F>
-void Sylvester
+SignInfo Sylvester
 ( const Matrix<F>& A,
   const Matrix<F>& B,
   const Matrix<F>& C,
         Matrix<F>& X,
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 template<typename F>
-void Sylvester
+SignInfo Sylvester
 ( const ElementalMatrix<F>& A,
   const ElementalMatrix<F>& B, 
   const ElementalMatrix<F>& C,
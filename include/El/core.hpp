@@ -243,6 +243,7 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/environment/decl.hpp>
 
 #include <El/core/Timer.hpp>
+#include <El/core/Hasher.hpp>
 #include <El/core/indexing/decl.hpp>
 #include <El/core/imports/blas.hpp>
 #include <El/core/imports/lapack.hpp>
@@ -308,4 +309,6 @@ class DistMatrix;
 #include <El/core/Permutation.hpp>
 #include <El/core/DistPermutation.hpp>
 
+#include <El/core/BatchMatrix.hpp>
+
 #endif // ifndef EL_CORE_HPP
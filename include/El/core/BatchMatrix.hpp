@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHMATRIX_HPP
+#define EL_BATCHMATRIX_HPP
+
+namespace El {
+
+namespace BatchLayoutNS {
+enum BatchLayout
+{
+    // Entry (i,j) of every member of the batch is stored contiguously, so that
+    // the innermost loops of the batched kernels vectorize across the batch
+    BATCH_INTERLEAVED,
+    // Each member of the batch is stored contiguously in column-major order
+    BATCH_STRIDED
+};
+}
+using namespace BatchLayoutNS;
+
+// A container for a batch of many independent (small) matrices of the same
+// dimensions, for use with the batched:: kernels. Entry (i,j) of member k
+// lives at Buffer()[i*InnerStride()+j*LDim()+k*BatchStride()].
+template<typename T>
+class BatchMatrix
+{
+public:
+    BatchMatrix();
+    BatchMatrix
+    ( Int height, Int width, Int batchSize,
+      BatchLayout layout=BATCH_INTERLEAVED );
+
+    void Empty();
+    void Resize( Int height, Int width, Int batchSize );
+    // Reorder the entries (if necessary) into the specified layout
+    void SetLayout( BatchLayout layout );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int BatchSize() const EL_NO_EXCEPT;
+    BatchLayout Layout() const EL_NO_EXCEPT;
+
+    Int InnerStride() const EL_NO_EXCEPT;
+    Int LDim() const EL_NO_EXCEPT;
+    Int BatchStride() const EL_NO_EXCEPT;
+    Int Offset( Int i, Int j, Int k ) const EL_NO_EXCEPT;
+
+          T* Buffer() EL_NO_EXCEPT;
+    const T* LockedBuffer() const EL_NO_EXCEPT;
+
+    T Get( Int i, Int j, Int k ) const;
+    void Set( Int i, Int j, Int k, T alpha );
+
+    // Extract or overwrite a single member of the batch
+    void GetMatrix( Int k, Matrix<T>& A ) const;
+    void SetMatrix( Int k, const Matrix<T>& A );
+
+private:
+    Int height_=0, width_=0, batchSize_=0;
+    BatchLayout layout_=BATCH_INTERLEAVED;
+    vector<T> buffer_;
+};
+
+namespace batched {
+
+// The batched kernels process the batch in chunks of this many members,
+// with the chunks distributed over the OpenMP threads
+const Int CHUNK_SIZE = 64;
+
+} // namespace batched
+
+// Call KERNEL<N>(ARGS) with a compile-time matrix size N when the runtime
+// size n is small enough to be worth specializing, and KERNEL<0>(ARGS)
+// otherwise. Kernels should use ( N > 0 ? N : n ) as their loop bound.
+#define EL_BATCH_DISPATCH(n,KERNEL,...) \
+  switch( n ) \
+  { \
+  case 1:  KERNEL<1>(__VA_ARGS__);  break; \
+  case 2:  KERNEL<2>(__VA_ARGS__);  break; \
+  case 3:  KERNEL<3>(__VA_ARGS__);  break; \
+  case 4:  KERNEL<4>(__VA_ARGS__);  break; \
+  case 5:  KERNEL<5>(__VA_ARGS__);  break; \
+  case 6:  KERNEL<6>(__VA_ARGS__);  break; \
+  case 7:  KERNEL<7>(__VA_ARGS__);  break; \
+  case 8:  KERNEL<8>(__VA_ARGS__);  break; \
+  case 16: KERNEL<16>(__VA_ARGS__); break; \
+  default: KERNEL<0>(__VA_ARGS__);  break; \
+  }
+
+} // namespace El
+
+#endif // ifndef EL_BATCHMATRIX_HPP
@@ -15,9 +15,18 @@ namespace El {
 class Grid
 {
 public:
+    // With NODE_MAPPING, the processes are ordered by node (and then by
+    // socket) before being assigned to the grid, and the default height is
+    // chosen so that each process column (row) lies within a single node
+    // for COLUMN_MAJOR (ROW_MAJOR) orderings whenever the nodes hold equal
+    // numbers of processes. Note that the ranks of the grid then generally
+    // differ from those of 'comm'.
     explicit Grid
-    ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR );
-    explicit Grid( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR );
+    ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR,
+      GridMapping mapping=RANK_MAPPING );
+    explicit Grid
+    ( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR,
+      GridMapping mapping=RANK_MAPPING );
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -28,6 +37,7 @@ public:
     int Size() const EL_NO_EXCEPT;         // VCSize() and VRSize()
     int Rank() const EL_NO_RELEASE_EXCEPT; // same as OwningRank()
     GridOrder Order() const EL_NO_EXCEPT;  // either COLUMN_MAJOR or ROW_MAJOR
+    GridMapping Mapping() const EL_NO_EXCEPT; // RANK_MAPPING or NODE_MAPPING
     mpi::Comm ColComm() const EL_NO_EXCEPT; // MCComm()
     mpi::Comm RowComm() const EL_NO_EXCEPT; // MRComm()
     // VCComm (VRComm) if COLUMN_MAJOR (ROW_MAJOR)
@@ -92,6 +102,11 @@ public:
 #endif
 
     static int DefaultHeight( int gridSize ) EL_NO_EXCEPT;
+    // The grid height closest to DefaultHeight(gridSize) such that each
+    // process column (row) of a COLUMN_MAJOR (ROW_MAJOR) grid fits within
+    // nodes of 'nodeSize' processes
+    static int NodeHeight
+    ( int gridSize, int nodeSize, GridOrder order=COLUMN_MAJOR ) EL_NO_EXCEPT;
 
     // To be used internally by Elemental
     static void InitializeDefault();
@@ -106,6 +121,7 @@ private:
     int height_, size_, gcd_;
     bool inGrid_;
     GridOrder order_;
+    GridMapping mapping_;
 
     static Grid* defaultGrid;
     static Grid* trivialGrid;
@@ -134,6 +150,7 @@ private:
     int blacsMCMRContext_;
 #endif
 
+    void SetUpViewingComm( mpi::Comm comm, int& nodeSize );
     void SetUpGrid();
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
@@ -143,6 +160,11 @@ private:
     Grid( const Grid& );
 };
 
+// Print, from the root of the grid, the number of nodes spanned by each of
+// the grid's communicators (the maximum over the copies of a communicator)
+// along with the largest number of its processes sharing a node
+void PrintNodeComposition( const Grid& grid, ostream& os=cout );
+
 bool operator==( const Grid& A, const Grid& B ) EL_NO_EXCEPT;
 bool operator!=( const Grid& A, const Grid& B ) EL_NO_EXCEPT;
 
@@ -0,0 +1,41 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HASHER_HPP
+#define EL_HASHER_HPP
+
+namespace El {
+
+// A 64-bit FNV-1a hash of a sequence of bytes, used to cheaply check whether
+// cached (e.g., sparsity pattern dependent) data is still valid. It is *not*
+// portable across architectures with differing type sizes or endianness.
+class Hasher
+{
+public:
+    void Add( const void* data, size_t numBytes )
+    {
+        auto bytes = static_cast<const unsigned char*>(data);
+        for( size_t i=0; i<numBytes; ++i )
+        {
+            hash_ ^= bytes[i];
+            hash_ *= 1099511628211ULL;
+        }
+    }
+
+    template<typename T>
+    void Add( const T& value ) { Add( &value, sizeof(T) ); }
+
+    unsigned long long Hash() const { return hash_; }
+
+private:
+    unsigned long long hash_=14695981039346656037ULL;
+};
+
+} // namespace El
+
+#endif // ifndef EL_HASHER_HPP
@@ -51,6 +51,40 @@ void Initialize( int& argc, char**& argv );
 void Finalize();
 bool Initialized();
 
+// A threading policy which splits the available cores between the local BLAS
+// library (e.g., the local updates within SUMMA or within the frontal
+// factorizations of ldl::Process) and Elemental's own OpenMP loops (e.g., the
+// redistribution packing and unpacking routines). A nonpositive value for
+// either count means that the current setting should be left untouched.
+struct ThreadingCtrl
+{
+    Int numBlasThreads=0;
+    Int numLoopThreads=0;
+};
+
+// Initialize Elemental with an explicit threading policy
+void Initialize( int& argc, char**& argv, const ThreadingCtrl& threadingCtrl );
+
+// The number of threads available to OpenMP (one if not in hybrid mode)
+Int MaxThreads();
+
+// Query/modify the number of threads used by the local BLAS library
+// (OpenBLAS, MKL, and BLIS are currently supported)
+Int NumBlasThreads();
+void SetNumBlasThreads( Int numThreads );
+
+// Query/modify the number of threads used within Elemental's own loops
+Int NumLoopThreads();
+void SetNumLoopThreads( Int numThreads );
+
+// For manipulating the threading policy as a stack so that it may be
+// temporarily overridden for a particular call. The current policy reports a
+// nonpositive number of loop threads if all OpenMP threads are in use.
+ThreadingCtrl CurrentThreadingCtrl();
+void PushThreadingCtrl( const ThreadingCtrl& ctrl );
+void PopThreadingCtrl();
+void EmptyThreadingCtrlStack();
+
 // For initializing/finalizing Elemental using RAII
 class Environment
 {
@@ -13,6 +13,10 @@
 namespace El {
 namespace mkl {
 
+// Thread control
+void SetNumThreads( int numThreads );
+int NumThreads();
+
 void csrmv
 ( Orientation orientation, BlasInt m, BlasInt k,
   float alpha, const char* matDescrA,
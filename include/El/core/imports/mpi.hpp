@@ -327,6 +327,32 @@ void SetUserReduceFunc
         Types<T>::userFunc = func;
 }
 
+// Node-aware collectives
+// ----------------------
+// When enabled (they are disabled by default), the fixed-size AllGather,
+// AllToAll, and (built-in) AllReduce operations over packed datatypes --
+// and therefore the redistributions within the copy namespace -- are split
+// into an intra-node stage through an MPI-3 shared-memory window and an
+// inter-node stage between one leader process per node. The node layout of
+// each communicator is formed upon first use and cached as an attribute.
+// The setting must agree across all of the processes of each communicator.
+void SetNodeAwareCollectives( bool nodeAware ) EL_NO_EXCEPT;
+bool NodeAwareCollectives() EL_NO_EXCEPT;
+
+// The number of (shared-memory) nodes spanned by a communicator and the
+// maximum number of its processes on any one node
+void NodeComposition( Comm comm, int& numNodes, int& maxNodeSize )
+EL_NO_RELEASE_EXCEPT;
+
+// The index of this process's node, where the nodes of comm are numbered
+// in the order of their lowest ranks
+int NodeIndex( Comm comm ) EL_NO_RELEASE_EXCEPT;
+
+// A label for the socket of this process which is shared by precisely the
+// processes of comm on the same node and socket (or zero if the socket
+// layout is not available from the MPI implementation)
+int SocketIndex( Comm comm ) EL_NO_RELEASE_EXCEPT;
+
 // Point-to-point communication
 // ============================
 
@@ -1022,6 +1048,33 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking single-buffer AllReduce
+// ------------------------------------
+// NOTE: Without MPI-3 non-blocking collectives (or for datatypes which must be
+//       serialized), the reduction is completed before returning and the
+//       subsequent Wait is trivial
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request )
+EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT;
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce( T* buf, int count, Op op, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT;
+
+// Default to SUM
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT;
+
 // ReduceScatter
 // -------------
 template<typename Real,
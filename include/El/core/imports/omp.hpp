@@ -11,9 +11,12 @@
 
 #ifdef EL_HYBRID
 # include <omp.h>
-# define EL_PARALLEL_FOR _Pragma("omp parallel for")
+// The thread counts are controlled by El::PushThreadingCtrl/SetNumLoopThreads
+# define EL_PARALLEL_FOR \
+  _Pragma("omp parallel for num_threads(El::NumLoopThreads())")
 # ifdef EL_HAVE_OMP_COLLAPSE
-#  define EL_PARALLEL_FOR_COLLAPSE2 _Pragma("omp parallel for collapse(2)")
+#  define EL_PARALLEL_FOR_COLLAPSE2 \
+  _Pragma("omp parallel for collapse(2) num_threads(El::NumLoopThreads())")
 # else
 #  define EL_PARALLEL_FOR_COLLAPSE2 EL_PARALLEL_FOR
 # endif
@@ -13,6 +13,10 @@
 namespace El {
 namespace openblas {
 
+// Thread control
+void SetNumThreads( int numThreads );
+int NumThreads();
+
 void omatcopy
 ( Orientation orientation, BlasInt m, BlasInt n,
   float alpha, const float* A, BlasInt lda, float* B, BlasInt ldb );  
@@ -411,6 +411,16 @@ enum GridOrder
 }
 using namespace GridOrderNS;
 
+// How the processes of a communicator are assigned positions within a Grid
+namespace GridMappingNS {
+enum GridMapping
+{
+    RANK_MAPPING, // positions follow the ranks within the communicator
+    NODE_MAPPING  // processes are grouped by node (and then by socket)
+};
+}
+using namespace GridMappingNS;
+
 namespace LeftOrRightNS {
 enum LeftOrRight
 {
@@ -244,6 +244,20 @@ enum RegSolveAlg
   REG_SOLVE_LGMRES
 };
 
+// The orthogonalization used within the Arnoldi process of FGMRES and LGMRES
+enum GMRESOrthAlg
+{
+  // Modified Gram-Schmidt (one reduction per basis vector)
+  GMRES_MGS,
+  // Classical Gram-Schmidt with a reorthogonalization pass, where each pass
+  // requires a single reduction (which also yields the norm)
+  GMRES_CGS2,
+  // Classical Gram-Schmidt whose reduction is overlapped with the
+  // application of the preconditioner and operator for the next basis vector,
+  // with a reorthogonalization pass only upon significant cancellation
+  GMRES_PIPELINED
+};
+
 template<typename Real>
 struct RegSolveCtrl
 {
@@ -253,6 +267,7 @@ struct RegSolveCtrl
     Int maxIts=4;
     Int maxRefineIts=2;
     Int restart=4;
+    GMRESOrthAlg orthAlg=GMRES_MGS;
     bool progress=false;
     bool time=false;
 
@@ -947,6 +962,23 @@ void Skeleton
         AbstractDistMatrix<Field>& Z,
   const QRCtrl<Base<Field>>& ctrl=QRCtrl<Base<Field>>() );
 
+// Batched Cholesky and LU
+// =======================
+// Factor every member of a batch of small, independent matrices (see
+// BatchMatrix and the batched Gemm/Trsm)
+namespace batched {
+
+// A NonHPDMatrixException is thrown if any member of the batch was not HPD
+template<typename Field>
+void Cholesky( UpperOrLower uplo, BatchMatrix<Field>& A );
+
+// LU with partial pivoting, where pivots(i,k) is the row which was swapped
+// with row i of member k (as in LAPACK's getrf)
+template<typename Field>
+void LU( BatchMatrix<Field>& A, Matrix<Int>& pivots );
+
+} // namespace batched
+
 } // namespace El
 
 #include <El/lapack_like/factor/qr/ProxyHouseholder.hpp>
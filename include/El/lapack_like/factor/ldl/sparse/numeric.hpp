@@ -22,6 +22,9 @@
 #define EL_SUITESPARSE_NO_SCALAR_FUNCS
 #include <ElSuiteSparse/ldl.hpp>
 
+#include <deque>
+#include <map>
+
 #include <El/lapack_like/factor/ldl/sparse/symbolic.hpp>
 
 namespace El {
@@ -34,7 +37,9 @@ enum LDLFrontType
   LDL_INTRAPIV_1D,        LDL_INTRAPIV_2D,
   LDL_INTRAPIV_SELINV_1D, LDL_INTRAPIV_SELINV_2D,
   BLOCK_LDL_1D,           BLOCK_LDL_2D,
-  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D
+  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D,
+  LDL_BLR_1D,             LDL_BLR_2D,
+  CHOLESKY_1D,            CHOLESKY_2D
 };
 
 bool Unfactored( LDLFrontType type );
@@ -42,6 +47,8 @@ bool FrontIs1D( LDLFrontType type );
 bool BlockFactorization( LDLFrontType type );
 bool SelInvFactorization( LDLFrontType type );
 bool PivotedFactorization( LDLFrontType type );
+bool BLRFactorization( LDLFrontType type );
+bool CholeskyFactorization( LDLFrontType type );
 LDLFrontType ConvertTo2D( LDLFrontType type );
 LDLFrontType ConvertTo1D( LDLFrontType type );
 LDLFrontType AppendSelInv( LDLFrontType type );
@@ -117,6 +124,7 @@ struct MultiVecCommMeta
 
 struct DistMultiVecNodeMeta
 {
+    bool initialized=false;
     vector<Int> sendInds;
     vector<Int> recvInds;
     vector<int> mappedOwners;
@@ -243,6 +251,56 @@ struct DistMatrixNode
     void ComputeCommMeta( const DistNodeInfo& info ) const;
 };
 
+template<typename Real>
+struct BLRCtrl
+{
+    // Only the sequential fronts with at least this many rows are compressed
+    Int minSize=512;
+
+    // The (maximum) height and width of the tiles
+    Int tileSize=128;
+
+    // Each tile is compressed with an interpolative decomposition whose
+    // pivoted QR stops once the remaining column norms are below
+    // tol times the largest column norm of the tile
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.5));
+};
+
+// A block low-rank (BLR) representation of a dense matrix, which is split into
+// tiles of (at most) tileSize x tileSize which are each stored either densely
+// (in U) or in the interpolative form U V, where U is a subset of the columns
+// of the tile. The tiles are stored in column-major order.
+template<typename Field>
+struct BLRMatrix
+{
+    Int height=0;
+    Int width=0;
+    Int tileSize=0;
+
+    vector<bool> lowRank;
+    vector<Matrix<Field>> U;
+    vector<Matrix<Field>> V;
+
+    void Compress
+    ( const Matrix<Field>& A, Int tileSize, const Base<Field>& tol );
+    void Decompress( Matrix<Field>& A ) const;
+    void Empty();
+
+    Int Height() const;
+    Int Width() const;
+    Int NumRowTiles() const;
+    Int NumColTiles() const;
+    Int NumLowRankTiles() const;
+    Int NumEntries() const;
+
+    // Y := Y + alpha op(L) X, where L is the represented matrix
+    void Multiply
+    ( Orientation orientation,
+      Field alpha,
+      const Matrix<Field>& X,
+            Matrix<Field>& Y ) const;
+};
+
 // Only keep track of the left and bottom-right piece of the fronts
 // (with the bottom-right piece stored in workspace) since only the left side
 // needs to be kept after the factorization is complete.
@@ -267,6 +325,17 @@ struct Front
     Matrix<Field> workDense;
     SparseMatrix<Field> workSparse;
 
+    // For block low-rank fronts, LDense only holds the diagonal block and the
+    // (compressed) connectivity is stored here instead
+    BLRMatrix<Field> LBLR;
+
+    // Whether a copy of LDense has been spilled to a FrontStore, in which case
+    // LDense is only resident while the front is in use and its dimensions are
+    // kept in spillHeight and spillWidth.
+    bool spilled=false;
+    Int spillHeight=0;
+    Int spillWidth=0;
+
     // An observing pointer for the parent front (should it exist).
     Front<Field>* parent=nullptr;
 
@@ -308,6 +377,10 @@ struct Front
 
     const Front<Field>& operator=( const Front<Field>& front );
 
+    // The dimensions of LDense (whether or not it is resident)
+    Int DenseHeight() const;
+    Int DenseWidth() const;
+
     Int Height() const;
     Int NumEntries() const;
     Int NumTopLeftEntries() const;
@@ -334,6 +407,53 @@ struct FactorCommMeta
 };
 void ComputeFactRecvInds( const DistNodeInfo& info );
 
+// The redistribution pattern of DistFront<Field>::Pull, which allows the
+// nonzeros of a matrix with an unchanged sparsity pattern to be scattered into
+// the existing fronts using a single AllToAll of the values
+struct DistFrontPullMeta
+{
+    bool ready=false;
+    bool conjugate=false;
+    Int numLocalEntries=0;
+    // A hash of the local sparsity pattern, since matching entry counts alone
+    // do not guarantee that the recorded pattern still applies
+    unsigned long long patternHash=0;
+
+    // The indices into the local value buffer of A of the packed entries
+    vector<Int> sendInds;
+    vector<int> sendSizes;
+    vector<int> sendOffs;
+    vector<int> recvSizes;
+    vector<int> recvOffs;
+
+    // The destination of each received entry: the index of the front buffer
+    // (or -1 if the entry is not stored locally) and the local row and column.
+    // For sparse leaves, the row and column are instead the offsets of the
+    // entry and its (conjugate-)transpose (-1 for diagonal entries) within the
+    // value buffer of the sparse work matrix.
+    Int numBuffers=0;
+    vector<Int> recvBuffers;
+    vector<Int> recvRows;
+    vector<Int> recvCols;
+
+    void Empty()
+    {
+        ready = false;
+        numLocalEntries = 0;
+        patternHash = 0;
+        numBuffers = 0;
+        SwapClear( sendInds );
+        SwapClear( sendSizes );
+        SwapClear( sendOffs );
+        SwapClear( recvSizes );
+        SwapClear( recvOffs );
+        SwapClear( recvBuffers );
+        SwapClear( recvRows );
+        SwapClear( recvCols );
+    }
+};
+unsigned long long PullPatternHash( const DistGraph& graph );
+
 template<typename Field>
 struct DistFront
 {
@@ -393,6 +513,22 @@ struct DistFront
             vector<Int>& mappedTargets,
             vector<Int>& colOffs,
       bool hermitian=false );
+    // Additionally record the redistribution pattern for use in PullValues
+    void Pull
+    ( const DistSparseMatrix<Field>& A,
+      const DistMap& reordering,
+      const DistSeparator& rootSep,
+      const DistNodeInfo& info,
+            vector<Int>& mappedSources,
+            vector<Int>& mappedTargets,
+            vector<Int>& colOffs,
+            DistFrontPullMeta& meta,
+      bool hermitian=false );
+
+    // Overwrite the existing (2D) fronts with the nonzeros of a matrix with
+    // the same sparsity pattern as that used to form 'meta'
+    void PullValues
+    ( const DistSparseMatrix<Field>& A, const DistFrontPullMeta& meta );
 
     void PullUpdate
     ( const DistSparseMatrix<Field>& A,
@@ -431,6 +567,128 @@ struct DistFront
     ( const DistNodeInfo& info, bool computeRecvInds ) const;
 };
 
+struct OutOfCoreCtrl
+{
+    // Whether the dense factors of the sequential fronts may be spilled to disk
+    bool enabled=false;
+
+    // The directory of the (node-local) scratch files
+    string scratchDir="/tmp";
+
+    // The number of bytes of dense sequential factors which may be kept in
+    // memory after each front is factored. Fronts are spilled in the order in
+    // which they were completed, so that the top of the tree stays resident.
+    size_t memoryBudget=size_t(1) << 30;
+
+    // The number of spilled fronts which are asynchronously read ahead of
+    // the current one (in elimination-tree order) during the solves
+    Int readAhead=2;
+};
+
+struct OutOfCoreStats
+{
+    Int numFrontsSpilled=0;
+    Int numFrontsRead=0;
+    size_t bytesSpilled=0;
+    size_t bytesRead=0;
+};
+
+// Predictions of the cost of a numeric factorization which are computed from
+// the symbolic analysis alone (i.e., before any fronts are formed). Entries
+// include the sparse leaf factors and the dense fronts, and the peak memory
+// adds the largest set of simultaneously live update matrices (and
+// communication buffers) to the factors, which are allocated up front. The
+// 'local' members are for the calling process, the others are over the
+// processes sharing the root of the tree, and the imbalances are the ratios
+// of the maximum over the processes to the average. The solve flops are per
+// right-hand side, and BLR fronts are estimated as dense (an upper bound).
+struct FactorEstimate
+{
+    double localFactorEntries=0;
+    double factorEntries=0;
+
+    double localPeakBytes=0;
+    double maxPeakBytes=0;
+    double peakImbalance=1;
+
+    double localFactorGFlops=0;
+    double factorGFlops=0;
+    double factorImbalance=1;
+
+    double localSolveGFlops=0;
+    double solveGFlops=0;
+};
+
+template<typename Field>
+FactorEstimate EstimateFactorization
+( const NodeInfo& rootInfo, LDLFrontType frontType=LDL_2D );
+template<typename Field>
+FactorEstimate EstimateFactorization
+( const DistNodeInfo& rootInfo, LDLFrontType frontType=LDL_2D );
+
+// Whether a Cholesky factorization should expand a leaf into a dense front
+// (as opposed to factoring it with sparse kernels)
+bool DenseCholeskyLeaf( const NodeInfo& info );
+
+struct FrontStoreState;
+
+// Holds the dense factors of sequential fronts which have been spilled to a
+// scratch file. Each spilled factor is packed into a buffer which is written
+// asynchronously (with at most one write in flight).
+template<typename Field>
+class FrontStore
+{
+public:
+    FrontStore( const OutOfCoreCtrl& ctrl );
+    ~FrontStore();
+
+    // Account for a completed front and, while the memory budget is exceeded,
+    // spill the resident fronts (oldest first)
+    void Add( Front<Field>& front );
+
+    // Wait for any pending write
+    void Flush();
+
+    // Visit the given fronts in order, with each spilled front read back into
+    // memory before its visit (and the following ctrl.readAhead fronts read
+    // asynchronously) and released afterwards
+    void Traverse
+    ( const vector<const Front<Field>*>& fronts,
+      function<void(Int)> visit );
+
+    // Make the spilled fronts resident again for the duration of an operation
+    // which does not support out-of-core fronts
+    void LoadAll();
+    void ReleaseAll();
+
+    // Drop the spilled factors and restore zero-initialized dense fronts of
+    // the original sizes (e.g., before a new set of values is pulled in)
+    void Discard();
+
+    Int NumSpilled() const;
+    const OutOfCoreStats& Stats() const;
+
+private:
+    OutOfCoreCtrl ctrl_;
+    OutOfCoreStats stats_;
+    unique_ptr<FrontStoreState> state_;
+
+    // The spilled fronts, their offsets (in bytes) within the scratch file,
+    // and the position of each front in the spill order
+    vector<Front<Field>*> spilled_;
+    vector<size_t> offsets_;
+    std::map<const Front<Field>*,Int> spillIndex_;
+
+    // The fronts which have been added but not spilled
+    std::deque<Front<Field>*> resident_;
+    size_t residentBytes_=0;
+    size_t fileSize_=0;
+
+    void Spill( Front<Field>& front );
+    void Load( Int index );
+    void Release( Int index );
+};
+
 } // namespace ldl
 
 template<typename Field>
@@ -469,13 +727,23 @@ public:
     // with a different matrix (e.g., within an Interior Point Method).
     void ChangeNonzeroValues( const SparseMatrix<Field>& ANew );
 
-    // Factor the initialized multifrontal tree.
+    // Factor the initialized multifrontal tree. The CHOLESKY_1D and
+    // CHOLESKY_2D types apply dense Cholesky factorizations to every front
+    // (including the leaves) and require a Hermitian positive-definite matrix.
     void Factor( LDLFrontType frontType=LDL_2D );
 
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
     void ChangeFrontType( LDLFrontType frontType );
 
+    // Spill the dense factors of the fronts to node-local scratch files
+    // during subsequent factorizations (see ldl::OutOfCoreCtrl).
+    void SetOutOfCoreCtrl( const ldl::OutOfCoreCtrl& ctrl );
+    ldl::OutOfCoreStats OutOfCoreStats() const;
+
+    // The parameters of the LDL_BLR_1D and LDL_BLR_2D factorizations
+    void SetBLRCtrl( const ldl::BLRCtrl<Base<Field>>& ctrl );
+
     // Overwrite 'B' with the solution to 'A X = B'.
     void Solve( Matrix<Field>& B ) const;
     void Solve( ldl::MatrixNode<Field>& B ) const;
@@ -521,6 +789,10 @@ public:
     double FactorGFlops() const;
     double SolveGFlops( Int numRHS=1 ) const;
 
+    // Predict the cost of factoring with the given front type (which can be
+    // called as soon as the tree is initialized).
+    ldl::FactorEstimate Estimate( LDLFrontType frontType=LDL_2D ) const;
+
     ldl::Front<Field>& Front();
     const ldl::Front<Field>& Front() const;
 
@@ -544,6 +816,11 @@ private:
     unique_ptr<ldl::Separator> separator_;
 
     vector<Int> map_, inverseMap_;
+
+    ldl::OutOfCoreCtrl outOfCoreCtrl_;
+    unique_ptr<ldl::FrontStore<Field>> store_;
+
+    ldl::BLRCtrl<Base<Field>> blrCtrl_;
 };
 
 template<typename Field>
@@ -582,13 +859,23 @@ public:
     // with a different matrix (e.g., within an Interior Point Method).
     void ChangeNonzeroValues( const DistSparseMatrix<Field>& ANew );
 
-    // Factor the initialized multifrontal tree.
+    // Factor the initialized multifrontal tree. The CHOLESKY_1D and
+    // CHOLESKY_2D types apply dense Cholesky factorizations to every front
+    // (including the leaves) and require a Hermitian positive-definite matrix.
     void Factor( LDLFrontType frontType=LDL_2D );
 
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
     void ChangeFrontType( LDLFrontType frontType );
 
+    // Spill the dense factors of the sequential subtrees' fronts to node-local
+    // scratch files during subsequent factorizations (see ldl::OutOfCoreCtrl).
+    void SetOutOfCoreCtrl( const ldl::OutOfCoreCtrl& ctrl );
+    ldl::OutOfCoreStats OutOfCoreStats() const;
+
+    // The parameters of the LDL_BLR_1D and LDL_BLR_2D factorizations
+    void SetBLRCtrl( const ldl::BLRCtrl<Base<Field>>& ctrl );
+
     // Overwrite 'B' with the solution to 'A X = B'.
     void Solve( DistMultiVec<Field>& B ) const;
     void Solve( ldl::DistMultiVecNode<Field>& B ) const;
@@ -643,6 +930,10 @@ public:
     double LocalFactorGFlops( bool selInv=false ) const;
     double LocalSolveGFlops( Int numRHS=1 ) const;
 
+    // Predict the cost of factoring with the given front type (which can be
+    // called as soon as the tree is initialized and is collective).
+    ldl::FactorEstimate Estimate( LDLFrontType frontType=LDL_2D ) const;
+
     ldl::DistFront<Field>& Front();
     const ldl::DistFront<Field>& Front() const;
 
@@ -672,9 +963,18 @@ private:
     // Metadata for repeated calls to DistFront<Field>::Pull
     mutable bool formedPullMetadata_=false;
     mutable vector<Int> mappedSources_, mappedTargets_, columnOffsets_;
+    mutable ldl::DistFrontPullMeta pullMeta_;
 
-    // Metadata for future use.
+    // Metadata and nodal workspaces which are reused across calls to
+    // Solve( DistMultiVec<Field>& ) (which is therefore not reentrant).
     mutable ldl::DistMultiVecNodeMeta dmvMeta_;
+    mutable unique_ptr<ldl::DistMultiVecNode<Field>> multiVecNodal_;
+    mutable unique_ptr<ldl::DistMatrixNode<Field>> matrixNodal_;
+
+    ldl::OutOfCoreCtrl outOfCoreCtrl_;
+    unique_ptr<ldl::FrontStore<Field>> store_;
+
+    ldl::BLRCtrl<Base<Field>> blrCtrl_;
 };
 
 } // namespace El
@@ -50,6 +50,41 @@ void NestedDissection
         DistNodeInfo& rootInfo,
   const BisectCtrl& ctrl=BisectCtrl() );
 
+// Serialization of the (pre-analysis) separator and elimination trees produced
+// by NestedDissection so that later reorderings of the same graph can skip
+// the bisections. The distributed routines use one file per process and
+// LoadOrdering is collective over the grid of 'rootInfo', which must already
+// be set; it only succeeds if every process could load its file. SaveOrdering
+// is local and, rather than throwing, warns and returns false if the file
+// could not be written.
+string OrderingCacheName( const Graph& graph, const BisectCtrl& ctrl );
+string OrderingCacheName( const DistGraph& graph, const BisectCtrl& ctrl );
+bool SaveOrdering
+( const string& filename, const Separator& rootSep, const NodeInfo& rootInfo );
+bool SaveOrdering
+( const string& filename,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo );
+bool LoadOrdering
+( const string& filename, Separator& rootSep, NodeInfo& rootInfo );
+bool LoadOrdering
+( const string& filename, DistSeparator& rootSep, DistNodeInfo& rootInfo );
+
+// Relaxed supernode amalgamation of the (pre-analysis) trees produced by the
+// bisections (see BisectCtrl::amalgamate); the sequential subtrees are
+// renumbered, so the maps must be built afterwards. Only separators, and not
+// the sparse leaves, are merged, and the distributed fronts are left intact.
+void Amalgamate
+( Separator& rootSep, NodeInfo& rootInfo, const BisectCtrl& ctrl );
+void Amalgamate
+( DistSeparator& rootSep, DistNodeInfo& rootInfo, const BisectCtrl& ctrl );
+
+// Entry k of the histogram counts the fronts whose sizes lie within
+// [2^k,2^(k+1)), with the empty fronts counted by the first entry. The
+// distributed version is collective over the grid of 'rootInfo'.
+vector<Int> FrontSizeHistogram( const NodeInfo& rootInfo );
+vector<Int> FrontSizeHistogram( const DistNodeInfo& rootInfo );
+
 void NaturalNestedDissection
 ( Int nx, Int ny, Int nz,
   const Graph& graph,
@@ -27,6 +27,8 @@ typedef struct {
   float tol;
   float power;
   ElSignScaling scaling;
+  bool newtonSchulz;
+  float newtonSchulzTol;
   bool progress;
 } ElSignCtrl_s;
 EL_EXPORT ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl );
@@ -36,6 +38,8 @@ typedef struct {
   double tol;
   double power;
   ElSignScaling scaling;
+  bool newtonSchulz;
+  double newtonSchulzTol;
   bool progress;
 } ElSignCtrl_d;
 EL_EXPORT ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl );
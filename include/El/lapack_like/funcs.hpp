@@ -30,9 +30,24 @@ struct SignCtrl
     Real tol=Real(0);
     Real power=Real(1);
     SignScaling scaling=SIGN_SCALE_FROB;
+
+    // Switch to the inverse-free Newton-Schulz iteration, which only requires
+    // matrix-matrix multiplication, once || X^2 - I ||_F <= newtonSchulzTol
+    bool newtonSchulz=true;
+    Real newtonSchulzTol=Real(1)/Real(2);
+
     bool progress=false;
 };
 
+struct SignInfo
+{
+    Int numIts=0;
+
+    // The number of accepted and rejected Newton-Schulz steps
+    Int numNewtonSchulzIts=0;
+    Int numNewtonSchulzRejections=0;
+};
+
 template<typename Real>
 struct SquareRootCtrl
 {
@@ -141,19 +156,19 @@ void HermitianPseudoinverse
 // Sign
 // ====
 template<typename Field>
-void Sign
+SignInfo Sign
 ( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() );
 template<typename Field>
-void Sign
+SignInfo Sign
 ( AbstractDistMatrix<Field>& A,
   const SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() );
 
 template<typename Field>
-void Sign
+SignInfo Sign
 ( Matrix<Field>& A, Matrix<Field>& N,
   const SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() );
 template<typename Field>
-void Sign
+SignInfo Sign
 ( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& N,
   const SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() );
 
@@ -246,10 +246,80 @@ void MultiShiftHessSolve
   const AbstractDistMatrix<Field>& shifts,
         AbstractDistMatrix<Field>& X );
 
+// Krylov-subspace methods for sparse systems
+// ==========================================
+// CG, MINRES, BiCGStab, and BlockCG are implemented in the headers included
+// at the bottom of this file; their control structure and the simple
+// preconditioners follow.
+template<typename Real>
+struct KrylovCtrl
+{
+    Real relTol;
+    Int maxIts=1000;
+    // Overlap each (fused) global reduction with applications of the
+    // preconditioner and A (CG, MINRES, and BiCGStab)
+    bool pipelined=false;
+    bool progress=false;
+
+    KrylovCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        relTol = Pow(eps,Real(0.5));
+    }
+};
+
+// Point Jacobi: apply the inverse of the diagonal of A
+template<typename Field>
+class JacobiPrecond
+{
+public:
+    JacobiPrecond() { }
+    JacobiPrecond( const SparseMatrix<Field>& A );
+    JacobiPrecond( const DistSparseMatrix<Field>& A );
+
+    void operator()( Matrix<Field>& B ) const;
+    void operator()( DistMultiVec<Field>& B ) const;
+
+private:
+    // The inverses of the diagonal entries of the (local) rows of A
+    Matrix<Field> dInv_;
+};
+
+// A zero fill-in incomplete LU factorization, L U ~= A, where L is unit
+// lower-triangular and the sparsity patterns of L and U are contained within
+// that of A. For a DistSparseMatrix, each process factors the diagonal block
+// of its rows of A, and so the result is a block Jacobi preconditioner which
+// does not require any communication.
+template<typename Field>
+class ILU0Precond
+{
+public:
+    ILU0Precond() { }
+    ILU0Precond( const SparseMatrix<Field>& A );
+    ILU0Precond( const DistSparseMatrix<Field>& A );
+
+    void operator()( Matrix<Field>& B ) const;
+    void operator()( DistMultiVec<Field>& B ) const;
+
+private:
+    // The factors are stored in place of the (local diagonal block of) A in
+    // compressed sparse row format with sorted column indices
+    vector<Int> offsets_, targets_, diagInds_;
+    vector<Field> values_;
+
+    void Factor();
+};
+
 } // namespace El
 
+#include <El/lapack_like/solve/GMRESOrth.hpp>
 #include <El/lapack_like/solve/FGMRES.hpp>
 #include <El/lapack_like/solve/LGMRES.hpp>
 #include <El/lapack_like/solve/Refined.hpp>
+#include <El/lapack_like/solve/Krylov.hpp>
+#include <El/lapack_like/solve/CG.hpp>
+#include <El/lapack_like/solve/MINRES.hpp>
+#include <El/lapack_like/solve/BiCGStab.hpp>
+#include <El/lapack_like/solve/BlockCG.hpp>
 
 #endif // ifndef EL_SOLVE_HPP
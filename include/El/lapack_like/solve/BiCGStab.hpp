@@ -0,0 +1,348 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_BICGSTAB_HPP
+#define EL_SOLVE_BICGSTAB_HPP
+
+// Right-preconditioned BiCGStab for general (square) A, as introduced in
+//   Henk A. van der Vorst,
+//   "Bi-CGSTAB: A fast and smoothly converging variant of Bi-CG for the
+//   solution of nonsymmetric linear systems",
+//   SIAM J. Sci. Stat. Comput., Vol. 13, No. 2, pp. 631--644, 1992.
+// The pipelined variant is the preconditioned p-BiCGStab of
+//   Siegfried Cools and Wim Vanroose,
+//   "The communication-hiding pipelined BiCGStab method for the parallel
+//   solution of large unsymmetric linear systems",
+//   Parallel Computing, Vol. 65, pp. 1--20, 2017.
+// which overlaps each of its two (fused) reductions per iteration with an
+// application of both the preconditioner and A, at the cost of storing
+// several more vectors.
+
+namespace El {
+
+namespace bicgstab {
+
+// See Krylov.hpp for the forms of 'applyA' and 'precond'
+template<typename Field,class VecType,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+  const KrylovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    using krylov::Local;
+    krylov::TeamSum<Field> sum( b );
+    Matrix<Field> sums;
+
+    // x := 0, r := b, and the shadow residual r0 := b
+    auto x = b;
+    Zero( Local(x) );
+    auto r = b;
+    const auto& r0 = b;
+
+    Zeros( sums, 1, 1 );
+    sums(0) = Dot( Local(r), Local(r) );
+    sum( sums );
+    const Real origResidNorm = Sqrt( RealPart(sums(0)) );
+    if( ctrl.progress )
+        krylov::Progress( b, "origResidNorm: ",origResidNorm );
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    auto p = x, v = x, pHat = x, s = x, sHat = x, t = x;
+    Field rho = origResidNorm*origResidNorm, alpha=1, omega=1;
+    Field rhoOld = rho;
+    Int iter = 0;
+    while( true )
+    {
+        // p := r + beta (p - omega v)
+        const Field beta = (rho/rhoOld)*(alpha/omega);
+        Axpy( -omega, Local(v), Local(p) );
+        Scale( beta, Local(p) );
+        Axpy( Field(1), Local(r), Local(p) );
+
+        // v := A inv(M) p, alpha := rho / (r0' v)
+        pHat = p;
+        precond( pHat );
+        applyA( Field(1), pHat, Field(0), v );
+        Zeros( sums, 1, 1 );
+        sums(0) = Dot( Local(r0), Local(v) );
+        sum( sums );
+        if( sums(0) == Field(0) )
+            RuntimeError("BiCGStab broke down");
+        alpha = rho / sums(0);
+
+        // s := r - alpha v, t := A inv(M) s
+        s = r;
+        Axpy( -alpha, Local(v), Local(s) );
+        sHat = s;
+        precond( sHat );
+        applyA( Field(1), sHat, Field(0), t );
+
+        // omega := (t' s) / (t' t)
+        Zeros( sums, 2, 1 );
+        sums(0) = Dot( Local(t), Local(s) );
+        sums(1) = Dot( Local(t), Local(t) );
+        sum( sums );
+        if( sums(1) == Field(0) )
+            RuntimeError("BiCGStab broke down");
+        omega = sums(0) / sums(1);
+
+        // x := x + alpha inv(M) p + omega inv(M) s, r := s - omega t
+        Axpy( alpha, Local(pHat), Local(x) );
+        Axpy( omega, Local(sHat), Local(x) );
+        r = s;
+        Axpy( -omega, Local(t), Local(r) );
+        ++iter;
+
+        // rho := r0' r and || r ||_2^2
+        Zeros( sums, 2, 1 );
+        sums(0) = Dot( Local(r0), Local(r) );
+        sums(1) = Dot( Local(r), Local(r) );
+        sum( sums );
+        const Real residNorm = Sqrt( RealPart(sums(1)) );
+        krylov::CheckFinite( residNorm, "BiCGStab residual norm" );
+        const Real relResidNorm = residNorm / origResidNorm;
+        if( ctrl.progress )
+            krylov::Progress
+            ( b, "iteration ",iter,": relative residual norm ",relResidNorm );
+        if( relResidNorm < ctrl.relTol )
+            break;
+        if( iter == ctrl.maxIts )
+            RuntimeError("BiCGStab did not converge");
+        if( sums(0) == Field(0) || omega == Field(0) )
+            RuntimeError("BiCGStab broke down");
+        rhoOld = rho;
+        rho = sums(0);
+    }
+    b = x;
+    return iter;
+}
+
+template<typename Field,class VecType,class ApplyAType,class PrecondType>
+Int Pipelined
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+  const KrylovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    using krylov::Local;
+    krylov::TeamSum<Field> sum( b );
+    Matrix<Field> sums;
+
+    // x := 0, r := b, and the shadow residual r0 := b.
+    // The hatted vectors are the preconditioned versions of their
+    // counterparts, e.g., rHat = inv(M) r, and w = A rHat and t = A wHat.
+    auto x = b;
+    Zero( Local(x) );
+    auto r = b;
+    const auto& r0 = b;
+    auto rHat = r;
+    precond( rHat );
+    auto w = x;
+    applyA( Field(1), rHat, Field(0), w );
+    auto wHat = w;
+    precond( wHat );
+    auto t = x;
+    applyA( Field(1), wHat, Field(0), t );
+
+    // rho := r0' r, alpha := rho / (r0' w)
+    Zeros( sums, 3, 1 );
+    sums(0) = Dot( Local(r0), Local(r) );
+    sums(1) = Dot( Local(r0), Local(w) );
+    sums(2) = Dot( Local(r), Local(r) );
+    sum( sums );
+    const Real origResidNorm = Sqrt( RealPart(sums(2)) );
+    if( ctrl.progress )
+        krylov::Progress( b, "origResidNorm: ",origResidNorm );
+    if( origResidNorm == Real(0) )
+        return 0;
+    if( sums(1) == Field(0) )
+        RuntimeError("BiCGStab broke down");
+    Field rho = sums(0);
+    Field alpha = rho / sums(1);
+    Field beta=0, omega=0;
+
+    // The search direction pHat and the recurrences s = A pHat,
+    // z = A sHat, and v = A zHat
+    auto pHat = x, s = x, sHat = x, z = x, zHat = x, v = x;
+    auto q = x, qHat = x, y = x;
+    Int iter = 0;
+    while( true )
+    {
+        // pHat := rHat + beta (pHat - omega sHat),
+        // s    := w    + beta (s    - omega z),
+        // sHat := wHat + beta (sHat - omega zHat),
+        // z    := t    + beta (z    - omega v)
+        Axpy( -omega, Local(sHat), Local(pHat) );
+        Scale( beta, Local(pHat) );
+        Axpy( Field(1), Local(rHat), Local(pHat) );
+        Axpy( -omega, Local(z), Local(s) );
+        Scale( beta, Local(s) );
+        Axpy( Field(1), Local(w), Local(s) );
+        Axpy( -omega, Local(zHat), Local(sHat) );
+        Scale( beta, Local(sHat) );
+        Axpy( Field(1), Local(wHat), Local(sHat) );
+        Axpy( -omega, Local(v), Local(z) );
+        Scale( beta, Local(z) );
+        Axpy( Field(1), Local(t), Local(z) );
+
+        // q := r - alpha s, qHat := rHat - alpha sHat, y := w - alpha z
+        q = r;
+        Axpy( -alpha, Local(s), Local(q) );
+        qHat = rHat;
+        Axpy( -alpha, Local(sHat), Local(qHat) );
+        y = w;
+        Axpy( -alpha, Local(z), Local(y) );
+
+        // Start summing q' y and y' y while forming zHat := inv(M) z and
+        // v := A zHat
+        Zeros( sums, 2, 1 );
+        sums(0) = Dot( Local(y), Local(q) );
+        sums(1) = Dot( Local(y), Local(y) );
+        sum.Start( sums );
+        zHat = z;
+        precond( zHat );
+        applyA( Field(1), zHat, Field(0), v );
+        sum.Finish();
+        if( sums(1) == Field(0) )
+            RuntimeError("BiCGStab broke down");
+        omega = sums(0) / sums(1);
+
+        // x := x + alpha pHat + omega qHat, r := q - omega y,
+        // rHat := qHat - omega (wHat - alpha zHat),
+        // w := y - omega (t - alpha v)
+        Axpy( alpha, Local(pHat), Local(x) );
+        Axpy( omega, Local(qHat), Local(x) );
+        r = q;
+        Axpy( -omega, Local(y), Local(r) );
+        Axpy( -alpha, Local(zHat), Local(wHat) );
+        rHat = qHat;
+        Axpy( -omega, Local(wHat), Local(rHat) );
+        Axpy( -alpha, Local(v), Local(t) );
+        w = y;
+        Axpy( -omega, Local(t), Local(w) );
+        ++iter;
+
+        // Start summing r0' r, r0' w, r0' s, r0' z, and || r ||_2^2 while
+        // forming wHat := inv(M) w and t := A wHat
+        Zeros( sums, 5, 1 );
+        sums(0) = Dot( Local(r0), Local(r) );
+        sums(1) = Dot( Local(r0), Local(w) );
+        sums(2) = Dot( Local(r0), Local(s) );
+        sums(3) = Dot( Local(r0), Local(z) );
+        sums(4) = Dot( Local(r), Local(r) );
+        sum.Start( sums );
+        wHat = w;
+        precond( wHat );
+        applyA( Field(1), wHat, Field(0), t );
+        sum.Finish();
+
+        const Real residNorm = Sqrt( RealPart(sums(4)) );
+        krylov::CheckFinite( residNorm, "BiCGStab residual norm" );
+        const Real relResidNorm = residNorm / origResidNorm;
+        if( ctrl.progress )
+            krylov::Progress
+            ( b, "iteration ",iter,": relative residual norm ",relResidNorm );
+        if( relResidNorm < ctrl.relTol )
+            break;
+        if( iter == ctrl.maxIts )
+            RuntimeError("BiCGStab did not converge");
+        if( rho == Field(0) || omega == Field(0) )
+            RuntimeError("BiCGStab broke down");
+
+        // beta := (alpha/omega) (r0' r) / rho,
+        // alpha := (r0' r) / (r0' w + beta r0' s - beta omega r0' z)
+        beta = (alpha/omega)*(sums(0)/rho);
+        rho = sums(0);
+        const Field denom = sums(1) + beta*sums(2) - beta*omega*sums(3);
+        if( denom == Field(0) )
+            RuntimeError("BiCGStab broke down");
+        alpha = rho / denom;
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace bicgstab
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int BiCGStab
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    return krylov::EachColumn
+    ( B,
+      [&]( Matrix<Field>& b )
+      {
+          if( ctrl.pipelined )
+              return bicgstab::Pipelined<Field>( applyA, precond, b, ctrl );
+          else
+              return bicgstab::Single<Field>( applyA, precond, b, ctrl );
+      } );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int BiCGStab
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    return krylov::EachColumn
+    ( B,
+      [&]( DistMultiVec<Field>& b )
+      {
+          if( ctrl.pipelined )
+              return bicgstab::Pipelined<Field>( applyA, precond, b, ctrl );
+          else
+              return bicgstab::Single<Field>( applyA, precond, b, ctrl );
+      } );
+}
+
+template<typename Field,class PrecondType>
+Int BiCGStab
+( const SparseMatrix<Field>& A,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X,
+           Field beta,        Matrix<Field>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+    return BiCGStab( applyA, precond, B, ctrl );
+}
+
+template<typename Field,class PrecondType>
+Int BiCGStab
+( const DistSparseMatrix<Field>& A,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+    return BiCGStab( applyA, precond, B, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_BICGSTAB_HPP
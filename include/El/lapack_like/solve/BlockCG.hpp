@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_BLOCKCG_HPP
+#define EL_SOLVE_BLOCKCG_HPP
+
+// Preconditioned block Conjugate Gradients for Hermitian Positive-Definite A
+// (and preconditioners), following
+//   Dianne P. O'Leary,
+//   "The block conjugate gradient algorithm and related methods",
+//   Linear Algebra Appl., Vol. 29, pp. 293--322, 1980.
+// All of the right-hand sides share a single block Krylov subspace, and so
+// each iteration requires one application of A and of the preconditioner to
+// a block of vectors and only two (k x k) reductions, regardless of the
+// number of right-hand sides, k.
+//
+// NOTE: The search directions are not deflated, and so a RuntimeError is
+//       thrown if they become (numerically) linearly dependent, e.g., if the
+//       right-hand sides were themselves linearly dependent.
+
+namespace El {
+
+namespace block_cg {
+
+// See Krylov.hpp for the forms of 'applyA' and 'precond'
+template<typename Field,class VecType,class ApplyAType,class PrecondType>
+Int Solve
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& B,
+  const KrylovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    using krylov::Local;
+    krylov::TeamSum<Field> sum( B );
+    const Int k = B.Width();
+    if( k == 0 )
+        return 0;
+
+    // Sum [R' Z; || R(:,j) ||_2^2, j=0:k-1] with a single reduction
+    Matrix<Field> sums;
+    auto sumProducts =
+      [&]( const VecType& R, const VecType& Z )
+      {
+          Zeros( sums, k+1, k );
+          auto sumsT = sums( IR(0,k), ALL );
+          Gemm
+          ( ADJOINT, NORMAL,
+            Field(1), Local(R), Local(Z), Field(0), sumsT );
+          for( Int j=0; j<k; ++j )
+          {
+              auto r = Local(R)( ALL, IR(j) );
+              sums(k,j) = Dot( r, r );
+          }
+          sum( sums );
+      };
+
+    // X := 0, R := B, Z := inv(M) R
+    auto X = B;
+    Zero( Local(X) );
+    auto R = B;
+    auto Z = R;
+    precond( Z );
+
+    sumProducts( R, Z );
+    Matrix<Field> RZ;
+    RZ = sums( IR(0,k), ALL );
+    Matrix<Real> origResidNorms;
+    Zeros( origResidNorms, k, 1 );
+    Real maxOrigResidNorm = 0;
+    for( Int j=0; j<k; ++j )
+    {
+        origResidNorms(j) = Sqrt( RealPart(sums(k,j)) );
+        maxOrigResidNorm = Max( maxOrigResidNorm, origResidNorms(j) );
+    }
+    if( ctrl.progress )
+        krylov::Progress( B, "max origResidNorm: ",maxOrigResidNorm );
+    if( maxOrigResidNorm == Real(0) )
+        return 0;
+
+    auto P = Z;
+    auto Q = B;
+    Matrix<Field> PQ, alpha, beta, RZOld;
+    Int iter = 0;
+    while( true )
+    {
+        // alpha := inv(P' A P) (R' Z)
+        applyA( Field(1), P, Field(0), Q );
+        Zeros( PQ, k, k );
+        Gemm( ADJOINT, NORMAL, Field(1), Local(P), Local(Q), Field(0), PQ );
+        sum( PQ );
+        alpha = RZ;
+        LinearSolve( PQ, alpha );
+
+        // X := X + P alpha, R := R - Q alpha, Z := inv(M) R
+        Gemm
+        ( NORMAL, NORMAL, Field(1), Local(P), alpha, Field(1), Local(X) );
+        Gemm
+        ( NORMAL, NORMAL, Field(-1), Local(Q), alpha, Field(1), Local(R) );
+        Z = R;
+        precond( Z );
+        ++iter;
+
+        sumProducts( R, Z );
+        RZOld = RZ;
+        RZ = sums( IR(0,k), ALL );
+        Real maxRelResidNorm = 0;
+        for( Int j=0; j<k; ++j )
+        {
+            if( origResidNorms(j) == Real(0) )
+                continue;
+            const Real residNorm = Sqrt( RealPart(sums(k,j)) );
+            maxRelResidNorm =
+              Max( maxRelResidNorm, residNorm/origResidNorms(j) );
+        }
+        krylov::CheckFinite( maxRelResidNorm, "Block CG residual norm" );
+        if( ctrl.progress )
+            krylov::Progress
+            ( B, "iteration ",iter,": max relative residual norm ",
+              maxRelResidNorm );
+        if( maxRelResidNorm < ctrl.relTol )
+            break;
+        if( iter == ctrl.maxIts )
+            RuntimeError("Block CG did not converge");
+
+        // P := Z + P inv(RZOld) RZ
+        beta = RZ;
+        LinearSolve( RZOld, beta );
+        Q = Z;
+        Gemm
+        ( NORMAL, NORMAL, Field(1), Local(P), beta, Field(1), Local(Q) );
+        P = Q;
+    }
+    B = X;
+    return iter;
+}
+
+} // namespace block_cg
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int BlockCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    return block_cg::Solve<Field>( applyA, precond, B, ctrl );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int BlockCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    return block_cg::Solve<Field>( applyA, precond, B, ctrl );
+}
+
+template<typename Field,class PrecondType>
+Int BlockCG
+( const SparseMatrix<Field>& A,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X,
+           Field beta,        Matrix<Field>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+    return BlockCG( applyA, precond, B, ctrl );
+}
+
+template<typename Field,class PrecondType>
+Int BlockCG
+( const DistSparseMatrix<Field>& A,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+    return BlockCG( applyA, precond, B, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_BLOCKCG_HPP
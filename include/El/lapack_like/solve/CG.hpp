@@ -0,0 +1,284 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_CG_HPP
+#define EL_SOLVE_CG_HPP
+
+// Preconditioned Conjugate Gradients for Hermitian Positive-Definite A (and
+// preconditioners). The pipelined variant is "Algorithm 3" of
+//   Pieter Ghysels and Wim Vanroose,
+//   "Hiding global synchronization latency in the preconditioned Conjugate
+//   Gradient algorithm", Parallel Computing, Vol. 40, No. 7, 2014.
+// which overlaps its single (fused) reduction per iteration with an
+// application of both the preconditioner and A.
+
+namespace El {
+
+namespace cg {
+
+// See Krylov.hpp for the forms of 'applyA' and 'precond'
+template<typename Field,class VecType,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+  const KrylovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    using krylov::Local;
+    krylov::TeamSum<Field> sum( b );
+    Matrix<Field> sums;
+
+    // x := 0, r := b, z := inv(M) r
+    auto x = b;
+    Zero( Local(x) );
+    auto r = b;
+    auto z = r;
+    precond( z );
+
+    // rho := r' z and || r ||_2^2
+    Zeros( sums, 2, 1 );
+    sums(0) = Dot( Local(r), Local(z) );
+    sums(1) = Dot( Local(r), Local(r) );
+    sum( sums );
+    Real rho = RealPart(sums(0));
+    const Real origResidNorm = Sqrt( RealPart(sums(1)) );
+    if( ctrl.progress )
+        krylov::Progress( b, "origResidNorm: ",origResidNorm );
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    auto p = z;
+    auto q = b;
+    Int iter = 0;
+    while( true )
+    {
+        // alpha := rho / (p' A p)
+        applyA( Field(1), p, Field(0), q );
+        Zeros( sums, 1, 1 );
+        sums(0) = Dot( Local(p), Local(q) );
+        sum( sums );
+        const Real pAp = RealPart(sums(0));
+        if( pAp <= Real(0) )
+            RuntimeError("CG encountered p' A p = ",pAp);
+        const Real alpha = rho / pAp;
+
+        // x := x + alpha p, r := r - alpha A p, z := inv(M) r
+        Axpy( Field(alpha), Local(p), Local(x) );
+        Axpy( Field(-alpha), Local(q), Local(r) );
+        z = r;
+        precond( z );
+        ++iter;
+
+        Zeros( sums, 2, 1 );
+        sums(0) = Dot( Local(r), Local(z) );
+        sums(1) = Dot( Local(r), Local(r) );
+        sum( sums );
+        const Real rhoNew = RealPart(sums(0));
+        const Real residNorm = Sqrt( RealPart(sums(1)) );
+        krylov::CheckFinite( residNorm, "CG residual norm" );
+        const Real relResidNorm = residNorm / origResidNorm;
+        if( ctrl.progress )
+            krylov::Progress
+            ( b, "iteration ",iter,": relative residual norm ",relResidNorm );
+        if( relResidNorm < ctrl.relTol )
+            break;
+        if( iter == ctrl.maxIts )
+            RuntimeError("CG did not converge");
+
+        // p := z + (rhoNew/rho) p
+        Scale( Field(rhoNew/rho), Local(p) );
+        Axpy( Field(1), Local(z), Local(p) );
+        rho = rhoNew;
+    }
+    b = x;
+    return iter;
+}
+
+template<typename Field,class VecType,class ApplyAType,class PrecondType>
+Int Pipelined
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+  const KrylovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    using krylov::Local;
+    krylov::TeamSum<Field> sum( b );
+    Matrix<Field> sums;
+
+    // x := 0, r := b, u := inv(M) r, w := A u
+    auto x = b;
+    Zero( Local(x) );
+    auto r = b;
+    auto u = r;
+    precond( u );
+    auto w = b;
+    applyA( Field(1), u, Field(0), w );
+
+    // The search direction p and the recurrences s = A p, q = inv(M) s, and
+    // z = A q
+    auto p = x, s = x, q = x, z = x;
+    auto m = x, n = x;
+
+    Real origResidNorm=0, gammaOld=0, alphaOld=0;
+    Int iter = 0;
+    while( true )
+    {
+        // Start summing gamma := r' u, delta := w' u, and || r ||_2^2
+        Zeros( sums, 3, 1 );
+        sums(0) = Dot( Local(r), Local(u) );
+        sums(1) = Dot( Local(w), Local(u) );
+        sums(2) = Dot( Local(r), Local(r) );
+        sum.Start( sums );
+
+        // m := inv(M) w, n := A m
+        m = w;
+        precond( m );
+        applyA( Field(1), m, Field(0), n );
+
+        sum.Finish();
+        const Real gamma = RealPart(sums(0));
+        const Real delta = RealPart(sums(1));
+        const Real residNorm = Sqrt( RealPart(sums(2)) );
+        krylov::CheckFinite( residNorm, "CG residual norm" );
+        if( iter == 0 )
+        {
+            origResidNorm = residNorm;
+            if( ctrl.progress )
+                krylov::Progress( b, "origResidNorm: ",origResidNorm );
+            if( origResidNorm == Real(0) )
+                return 0;
+        }
+        else
+        {
+            const Real relResidNorm = residNorm / origResidNorm;
+            if( ctrl.progress )
+                krylov::Progress
+                ( b, "iteration ",iter,": relative residual norm ",
+                  relResidNorm );
+            if( relResidNorm < ctrl.relTol )
+                break;
+            if( iter == ctrl.maxIts )
+                RuntimeError("CG did not converge");
+        }
+
+        Real alpha, beta;
+        if( iter == 0 )
+        {
+            beta = 0;
+            alpha = gamma / delta;
+        }
+        else
+        {
+            beta = gamma / gammaOld;
+            alpha = gamma / (delta - beta*gamma/alphaOld);
+        }
+        if( !(alpha > Real(0)) )
+            RuntimeError("Pipelined CG encountered alpha = ",alpha);
+
+        // z := n + beta z, q := m + beta q, s := w + beta s, p := u + beta p
+        Scale( Field(beta), Local(z) );
+        Axpy( Field(1), Local(n), Local(z) );
+        Scale( Field(beta), Local(q) );
+        Axpy( Field(1), Local(m), Local(q) );
+        Scale( Field(beta), Local(s) );
+        Axpy( Field(1), Local(w), Local(s) );
+        Scale( Field(beta), Local(p) );
+        Axpy( Field(1), Local(u), Local(p) );
+
+        // x := x + alpha p, r := r - alpha s, u := u - alpha q,
+        // w := w - alpha z
+        Axpy( Field(alpha), Local(p), Local(x) );
+        Axpy( Field(-alpha), Local(s), Local(r) );
+        Axpy( Field(-alpha), Local(q), Local(u) );
+        Axpy( Field(-alpha), Local(z), Local(w) );
+
+        gammaOld = gamma;
+        alphaOld = alpha;
+        ++iter;
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace cg
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int CG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    return krylov::EachColumn
+    ( B,
+      [&]( Matrix<Field>& b )
+      {
+          if( ctrl.pipelined )
+              return cg::Pipelined<Field>( applyA, precond, b, ctrl );
+          else
+              return cg::Single<Field>( applyA, precond, b, ctrl );
+      } );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int CG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    return krylov::EachColumn
+    ( B,
+      [&]( DistMultiVec<Field>& b )
+      {
+          if( ctrl.pipelined )
+              return cg::Pipelined<Field>( applyA, precond, b, ctrl );
+          else
+              return cg::Single<Field>( applyA, precond, b, ctrl );
+      } );
+}
+
+template<typename Field,class PrecondType>
+Int CG
+( const SparseMatrix<Field>& A,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X,
+           Field beta,        Matrix<Field>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+    return CG( applyA, precond, B, ctrl );
+}
+
+template<typename Field,class PrecondType>
+Int CG
+( const DistSparseMatrix<Field>& A,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+    return CG( applyA, precond, B, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_CG_HPP
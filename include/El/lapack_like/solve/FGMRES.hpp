@@ -32,6 +32,11 @@ namespace fgmres {
 //
 // and overwrite b with an approximation of inv(A) b.
 //
+// The Arnoldi process orthogonalizes with 'orthAlg' (see GMRESOrthAlg); the
+// pipelined variant applies the preconditioner to the unorthogonalized
+// vector, and so the directions z_j are only equal to inv(M) v_j (up to
+// rounding) when the preconditioner is linear.
+//
 
 // TODO(poulson): Add support for an initial guess
 template<typename Field,class ApplyAType,class PrecondType>
@@ -42,7 +47,8 @@ Int Single
         Base<Field> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GMRESOrthAlg orthAlg=GMRES_MGS )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -56,6 +62,8 @@ Int Single
 
     typedef Base<Field> Real;
     const Int n = b.Height();
+    const bool pipelined = ( orthAlg == GMRES_PIPELINED );
+    auto reduce = []( Matrix<Field>& ) { };
     Timer iterTimer;
 
     // x := 0
@@ -86,7 +94,9 @@ Int Single
     bool converged = false;
     Matrix<Real> cs;
     Matrix<Field> sn, H, t;
-    Matrix<Field> x0, V, Z, AZ, q;
+    Matrix<Field> x0, V, Z, AZ, q, dots, u, p;
+    if( pipelined )
+        Zeros( p, n, 1 );
     while( !converged )
     {
         if( progress )
@@ -98,7 +108,7 @@ Int Single
         Zeros( H,  restart, restart );
         Zeros( V, n, restart );
         Zeros( Z, n, restart );
-        if( saveProducts )
+        if( saveProducts || pipelined )
             Zeros( AZ, n, restart );
 
         // x0 := x
@@ -134,36 +144,88 @@ Int Single
                 iterTimer.Start();
             const Int innerIndent = PushIndent();
 
-            // z_j := inv(M) v_j
-            // =================
-            auto vj = V( ALL, IR(j) );
-            auto zj = Z( ALL, IR(j) );
-            zj = vj;
-            precond( zj );
-
-            // w := A z_j
-            // ----------
-            applyA( Field(1), zj, Field(0), w );
-            if( saveProducts )
+            if( pipelined && j > 0 )
             {
-                auto Azj = AZ( ALL, IR(j) );
-                Azj = w;
+                // z_j and A z_j were formed during the previous step
+                // --------------------------------------------------
+                w = AZ( ALL, IR(j) );
+            }
+            else
+            {
+                // z_j := inv(M) v_j
+                // =================
+                auto vj = V( ALL, IR(j) );
+                auto zj = Z( ALL, IR(j) );
+                zj = vj;
+                precond( zj );
+
+                // w := A z_j
+                // ----------
+                applyA( Field(1), zj, Field(0), w );
+                if( saveProducts || pipelined )
+                {
+                    auto Azj = AZ( ALL, IR(j) );
+                    Azj = w;
+                }
             }
 
             // Run the j'th step of Arnoldi
             // ----------------------------
-            for( Int i=0; i<=j; ++i )
+            Real delta;
+            if( orthAlg == GMRES_MGS )
+            {
+                for( Int i=0; i<=j; ++i )
+                {
+                    // H(i,j) := v_i' w
+                    // ^^^^^^^^^^^^^^^^
+                    auto vi = V( ALL, IR(i) );
+                    H(i,j) = Dot(vi,w);
+
+                    // w := w - H(i,j) v_i
+                    // ^^^^^^^^^^^^^^^^^^^
+                    Axpy( -H(i,j), vi, w );
+                }
+                delta = Nrm2( w );
+            }
+            else
             {
-                // H(i,j) := v_i' w
-                // ^^^^^^^^^^^^^^^^
-                auto vi = V( ALL, IR(i) );
-                H(i,j) = Dot(vi,w);
-
-                // w := w - H(i,j) v_i
-                // ^^^^^^^^^^^^^^^^^^^
-                Axpy( -H(i,j), vi, w );
+                auto Vj = V( ALL, IR(0,j+1) );
+                auto hj = H( IR(0,j+1), IR(j) );
+                gmres::LocalInnerProducts( Vj, w, dots );
+
+                // u := inv(M) w and p := A u, from which z_{j+1} and
+                // A z_{j+1} follow from the Arnoldi coefficients
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                const bool lookahead = pipelined && j+1 < restart;
+                if( lookahead )
+                {
+                    u = w;
+                    precond( u );
+                    applyA( Field(1), u, Field(0), p );
+                }
+
+                delta =
+                  gmres::Project
+                  ( Vj, w, dots, hj, orthAlg == GMRES_CGS2, reduce );
+                if( lookahead && delta > Real(0) && limits::IsFinite(delta) )
+                {
+                    // z_{j+1} := (u - Z_j h_j) / delta
+                    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                    auto zjp1 = Z( ALL, IR(j+1) );
+                    Gemv
+                    ( NORMAL, Field(-1), Z(ALL,IR(0,j+1)), hj, Field(1), u );
+                    zjp1 = u;
+                    zjp1 *= 1/delta;
+
+                    // A z_{j+1} := (p - A Z_j h_j) / delta
+                    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                    auto Azjp1 = AZ( ALL, IR(j+1) );
+                    Gemv
+                    ( NORMAL, Field(-1), AZ(ALL,IR(0,j+1)), hj, Field(1), p );
+                    Azjp1 = p;
+                    Azjp1 *= 1/delta;
+                }
             }
-            const Real delta = Nrm2( w );
             if( !limits::IsFinite(delta) )
                 RuntimeError("Arnoldi step produced a non-finite number");
             if( delta == Real(0) )
@@ -298,7 +360,8 @@ Int FGMRES
         Base<Field> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GMRESOrthAlg orthAlg=GMRES_MGS )
 {
     EL_DEBUG_CSE
     Int mostIts = 0;
@@ -308,7 +371,8 @@ Int FGMRES
         auto b = B( ALL, IR(j) );
         const Int its =
           fgmres::Single
-          ( applyA, precond, b, relTol, restart, maxIts, progress );
+          ( applyA, precond, b, relTol, restart, maxIts, progress,
+            orthAlg );
         mostIts = Max(mostIts,its);
     }
     return mostIts;
@@ -325,7 +389,8 @@ Int Single
         Base<Field> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GMRESOrthAlg orthAlg=GMRES_MGS )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -341,6 +406,11 @@ Int Single
     const Int n = b.Height();
     const Grid& grid = b.Grid();
     const int commRank = grid.Rank();
+    const bool pipelined = ( orthAlg == GMRES_PIPELINED );
+    mpi::Comm comm = grid.Comm();
+    auto reduce =
+      [&]( Matrix<Field>& t )
+      { mpi::AllReduce( t.Buffer(), t.Height(), comm ); };
     Timer iterTimer;
 
     // x := 0
@@ -370,8 +440,11 @@ Int Single
     Int iter=0;
     bool converged = false;
     Matrix<Real> cs;
-    Matrix<Field> sn, H, t;
+    Matrix<Field> sn, H, t, dots;
     DistMultiVec<Field> x0(grid), q(grid), V(grid), Z(grid), AZ(grid);
+    DistMultiVec<Field> u(grid), p(grid);
+    if( pipelined )
+        Zeros( p, n, 1 );
     while( !converged )
     {
         if( progress && commRank == 0 )
@@ -389,7 +462,7 @@ Int Single
         Zeros( H,  restart, restart );
         Zeros( V, n, restart );
         Zeros( Z, n, restart );
-        if( saveProducts )
+        if( saveProducts || pipelined )
             Zeros( AZ, n, restart );
 
         // TODO: Extend DistMultiVec so that it can be directly manipulated
@@ -426,39 +499,100 @@ Int Single
                 iterTimer.Start();
             const Int innerIndent = PushIndent();
 
-            // z_j := inv(M) v_j
-            // =================
-            auto vjLoc = VLoc( ALL, IR(j) );
-            auto zjLoc = ZLoc( ALL, IR(j) );
-            q.Matrix() = vjLoc;
-            precond( q );
-            zjLoc = q.Matrix();
-
-            // w := A z_j
-            // ----------
-            // NOTE: q currently contains z_j
-            applyA( Field(1), q, Field(0), w );
-            if( saveProducts )
+            auto& AZLoc = AZ.Matrix();
+            if( pipelined && j > 0 )
+            {
+                // z_j and A z_j were formed during the previous step
+                // --------------------------------------------------
+                w.Matrix() = AZLoc( ALL, IR(j) );
+            }
+            else
             {
-                auto& AZLoc = AZ.Matrix();
-                auto AzjLoc = AZLoc( ALL, IR(j) );
-                AzjLoc = w.LockedMatrix();
+                // z_j := inv(M) v_j
+                // =================
+                auto vjLoc = VLoc( ALL, IR(j) );
+                auto zjLoc = ZLoc( ALL, IR(j) );
+                q.Matrix() = vjLoc;
+                precond( q );
+                zjLoc = q.Matrix();
+
+                // w := A z_j
+                // ----------
+                // NOTE: q currently contains z_j
+                applyA( Field(1), q, Field(0), w );
+                if( saveProducts || pipelined )
+                {
+                    auto AzjLoc = AZLoc( ALL, IR(j) );
+                    AzjLoc = w.LockedMatrix();
+                }
             }
 
             // Run the j'th step of Arnoldi
             // ----------------------------
-            for( Int i=0; i<=j; ++i )
+            Real delta;
+            if( orthAlg == GMRES_MGS )
+            {
+                for( Int i=0; i<=j; ++i )
+                {
+                    // H(i,j) := v_i' w
+                    // ^^^^^^^^^^^^^^^^
+                    q.Matrix() = VLoc( ALL, IR(i) );
+                    H(i,j) = Dot(q,w);
+
+                    // w := w - H(i,j) v_i
+                    // ^^^^^^^^^^^^^^^^^^^
+                    Axpy( -H(i,j), q, w );
+                }
+                delta = Nrm2( w );
+            }
+            else
             {
-                // H(i,j) := v_i' w
-                // ^^^^^^^^^^^^^^^^
-                q.Matrix() = VLoc( ALL, IR(i) );
-                H(i,j) = Dot(q,w);
-
-                // w := w - H(i,j) v_i
-                // ^^^^^^^^^^^^^^^^^^^
-                Axpy( -H(i,j), q, w );
+                // Start summing [V_j' w; w' w] over the team
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                auto VjLoc = VLoc( ALL, IR(0,j+1) );
+                auto hj = H( IR(0,j+1), IR(j) );
+                gmres::LocalInnerProducts( VjLoc, w.LockedMatrix(), dots );
+                mpi::Request<Field> request;
+                mpi::IAllReduce( dots.Buffer(), j+2, comm, request );
+
+                // u := inv(M) w and p := A u while the sum is in flight
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                const bool lookahead = pipelined && j+1 < restart;
+                if( lookahead )
+                {
+                    u = w;
+                    precond( u );
+                    applyA( Field(1), u, Field(0), p );
+                }
+                mpi::Wait( request );
+
+                delta =
+                  gmres::Project
+                  ( VjLoc, w.Matrix(), dots, hj, orthAlg == GMRES_CGS2,
+                    reduce );
+                if( lookahead && delta > Real(0) && limits::IsFinite(delta) )
+                {
+                    // z_{j+1} := (u - Z_j h_j) / delta
+                    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                    auto& uLoc = u.Matrix();
+                    auto zjp1Loc = ZLoc( ALL, IR(j+1) );
+                    Gemv
+                    ( NORMAL, Field(-1), ZLoc(ALL,IR(0,j+1)), hj,
+                      Field(1), uLoc );
+                    zjp1Loc = uLoc;
+                    zjp1Loc *= 1/delta;
+
+                    // A z_{j+1} := (p - A Z_j h_j) / delta
+                    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                    auto& pLoc = p.Matrix();
+                    auto Azjp1Loc = AZLoc( ALL, IR(j+1) );
+                    Gemv
+                    ( NORMAL, Field(-1), AZLoc(ALL,IR(0,j+1)), hj,
+                      Field(1), pLoc );
+                    Azjp1Loc = pLoc;
+                    Azjp1Loc *= 1/delta;
+                }
             }
-            const Real delta = Nrm2( w );
             if( !limits::IsFinite(delta) )
                 RuntimeError("Arnoldi step produced a non-finite number");
             if( delta == Real(0) )
@@ -594,7 +728,8 @@ Int FGMRES
         Base<Field> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GMRESOrthAlg orthAlg=GMRES_MGS )
 {
     EL_DEBUG_CSE
     const Int height = B.Height();
@@ -611,7 +746,8 @@ Int FGMRES
         uLoc = bLoc;
         const Int its =
           fgmres::Single
-          ( applyA, precond, u, relTol, restart, maxIts, progress );
+          ( applyA, precond, u, relTol, restart, maxIts, progress,
+            orthAlg );
         bLoc = uLoc;
         mostIts = Max(mostIts,its);
     }
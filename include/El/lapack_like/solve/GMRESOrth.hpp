@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_GMRESORTH_HPP
+#define EL_SOLVE_GMRESORTH_HPP
+
+// The classical Gram-Schmidt orthogonalizations used by FGMRES and LGMRES.
+// The reorthogonalization criterion is the "twice is enough" test discussed in
+//   Luc Giraud, Julien Langou, and Miroslav Rozloznik,
+//   "The loss of orthogonality in the Gram-Schmidt orthogonalization process",
+//   Computers & Mathematics with Applications, Vol. 50, pp. 1069--1075, 2005.
+// and the pipelined variant follows the p(1)-GMRES approach of
+//   Pieter Ghysels, Thomas J. Ashby, Karl Meerbergen, and Wim Vanroose,
+//   "Hiding global communication latency in the GMRES algorithm on massively
+//   parallel machines", SIAM J. Sci. Comput., Vol. 35, No. 1, 2013.
+
+namespace El {
+
+namespace gmres {
+
+// Form the local contributions to s := [V' w; w' w]
+template<typename Field>
+void LocalInnerProducts
+( const Matrix<Field>& V,
+  const Matrix<Field>& w,
+        Matrix<Field>& s )
+{
+    EL_DEBUG_CSE
+    const Int k = V.Width();
+    Zeros( s, k+1, 1 );
+    auto sT = s( IR(0,k), ALL );
+    Gemv( ADJOINT, Field(1), V, w, Field(0), sT );
+    s(k) = Dot( w, w );
+}
+
+// Given the (summed) s = [V' w; w' w], where V has orthonormal columns,
+// overwrite w with its projection onto the orthogonal complement of range(V),
+// add the projection coefficients into h, and return || w ||_2.
+//
+// The norm is recovered from s without an additional reduction unless the
+// projection removed at least half of the squared norm of w, in which case a
+// second pass is performed (as is always the case if 'reorthogonalize' is
+// true). The function 'reduce' should have the form
+//
+//   void reduce( Matrix<Field>& t )
+//
+// and sum t over the team which owns the rows of V and w.
+//
+template<typename Field,class ReduceType>
+Base<Field> Project
+( const Matrix<Field>& V,
+        Matrix<Field>& w,
+        Matrix<Field>& s,
+        Matrix<Field>& h,
+  bool reorthogonalize,
+  const ReduceType& reduce )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int k = V.Width();
+
+    Real normSq, newNormSq;
+    auto projectOnce =
+      [&]()
+      {
+          auto sT = s( IR(0,k), ALL );
+          Gemv( NORMAL, Field(-1), V, sT, Field(1), w );
+          Axpy( Field(1), sT, h );
+          const Real projNorm = Nrm2( sT );
+          normSq = RealPart(s(k));
+          newNormSq = normSq - projNorm*projNorm;
+      };
+
+    projectOnce();
+    if( reorthogonalize || 2*newNormSq <= normSq )
+    {
+        LocalInnerProducts( V, w, s );
+        reduce( s );
+        projectOnce();
+    }
+    if( 2*newNormSq > normSq )
+        return Sqrt( newNormSq );
+
+    // The result is (numerically) within range(V), so its norm must be formed
+    // explicitly
+    Matrix<Field> nu;
+    Zeros( nu, 1, 1 );
+    nu(0) = Dot( w, w );
+    reduce( nu );
+    return Sqrt( Max( RealPart(nu(0)), Real(0) ) );
+}
+
+} // namespace gmres
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_GMRESORTH_HPP
@@ -0,0 +1,162 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_KRYLOV_HPP
+#define EL_SOLVE_KRYLOV_HPP
+
+// Utilities shared by the CG, MINRES, BiCGStab, and block CG implementations,
+// which are written once for both Matrix and DistMultiVec by working with the
+// local portions of the (multi)vectors and explicitly summing inner products.
+//
+// As with FGMRES, 'applyA' should have the form
+//
+//   void applyA( Field alpha, const VecType& x, Field beta, VecType& y )
+//
+// and overwrite y := alpha A x + beta y, while 'precond' should have the form
+//
+//   void precond( VecType& b )
+//
+// and overwrite b with an approximation of inv(A) b, where VecType is either
+// Matrix<Field> or DistMultiVec<Field>. Besides JacobiPrecond and ILU0Precond,
+// a sparse-direct factorization of a nearby matrix can be used, e.g.,
+//
+//   auto precond = [&]( DistMultiVec<Field>& b ) { factorization.Solve(b); };
+//
+// Each solver begins from a zero initial guess, overwrites the right-hand
+// sides with the solutions, returns the number of iterations, and throws a
+// RuntimeError if the tolerance was not met within the maximum number of
+// iterations.
+
+namespace El {
+
+namespace krylov {
+
+template<typename Field>
+Matrix<Field>& Local( Matrix<Field>& A ) EL_NO_EXCEPT
+{ return A; }
+template<typename Field>
+const Matrix<Field>& Local( const Matrix<Field>& A ) EL_NO_EXCEPT
+{ return A; }
+template<typename Field>
+Matrix<Field>& Local( DistMultiVec<Field>& A ) EL_NO_EXCEPT
+{ return A.Matrix(); }
+template<typename Field>
+const Matrix<Field>& Local( const DistMultiVec<Field>& A ) EL_NO_EXCEPT
+{ return A.LockedMatrix(); }
+
+// Sums (contiguous) local contributions, e.g., to inner products, over the
+// team which owns the rows of a (multi)vector. If Start and Finish are
+// separated by other work, the communication is overlapped with said work
+// whenever non-blocking collectives are available.
+template<typename Field>
+class TeamSum
+{
+public:
+    explicit TeamSum( const Matrix<Field>& X ) { }
+    explicit TeamSum( const DistMultiVec<Field>& X )
+    : distributed_(true), comm_(X.Grid().Comm()) { }
+
+    void Start( Matrix<Field>& T )
+    {
+        EL_DEBUG_CSE
+        EL_DEBUG_ONLY(
+          if( T.LDim() != T.Height() && T.Width() > 1 )
+              LogicError("Expected a contiguous matrix of local sums");
+        )
+        if( distributed_ )
+        {
+            mpi::IAllReduce
+            ( T.Buffer(), T.Height()*T.Width(), comm_, request_ );
+            pending_ = true;
+        }
+    }
+
+    void Finish()
+    {
+        EL_DEBUG_CSE
+        if( pending_ )
+        {
+            mpi::Wait( request_ );
+            pending_ = false;
+        }
+    }
+
+    void operator()( Matrix<Field>& T )
+    {
+        Start( T );
+        Finish();
+    }
+
+private:
+    bool distributed_=false;
+    bool pending_=false;
+    mpi::Comm comm_;
+    mpi::Request<Field> request_;
+};
+
+// Run a single right-hand side solver on each column of B and return the
+// largest number of iterations
+template<typename Field,class SingleType>
+Int EachColumn( Matrix<Field>& B, const SingleType& single )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int width = B.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        mostIts = Max( mostIts, single(b) );
+    }
+    return mostIts;
+}
+
+template<typename Field,class SingleType>
+Int EachColumn( DistMultiVec<Field>& B, const SingleType& single )
+{
+    EL_DEBUG_CSE
+    const Int height = B.Height();
+    const Int width = B.Width();
+
+    Int mostIts = 0;
+    DistMultiVec<Field> u(B.Grid());
+    Zeros( u, height, 1 );
+    auto& BLoc = B.Matrix();
+    auto& uLoc = u.Matrix();
+    for( Int j=0; j<width; ++j )
+    {
+        auto bLoc = BLoc( ALL, IR(j) );
+        uLoc = bLoc;
+        mostIts = Max( mostIts, single(u) );
+        bLoc = uLoc;
+    }
+    return mostIts;
+}
+
+// Only the root of the team reports progress
+template<typename Field,typename... ArgPack>
+void Progress( const Matrix<Field>& X, const ArgPack&... args )
+{ Output( args... ); }
+template<typename Field,typename... ArgPack>
+void Progress( const DistMultiVec<Field>& X, const ArgPack&... args )
+{
+    if( X.Grid().Rank() == 0 )
+        Output( args... );
+}
+
+template<typename Real>
+void CheckFinite( Real value, const char* name )
+{
+    if( !limits::IsFinite(value) )
+        RuntimeError(name," was not finite");
+}
+
+} // namespace krylov
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_KRYLOV_HPP
@@ -27,6 +27,10 @@ namespace lgmres {
 //
 // and overwrite b with an approximation of inv(A) b.
 //
+// The Arnoldi process orthogonalizes with 'orthAlg' (see GMRESOrthAlg); the
+// pipelined variant forms inv(M) A v_{j+1} from inv(M) A applied to the
+// unorthogonalized vector, and so it assumes a linear preconditioner.
+//
 
 // TODO(poulson): Add support for an initial guess
 template<typename Field,class ApplyAType,class PrecondType>
@@ -37,7 +41,8 @@ Int Single
         Base<Field> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GMRESOrthAlg orthAlg=GMRES_MGS )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -46,6 +51,8 @@ Int Single
     )
     typedef Base<Field> Real;
     const Int n = b.Height();
+    const bool pipelined = ( orthAlg == GMRES_PIPELINED );
+    auto reduce = []( Matrix<Field>& ) { };
 
     // x := 0
     // ======
@@ -64,7 +71,9 @@ Int Single
     bool converged = false;
     Matrix<Real> cs;
     Matrix<Field> sn, H, t;
-    Matrix<Field> x0, q, V;
+    Matrix<Field> x0, q, V, W, dots, p;
+    if( pipelined )
+        Zeros( p, n, 1 );
     while( !converged )
     {
         if( progress )
@@ -75,6 +84,8 @@ Int Single
         Zeros( sn, restart, 1 );
         Zeros( H,  restart, restart );
         Zeros( V, n, restart );
+        if( pipelined )
+            Zeros( W, n, restart );
 
         // x0 := x
         // =======
@@ -107,28 +118,76 @@ Int Single
                 Output("Starting inner GMRES iteration ",j);
             const Int innerIndent = PushIndent();
 
-            // w := A v_j
-            // ----------
-            applyA( Field(1), V(ALL,IR(j)), Field(0), w );
-
-            // w := inv(M) w
-            // -------------
-            precond( w );
+            if( pipelined && j > 0 )
+            {
+                // inv(M) A v_j was formed during the previous step
+                // ------------------------------------------------
+                w = W( ALL, IR(j) );
+            }
+            else
+            {
+                // w := A v_j
+                // ----------
+                applyA( Field(1), V(ALL,IR(j)), Field(0), w );
+
+                // w := inv(M) w
+                // -------------
+                precond( w );
+                if( pipelined )
+                {
+                    auto wj = W( ALL, IR(j) );
+                    wj = w;
+                }
+            }
 
             // Run the j'th step of Arnoldi
             // ----------------------------
-            for( Int i=0; i<=j; ++i )
+            Real delta;
+            if( orthAlg == GMRES_MGS )
+            {
+                for( Int i=0; i<=j; ++i )
+                {
+                    // H(i,j) := v_i' w
+                    // ^^^^^^^^^^^^^^^^
+                    auto vi = V( ALL, IR(i) );
+                    H.Set( i, j, Dot(vi,w) );
+
+                    // w := w - H(i,j) v_i
+                    // ^^^^^^^^^^^^^^^^^^^
+                    Axpy( -H(i,j), vi, w );
+                }
+                delta = Nrm2( w );
+            }
+            else
             {
-                // H(i,j) := v_i' w
-                // ^^^^^^^^^^^^^^^^
-                auto vi = V( ALL, IR(i) );
-                H.Set( i, j, Dot(vi,w) );
-
-                // w := w - H(i,j) v_i
-                // ^^^^^^^^^^^^^^^^^^^
-                Axpy( -H(i,j), vi, w );
+                auto Vj = V( ALL, IR(0,j+1) );
+                auto hj = H( IR(0,j+1), IR(j) );
+                gmres::LocalInnerProducts( Vj, w, dots );
+
+                // p := inv(M) A w, from which inv(M) A v_{j+1} follows from
+                // the Arnoldi coefficients
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                const bool lookahead = pipelined && j+1 < restart;
+                if( lookahead )
+                {
+                    applyA( Field(1), w, Field(0), p );
+                    precond( p );
+                }
+
+                delta =
+                  gmres::Project
+                  ( Vj, w, dots, hj, orthAlg == GMRES_CGS2, reduce );
+                if( lookahead && delta > Real(0) && limits::IsFinite(delta) )
+                {
+                    // inv(M) A v_{j+1} := (p - W_j h_j) / delta
+                    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                    auto wjp1 = W( ALL, IR(j+1) );
+                    Gemv
+                    ( NORMAL, Field(-1), W(ALL,IR(0,j+1)), hj, Field(1), p );
+                    wjp1 = p;
+                    wjp1 *= 1/delta;
+                }
             }
-            const Real delta = Nrm2( w );
             if( !limits::IsFinite(delta) )
                 RuntimeError("Arnoldi step produced a non-finite number");
             if( delta == Real(0) )
@@ -246,7 +305,8 @@ Int LGMRES
         Base<Field> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GMRESOrthAlg orthAlg=GMRES_MGS )
 {
     EL_DEBUG_CSE
     Int mostIts = 0;
@@ -256,7 +316,8 @@ Int LGMRES
         auto b = B( ALL, IR(j) );
         const Int its =
           lgmres::Single
-          ( applyA, precond, b, relTol, restart, maxIts, progress );
+          ( applyA, precond, b, relTol, restart, maxIts, progress,
+            orthAlg );
         mostIts = Max(mostIts,its);
     }
     return mostIts;
@@ -273,7 +334,8 @@ Int Single
         Base<Field> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GMRESOrthAlg orthAlg=GMRES_MGS )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -284,6 +346,11 @@ Int Single
     const Int n = b.Height();
     const Grid& grid = b.Grid();
     const int commRank = grid.Rank();
+    const bool pipelined = ( orthAlg == GMRES_PIPELINED );
+    mpi::Comm comm = grid.Comm();
+    auto reduce =
+      [&]( Matrix<Field>& t )
+      { mpi::AllReduce( t.Buffer(), t.Height(), comm ); };
 
     // x := 0
     // ======
@@ -301,8 +368,10 @@ Int Single
     Int iter=0;
     bool converged = false;
     Matrix<Real> cs;
-    Matrix<Field> sn, H, t;
-    DistMultiVec<Field> x0(grid), q(grid), V(grid);
+    Matrix<Field> sn, H, t, dots;
+    DistMultiVec<Field> x0(grid), q(grid), V(grid), W(grid), p(grid);
+    if( pipelined )
+        Zeros( p, n, 1 );
     while( !converged )
     {
         if( progress && commRank == 0 )
@@ -313,10 +382,13 @@ Int Single
         Zeros( sn, restart, 1 );
         Zeros( H,  restart, restart );
         Zeros( V, n, restart );
+        if( pipelined )
+            Zeros( W, n, restart );
         // TODO: Extend DistMultiVec so that it can be directly manipulated
         //       rather than requiring access to the local Matrix and staging
         //       through the temporary vector q
         auto& VLoc = V.Matrix();
+        auto& WLoc = W.Matrix();
         Zeros( q, n, 1 );
 
         // x0 := x
@@ -350,29 +422,84 @@ Int Single
                 Output("Starting inner GMRES iteration ",j);
             const Int innerIndent = PushIndent();
 
-            // w := A v_j
-            // ----------
-            q.Matrix() = VLoc( ALL, IR(j) );
-            applyA( Field(1), q, Field(0), w );
-
-            // w := inv(M) w
-            // -------------
-            precond( w );
+            if( pipelined && j > 0 )
+            {
+                // inv(M) A v_j was formed during the previous step
+                // ------------------------------------------------
+                w.Matrix() = WLoc( ALL, IR(j) );
+            }
+            else
+            {
+                // w := A v_j
+                // ----------
+                q.Matrix() = VLoc( ALL, IR(j) );
+                applyA( Field(1), q, Field(0), w );
+
+                // w := inv(M) w
+                // -------------
+                precond( w );
+                if( pipelined )
+                {
+                    auto wjLoc = WLoc( ALL, IR(j) );
+                    wjLoc = w.LockedMatrix();
+                }
+            }
 
             // Run the j'th step of Arnoldi
             // ----------------------------
-            for( Int i=0; i<=j; ++i )
+            Real delta;
+            if( orthAlg == GMRES_MGS )
+            {
+                for( Int i=0; i<=j; ++i )
+                {
+                    // H(i,j) := v_i' w
+                    // ^^^^^^^^^^^^^^^^
+                    q.Matrix() = VLoc( ALL, IR(i) );
+                    H(i,j) = Dot(q,w);
+
+                    // w := w - H(i,j) v_i
+                    // ^^^^^^^^^^^^^^^^^^^
+                    Axpy( -H(i,j), q, w );
+                }
+                delta = Nrm2( w );
+            }
+            else
             {
-                // H(i,j) := v_i' w
-                // ^^^^^^^^^^^^^^^^
-                q.Matrix() = VLoc( ALL, IR(i) );
-                H(i,j) = Dot(q,w);
-
-                // w := w - H(i,j) v_i
-                // ^^^^^^^^^^^^^^^^^^^
-                Axpy( -H(i,j), q, w );
+                // Start summing [V_j' w; w' w] over the team
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                auto VjLoc = VLoc( ALL, IR(0,j+1) );
+                auto hj = H( IR(0,j+1), IR(j) );
+                gmres::LocalInnerProducts( VjLoc, w.LockedMatrix(), dots );
+                mpi::Request<Field> request;
+                mpi::IAllReduce( dots.Buffer(), j+2, comm, request );
+
+                // p := inv(M) A w while the sum is in flight
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                const bool lookahead = pipelined && j+1 < restart;
+                if( lookahead )
+                {
+                    applyA( Field(1), w, Field(0), p );
+                    precond( p );
+                }
+                mpi::Wait( request );
+
+                delta =
+                  gmres::Project
+                  ( VjLoc, w.Matrix(), dots, hj, orthAlg == GMRES_CGS2,
+                    reduce );
+                if( lookahead && delta > Real(0) && limits::IsFinite(delta) )
+                {
+                    // inv(M) A v_{j+1} := (p - W_j h_j) / delta
+                    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                    auto& pLoc = p.Matrix();
+                    auto wjp1Loc = WLoc( ALL, IR(j+1) );
+                    Gemv
+                    ( NORMAL, Field(-1), WLoc(ALL,IR(0,j+1)), hj,
+                      Field(1), pLoc );
+                    wjp1Loc = pLoc;
+                    wjp1Loc *= 1/delta;
+                }
             }
-            const Real delta = Nrm2( w );
             if( !limits::IsFinite(delta) )
                 RuntimeError("Arnoldi step produced a non-finite number");
             if( delta == Real(0) )
@@ -490,7 +617,8 @@ Int LGMRES
         Base<Field> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GMRESOrthAlg orthAlg=GMRES_MGS )
 {
     EL_DEBUG_CSE
     const Int height = B.Height();
@@ -507,7 +635,8 @@ Int LGMRES
         uLoc = bLoc;
         const Int its =
           lgmres::Single
-          ( applyA, precond, u, relTol, restart, maxIts, progress );
+          ( applyA, precond, u, relTol, restart, maxIts, progress,
+            orthAlg );
         bLoc = uLoc;
         mostIts = Max(mostIts,its);
     }
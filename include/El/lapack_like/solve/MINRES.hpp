@@ -0,0 +1,285 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_MINRES_HPP
+#define EL_SOLVE_MINRES_HPP
+
+// Preconditioned MINRES for Hermitian (possibly indefinite) A and Hermitian
+// Positive-Definite preconditioners, following
+//   Christopher C. Paige and Michael A. Saunders,
+//   "Solution of sparse indefinite systems of linear equations",
+//   SIAM J. Numer. Anal., Vol. 12, No. 4, pp. 617--629, 1975.
+//
+// The residual estimate is measured in the norm induced by the inverse of the
+// preconditioner, and convergence is declared once it has been reduced by a
+// factor of ctrl.relTol.
+//
+// The pipelined variant carries the recurrence A z_{k+1} = A inv(M) y_k -
+// alpha_k A v_k so that the two inner products of each Lanczos step,
+// alpha_k = v_k' y_k and y_k' inv(M) y_k, are summed together while A is
+// applied. The next Lanczos coefficient then follows from
+//
+//   beta_{k+1}^2 = y_k' inv(M) y_k - alpha_k^2,
+//
+// which is explicitly recomputed (with an additional reduction) whenever the
+// subtraction would lose more than half of the significant digits.
+
+namespace El {
+
+namespace minres {
+
+// See Krylov.hpp for the forms of 'applyA' and 'precond'
+template<typename Field,class VecType,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+  const KrylovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    using krylov::Local;
+    krylov::TeamSum<Field> sum( b );
+    Matrix<Field> sums;
+    const Real eps = limits::Epsilon<Real>();
+    const bool pipelined = ctrl.pipelined;
+
+    // x := 0, r1 := r2 := b, z := inv(M) r2
+    auto x = b;
+    Zero( Local(x) );
+    auto r1 = b;
+    auto r2 = b;
+    auto z = r2;
+    precond( z );
+
+    Zeros( sums, 1, 1 );
+    sums(0) = Dot( Local(r2), Local(z) );
+    sum( sums );
+    const Real beta1Sq = RealPart(sums(0));
+    if( beta1Sq < Real(0) )
+        RuntimeError("MINRES requires a positive-definite preconditioner");
+    const Real beta1 = Sqrt( beta1Sq );
+    if( ctrl.progress )
+        krylov::Progress( b, "origResidNorm: ",beta1 );
+    if( beta1 == Real(0) )
+        return 0;
+
+    // Az := A z is only maintained by the pipelined variant
+    auto v = x, y = x, w = x, w1 = x, w2 = x;
+    auto Az = x, Av = x, My = x, t = x;
+    if( pipelined )
+        applyA( Field(1), z, Field(0), Az );
+
+    // The recurrences for z and A z amplify their rounding errors by up to
+    // |alpha|/beta in each step, and so they are explicitly recomputed once
+    // the accumulated amplification exceeds eps^(-1/4)
+    const Real maxGrowth = Real(1)/Sqrt(Sqrt(eps));
+    Real growth = 1;
+
+    Real beta=beta1, oldBeta=0;
+    Real cs=-1, sn=0, dbar=0, epsln=0, phibar=beta1;
+    Int iter = 0;
+    while( true )
+    {
+        // The Lanczos step
+        // ================
+        Real alpha;
+        // v := z / beta
+        v = z;
+        Scale( Field(1/beta), Local(v) );
+        if( pipelined )
+        {
+            // y := A v - (beta/oldBeta) r1, where A v = (A z) / beta
+            Av = Az;
+            Scale( Field(1/beta), Local(Av) );
+            y = Av;
+            if( iter > 0 )
+                Axpy( Field(-beta/oldBeta), Local(r1), Local(y) );
+            My = y;
+            precond( My );
+
+            // Start summing alpha := v' y and y' inv(M) y and form
+            // t := A inv(M) y
+            Zeros( sums, 2, 1 );
+            sums(0) = Dot( Local(v), Local(y) );
+            sums(1) = Dot( Local(y), Local(My) );
+            sum.Start( sums );
+            applyA( Field(1), My, Field(0), t );
+            sum.Finish();
+            alpha = RealPart(sums(0));
+            const Real yMy = RealPart(sums(1));
+
+            // r1 := r2, r2 := y - (alpha/beta) r1,
+            // z := inv(M) y - alpha v, Az := t - alpha A v
+            r1 = r2;
+            r2 = y;
+            Axpy( Field(-alpha/beta), Local(r1), Local(r2) );
+            growth *= Max( Abs(alpha)/beta, Real(1) );
+            const bool replace = ( growth > maxGrowth );
+            if( replace )
+            {
+                z = r2;
+                precond( z );
+                applyA( Field(1), z, Field(0), Az );
+                growth = 1;
+            }
+            else
+            {
+                z = My;
+                Axpy( Field(-alpha), Local(v), Local(z) );
+                Az = t;
+                Axpy( Field(-alpha), Local(Av), Local(Az) );
+            }
+
+            Real betaSq = yMy - alpha*alpha;
+            if( replace || betaSq <= Sqrt(eps)*yMy )
+            {
+                Zeros( sums, 1, 1 );
+                sums(0) = Dot( Local(r2), Local(z) );
+                sum( sums );
+                betaSq = RealPart(sums(0));
+            }
+            if( betaSq < Real(0) )
+                RuntimeError
+                ("MINRES requires a positive-definite preconditioner");
+            oldBeta = beta;
+            beta = Sqrt( betaSq );
+        }
+        else
+        {
+            // y := A v - (beta/oldBeta) r1
+            applyA( Field(1), v, Field(0), y );
+            if( iter > 0 )
+                Axpy( Field(-beta/oldBeta), Local(r1), Local(y) );
+
+            // alpha := v' y
+            Zeros( sums, 1, 1 );
+            sums(0) = Dot( Local(v), Local(y) );
+            sum( sums );
+            alpha = RealPart(sums(0));
+
+            // r1 := r2, r2 := y - (alpha/beta) r1, z := inv(M) r2
+            Axpy( Field(-alpha/beta), Local(r2), Local(y) );
+            r1 = r2;
+            r2 = y;
+            z = r2;
+            precond( z );
+
+            Zeros( sums, 1, 1 );
+            sums(0) = Dot( Local(r2), Local(z) );
+            sum( sums );
+            const Real betaSq = RealPart(sums(0));
+            if( betaSq < Real(0) )
+                RuntimeError
+                ("MINRES requires a positive-definite preconditioner");
+            oldBeta = beta;
+            beta = Sqrt( betaSq );
+        }
+        krylov::CheckFinite( alpha, "MINRES Lanczos coefficient" );
+        ++iter;
+
+        // Update the QR factorization of the tridiagonal matrix
+        // =====================================================
+        const Real oldEpsln = epsln;
+        const Real delta = cs*dbar + sn*alpha;
+        const Real gbar = sn*dbar - cs*alpha;
+        epsln = sn*beta;
+        dbar = -cs*beta;
+        const Real gamma = Max( SafeNorm( gbar, beta ), eps );
+        cs = gbar / gamma;
+        sn = beta / gamma;
+        const Real phi = cs*phibar;
+        phibar = sn*phibar;
+
+        // w := (v - oldEpsln w1 - delta w2) / gamma, x := x + phi w
+        // =========================================================
+        w1 = w2;
+        w2 = w;
+        w = v;
+        Axpy( Field(-oldEpsln), Local(w1), Local(w) );
+        Axpy( Field(-delta), Local(w2), Local(w) );
+        Scale( Field(1/gamma), Local(w) );
+        Axpy( Field(phi), Local(w), Local(x) );
+
+        const Real relResidNorm = phibar / beta1;
+        if( ctrl.progress )
+            krylov::Progress
+            ( b, "iteration ",iter,": relative residual estimate ",
+              relResidNorm );
+        if( relResidNorm < ctrl.relTol || beta == Real(0) )
+            break;
+        if( iter == ctrl.maxIts )
+            RuntimeError("MINRES did not converge");
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace minres
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int MINRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    return krylov::EachColumn
+    ( B,
+      [&]( Matrix<Field>& b )
+      { return minres::Single<Field>( applyA, precond, b, ctrl ); } );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int MINRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    return krylov::EachColumn
+    ( B,
+      [&]( DistMultiVec<Field>& b )
+      { return minres::Single<Field>( applyA, precond, b, ctrl ); } );
+}
+
+template<typename Field,class PrecondType>
+Int MINRES
+( const SparseMatrix<Field>& A,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X,
+           Field beta,        Matrix<Field>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+    return MINRES( applyA, precond, B, ctrl );
+}
+
+template<typename Field,class PrecondType>
+Int MINRES
+( const DistSparseMatrix<Field>& A,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+    return MINRES( applyA, precond, B, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_MINRES_HPP
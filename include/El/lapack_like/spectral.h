@@ -1045,6 +1045,8 @@ typedef struct {
   ElInt basisSize;
   bool reorthog;
 
+  ElInt shiftGroupSize;
+
   bool progress;
 
   ElSnapshotCtrl snapCtrl;
@@ -1070,6 +1072,8 @@ typedef struct {
   ElInt basisSize;
   bool reorthog;
 
+  ElInt shiftGroupSize;
+
   bool progress;
 
   ElSnapshotCtrl snapCtrl;
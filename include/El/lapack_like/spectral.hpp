@@ -415,6 +415,10 @@ struct HermitianEigCtrl
     HermitianSDCCtrl<Base<Field>> sdcCtrl;
     bool useScaLAPACK=false;
     bool useSDC=false;
+    // Use the QDWH-based spectral divide and conquer algorithm (QDWH-eig) of
+    // Nakatsukasa and Higham, with the cutoff, tolerance, and iteration
+    // limits taken from 'sdcCtrl'
+    bool useQDWH=false;
     bool timeStages=false;
 };
 
@@ -482,6 +486,28 @@ void TwoByTwo
 
 } // namespace herm_eig
 
+// Batched Hermitian eigensolvers
+// ------------------------------
+// Compute the eigenvalues (in ascending order), and optionally the
+// eigenvectors, of every member of a batch of small Hermitian matrices using
+// cyclic Jacobi sweeps which are vectorized across the batch. The input
+// matrices are overwritten and w is resized to n x 1 x batchSize.
+namespace batched {
+
+template<typename Field>
+void HermitianEig
+( UpperOrLower uplo,
+  BatchMatrix<Field>& A,
+  BatchMatrix<Base<Field>>& w );
+template<typename Field>
+void HermitianEig
+( UpperOrLower uplo,
+  BatchMatrix<Field>& A,
+  BatchMatrix<Base<Field>>& w,
+  BatchMatrix<Field>& Q );
+
+} // namespace batched
+
 // Skew-Hermitian eigenvalue solvers
 // =================================
 // Compute the full set of eigenvalues
@@ -755,6 +781,10 @@ struct HessenbergSchurCtrl
     function<Int(Int)> sufficientDeflation =
       function<Int(Int)>(hess_schur::aed::SufficientDeflation);
 
+    // If true, the AED window size is adapted to the measured deflation rate
+    // rather than fixed at the 'deflationSize' recommendation
+    bool adaptiveAED=false;
+
     // For the distributed Hessenberg QR algorithm
     // TODO(poulson): Move this into a substructure?
     bool scalapack=false;
@@ -763,6 +793,10 @@ struct HessenbergSchurCtrl
     // the distributed multibulge algorithm.
     function<Int(Int)> numBulgesPerBlock =
       function<Int(Int)>(hess_schur::multibulge::NumBulgesPerBlock);
+    // If true, the AED of each iteration is overlapped with a multibulge sweep
+    // (using the shifts from the previous AED) over the portion of the window
+    // above the deflation window
+    bool concurrentAED=false;
 };
 
 template<typename Field>
@@ -1238,6 +1272,14 @@ struct SVDCtrl
     double fullChanRatio=1.5;
 
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
+
+    // QDWH-SVD
+    // --------
+
+    // Compute thin SVDs from a QDWH polar decomposition, A = U_p H, followed
+    // by a QDWH-eig decomposition of H = V S V^H, so that U = U_p V
+    bool useQDWH=false;
+    HermitianSDCCtrl<Real> qdwhEigCtrl;
 };
 
 // Compute the singular values
@@ -1357,6 +1399,65 @@ SVDInfo TSQR
 
 } // namespace svd
 
+// Randomized SVD
+// ==============
+// Approximations of the dominant singular triplets via the randomized range
+// finder of
+//   Nathan Halko, Per-Gunnar Martinsson, and Joel A. Tropp,
+//   "Finding structure with randomness: Probabilistic algorithms for
+//   constructing approximate matrix decompositions",
+//   SIAM Review, Vol. 53, No. 2, pp. 217--288, 2011.
+// The range of A is sampled with rank+oversample Gaussian vectors and then
+// refined with power iterations, and the resulting tall-skinny matrices are
+// orthonormalized with TSQR whenever the process count and shapes allow it.
+
+struct RandomizedSVDCtrl
+{
+    // The number of additional sample vectors beyond the requested rank
+    Int oversample=10;
+
+    // The number of applications of A A^H, each of which is preceded by an
+    // orthonormalization so that the small singular values are preserved
+    Int numPowerIts=1;
+
+    // If positive, A is only accessed in column panels of this width, which
+    // bounds the size of the redistributed portions of A held at any time
+    Int panelWidth=0;
+};
+
+// Return an m x numVecs matrix with orthonormal columns approximately
+// spanning the dominant portion of the range of A
+template<typename Field>
+void RangeFinder
+( const Matrix<Field>& A,
+        Int numVecs,
+        Matrix<Field>& Q,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+template<typename Field>
+void RangeFinder
+( const AbstractDistMatrix<Field>& A,
+        Int numVecs,
+        AbstractDistMatrix<Field>& Q,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+
+// Return approximations of the 'rank' dominant singular triplets of A
+template<typename Field>
+SVDInfo RandomizedSVD
+( const Matrix<Field>& A,
+        Int rank,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+template<typename Field>
+SVDInfo RandomizedSVD
+( const AbstractDistMatrix<Field>& A,
+        Int rank,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+
 // Hermitian SVD
 // =============
 
@@ -1606,6 +1707,11 @@ struct PseudospecCtrl
     Int basisSize=10;
     bool reorthog=true; // only matters for IRL, which isn't currently used
 
+    // If positive, the sequential routines split the shifts into groups of
+    // (at most) this many and dynamically schedule the groups over the loop
+    // threads so that the slowest shifts do not hold back the rest
+    Int shiftGroupSize=0;
+
     // Whether or not to print progress information at each iteration
     bool progress=false;
 
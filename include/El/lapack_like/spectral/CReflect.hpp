@@ -964,6 +964,7 @@ inline ElPseudospecCtrl_s CReflect( const PseudospecCtrl<float>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.shiftGroupSize = ctrl.shiftGroupSize;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -983,6 +984,7 @@ inline ElPseudospecCtrl_d CReflect( const PseudospecCtrl<double>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.shiftGroupSize = ctrl.shiftGroupSize;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -1003,6 +1005,7 @@ inline PseudospecCtrl<float> CReflect( const ElPseudospecCtrl_s& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.shiftGroupSize = ctrlC.shiftGroupSize;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
@@ -1022,6 +1025,7 @@ inline PseudospecCtrl<double> CReflect( const ElPseudospecCtrl_d& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.shiftGroupSize = ctrlC.shiftGroupSize;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
@@ -13,6 +13,12 @@ namespace El {
 
 // Graph reordering
 // ================
+enum BisectEngine
+{
+  METIS_BISECT,     // (Par)METIS vertex separators
+  MULTILEVEL_BISECT // Built-in multilevel vertex separators
+};
+
 struct BisectCtrl
 {
     bool sequential;
@@ -21,9 +27,42 @@ struct BisectCtrl
     Int cutoff;
     bool storeFactRecvInds;
 
+    // The following only apply to MULTILEVEL_BISECT, which coarsens with
+    // heavy-edge matchings until there are at most 'coarsestSize' vertices
+    // (per process in the distributed case), computes 'numSeqSeps' initial
+    // separators on each process, and refines the best one with up to
+    // 'numRefineSweeps' Fiduccia-Mattheyses sweeps per level while keeping
+    // each half within a factor of 'imbalance' of an even split
+    BisectEngine engine;
+    Int coarsestSize;
+    Int numRefineSweeps;
+    double imbalance;
+
+    // If nonempty, NestedDissection stores its orderings in this directory,
+    // keyed by a hash of the graph, the number of processes, and the above
+    // parameters, and reuses them (skipping the bisections) when the same
+    // graph is reordered again
+    string cacheDir;
+
+    // If 'amalgamate' is true, NestedDissection relaxes the sequential
+    // subtrees of the separator tree by merging each separator into its
+    // parent whenever the merged front has at most 'amalgamationSize'
+    // indices or at most 'amalgamationTol' of the entries of its lower
+    // trapezoid are explicit zeros
+    bool amalgamate;
+    double amalgamationTol;
+    Int amalgamationSize;
+
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false),
+#ifdef EL_HAVE_METIS
+      engine(METIS_BISECT),
+#else
+      engine(MULTILEVEL_BISECT),
+#endif
+      coarsestSize(128), numRefineSweeps(4), imbalance(1.1),
+      amalgamate(false), amalgamationTol(0.1), amalgamationSize(16)
     { }
 };
 
@@ -72,6 +111,61 @@ Int NaturalBisect
   DistMap& perm,
   bool& onLeft );
 
+// Bisections computed by the built-in multilevel vertex separator engine
+Int MultilevelBisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& perm,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// NOTE: for two or more processes
+Int MultilevelBisect
+( const DistGraph& graph,
+        unique_ptr<Grid>& childGrid,
+        DistGraph& child,
+        DistMap& perm,
+        bool& onLeft,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+namespace multilevel {
+
+// An undirected graph (without self-connections) with vertex and edge weights,
+// as coarsened by the built-in multilevel engine. In the distributed case,
+// each process stores the connections of the vertices in
+// [firstLocal,firstLocal+numLocal) in terms of global indices.
+struct WeightedGraph
+{
+    Int numVertices=0;
+    Int firstLocal=0;
+    Int numLocal=0;
+    vector<Int> offsets, targets, edgeWeights, vertexWeights;
+};
+
+// Contract a sequential graph by mapping each vertex v to the coarse vertex
+// coarseMap[v] in [0,numCoarse), summing the weights of the merged vertices
+// and of the merged edges and dropping the edges within each coarse vertex
+void Contract
+( const WeightedGraph& graph,
+  const vector<Int>& coarseMap,
+        Int numCoarse,
+        WeightedGraph& coarse );
+
+// A single level of the distributed coarsening of MultilevelBisect, where
+// process q owns the vertices in [vtxDist[q],vtxDist[q+1]). The coarse index
+// of each local vertex is returned in 'coarseMap', and the targets of each
+// local coarse vertex are sorted.
+void Coarsen
+( const WeightedGraph& graph,
+  const vector<Int>& vtxDist,
+        WeightedGraph& coarse,
+        vector<Int>& coarseVtxDist,
+        vector<Int>& coarseMap,
+        Int seed,
+        mpi::Comm comm );
+
+} // namespace multilevel
+
 void EnsurePermutation( const vector<Int>& map );
 void EnsurePermutation( const DistMap& map );
 
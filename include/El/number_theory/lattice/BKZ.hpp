@@ -66,6 +66,12 @@ struct BKZCtrl
     // contiguous window of vectors
     Int multiEnumWindow=15;
 
+    // If greater than one, each tour instead enumerates up to this many
+    // non-overlapping windows at once (over the loop threads) and merges the
+    // improved windows, in order, with a single LLL pass. The sub-BKZ options
+    // are ignored by these parallel tours.
+    Int numConcurrentWindows=1;
+
     bool skipInitialLLL=false;
     bool jumpstart=false;
     Int startCol=0;
@@ -126,6 +132,7 @@ struct BKZCtrl
         enumTypeFunc = ctrl.enumTypeFunc;
 
         multiEnumWindow = ctrl.multiEnumWindow;
+        numConcurrentWindows = ctrl.numConcurrentWindows;
 
         skipInitialLLL = ctrl.skipInitialLLL;
         jumpstart = ctrl.jumpstart;
@@ -415,6 +422,268 @@ bool TryLowerPrecisionBigFloat
 }
 #endif
 
+// Run BKZ tours in which up to ctrl.numConcurrentWindows non-overlapping
+// windows are enumerated simultaneously by the loop threads. Each tour is
+// split into 'blocksize' stages, with stage 'offset' handling the windows
+// beginning at offset, offset+blocksize, offset+2 blocksize, etc. The vectors
+// found by a group of concurrent enumerations are always merged in order of
+// increasing window index, followed by a single jumpstarted LLL pass
+// beginning from the first modified window, so that the result does not depend
+// upon the number of threads. Unlike in the sequential tours, the next window
+// need not begin before the end of the previous LLL pass, and so each pass
+// extends over all of the (nonzero) columns in order to keep the entire
+// factorization consistent with B.
+//
+// The tours terminate once an entire tour fails to modify the basis (or after
+// ctrl.numEnumsBeforeAbort enumerations if ctrl.earlyAbort is true).
+//
+// The (already opened) log files are written in the same format as by the
+// sequential tours, with the enumerations of each group logged in order of
+// increasing window index.
+template<typename F>
+void ParallelTours
+( Matrix<F>& B,
+  Matrix<F>* U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  Int rank,
+  const BKZCtrl<Base<F>>& ctrl,
+  ofstream& failedEnumFile,
+  ofstream& streakSizesFile,
+  ofstream& normsFile,
+  ofstream& projNormsFile,
+  ofstream& nontrivialCoordsFile,
+  Int& numSwaps,
+  Int& numEnums,
+  Int& numEnumFailures )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    const Int stride = ctrl.blocksize;
+    const Int maxConcurrent = Max(ctrl.numConcurrentWindows,Int(1));
+
+    auto enumCtrl = ctrl.enumCtrl;
+    enumCtrl.disablePrecDrop = true;
+    enumCtrl.time = false;
+    enumCtrl.progress = false;
+    enumCtrl.innerProgress = false;
+    // The randomized enumerations draw from the (non-thread-safe) global
+    // generator and must therefore be run one at a time
+    const bool randomized =
+      ( enumCtrl.enumType == GNR_ENUM && enumCtrl.numTrials > 1 ) ||
+      ( enumCtrl.enumType == YSPARSE_ENUM && enumCtrl.enqueueProb < 1. );
+    const bool concurrent = !randomized && !ctrl.variableEnumType;
+
+    ThreadingCtrl threadingCtrl;
+    threadingCtrl.numBlasThreads = 1;
+
+    // The number of consecutive trivial enumerations
+    Int z = 0;
+    Int tour = 0;
+    vector<Int> windowBegs, windowEnds;
+    vector<bool> keptMins;
+    vector<std::pair<Real,Int>> minPairs;
+    vector<Real> oldProjNorms;
+    vector<Matrix<F>> windowVs;
+    while( true )
+    {
+        bool tourChanged = false;
+        if( ctrl.checkpoint )
+        {
+            Write( B, ctrl.checkpointFileBase, ctrl.checkpointFormat, "B" );
+            Write( B, ctrl.tourFileBase, ctrl.checkpointFormat, "B" );
+        }
+        if( ctrl.logNorms )
+        {
+            for( Int j=0; j<n; ++j )
+                normsFile << FrobeniusNorm(B(ALL,IR(j))) << " ";
+            normsFile << endl;
+        }
+        if( ctrl.logProjNorms )
+        {
+            for( Int j=0; j<n; ++j )
+                projNormsFile << RealPart(QR(j,j)) << " ";
+            projNormsFile << endl;
+        }
+        for( Int offset=0; offset<Min(stride,rank-1); ++offset )
+        {
+            // Form the non-overlapping windows of this stage, truncating each
+            // window (if necessary) to end before the next one begins
+            windowBegs.resize( 0 );
+            windowEnds.resize( 0 );
+            for( Int j=offset; j<rank-1; j+=stride )
+            {
+                Int bsize = ctrl.blocksize;
+                if( ctrl.variableBlocksize )
+                    bsize = ctrl.blocksizeFunc(j);
+                windowBegs.push_back( j );
+                windowEnds.push_back( Min(j+Min(bsize,stride)-1,rank-1) );
+            }
+            const Int numWindows = windowBegs.size();
+
+            for( Int groupBeg=0; groupBeg<numWindows; groupBeg+=maxConcurrent )
+            {
+                const Int groupEnd = Min(groupBeg+maxConcurrent,numWindows);
+                const Int groupSize = groupEnd - groupBeg;
+                keptMins.assign( groupSize, false );
+                minPairs.resize( groupSize );
+                oldProjNorms.resize( groupSize );
+                windowVs.resize( groupSize );
+
+                // Each enumeration (and enrichment) only reads the diagonal
+                // block of QR for its window and only modifies the columns of
+                // B (and U) within its window
+                if( ctrl.time )
+                    bkz::enumTimer.Start();
+                PushThreadingCtrl( threadingCtrl );
+#ifdef EL_HYBRID
+                #pragma omp parallel for schedule(dynamic,1) \
+                  num_threads(NumLoopThreads()) if(concurrent)
+#endif
+                for( Int w=groupBeg; w<groupEnd; ++w )
+                {
+                    const Range<Int> enumInd(windowBegs[w],windowEnds[w]+1);
+                    auto BEnum = B( ALL, enumInd );
+                    auto QREnum = QR( enumInd, enumInd );
+                    auto enumCtrlWindow( enumCtrl );
+                    if( ctrl.variableEnumType )
+                        enumCtrlWindow.enumType =
+                          ctrl.enumTypeFunc(windowBegs[w]);
+
+                    const Int windowSize = enumInd.end - enumInd.beg;
+                    const Range<Int>
+                      multiInd(0,Min(ctrl.multiEnumWindow,windowSize));
+                    auto normUpperBounds =
+                      GetRealPartOfDiagonal(QREnum(multiInd,multiInd));
+                    Scale
+                    ( Min(Sqrt(ctrl.lllCtrl.delta),Real(1)), normUpperBounds );
+
+                    Matrix<F>& v = windowVs[w-groupBeg];
+                    std::pair<Real,Int> minPair;
+                    if( U == nullptr )
+                    {
+                        minPair = MultiShortestVectorEnrichment
+                          ( BEnum, QREnum, normUpperBounds, v,
+                            enumCtrlWindow );
+                    }
+                    else
+                    {
+                        auto UEnum = (*U)( ALL, enumInd );
+                        minPair = MultiShortestVectorEnrichment
+                          ( BEnum, UEnum, QREnum, normUpperBounds, v,
+                            enumCtrlWindow );
+                    }
+                    const Int insertionInd = minPair.second;
+                    minPairs[w-groupBeg] = minPair;
+                    oldProjNorms[w-groupBeg] =
+                      RealPart(QREnum(insertionInd,insertionInd));
+                    keptMins[w-groupBeg] =
+                      ( minPair.first < oldProjNorms[w-groupBeg] );
+                }
+                PopThreadingCtrl();
+                if( ctrl.time )
+                    Output
+                    ("Enum/enrich time for ",groupSize," windows: ",
+                     bkz::enumTimer.Stop()," seconds");
+                numEnums += groupSize;
+
+                // Merge the results in order of increasing window index
+                Int startCol = -1;
+                for( Int w=groupBeg; w<groupEnd; ++w )
+                {
+                    const Int windowSize = windowEnds[w]+1-windowBegs[w];
+                    if( !keptMins[w-groupBeg] )
+                    {
+                        if( ctrl.progress )
+                            Output
+                            ("Trivial enumeration for window of size ",
+                             windowSize," with j=",windowBegs[w],", z=",z,
+                             " in tour ",tour);
+                        ++z;
+                        continue;
+                    }
+                    const Matrix<F>& v = windowVs[w-groupBeg];
+                    if( ctrl.progress )
+                    {
+                        const Real minProjNorm = minPairs[w-groupBeg].first;
+                        const Real oldProjNorm = oldProjNorms[w-groupBeg];
+                        Output
+                        ("Nontrivial enumeration for window of size ",
+                         windowSize," with j=",windowBegs[w],", z=",z,
+                         " in tour ",tour);
+                        Print( v, "v" );
+                        Output
+                        ("insertion index: ",minPairs[w-groupBeg].second);
+                        Output
+                        ("oldProjNorm=",oldProjNorm,
+                         ", minProjNorm=",minProjNorm,
+                         ", oldProjNorm-minProjNorm=",
+                         oldProjNorm-minProjNorm);
+                    }
+                    ++numEnumFailures;
+                    if( ctrl.logFailedEnums )
+                        failedEnumFile << windowBegs[w] << endl;
+                    if( ctrl.logStreakSizes )
+                        streakSizesFile << z << endl;
+                    if( ctrl.logNontrivialCoords )
+                    {
+                        for( Int e=0; e<v.Height(); ++e )
+                            nontrivialCoordsFile << v(e) << " ";
+                        nontrivialCoordsFile << endl;
+                    }
+                    z = 0;
+                    if( startCol == -1 )
+                        startCol = windowBegs[w];
+                }
+                if( startCol == -1 )
+                    continue;
+                tourChanged = true;
+
+                const Int h = rank-1;
+                const Range<Int> subInd(0,h+1);
+                auto BSub = B( ALL, subInd );
+                auto QRSub = QR( ALL, subInd );
+                auto tSub = t( subInd, ALL );
+                auto dSub = d( subInd, ALL );
+                LLLCtrl<Real> subLLLCtrl( ctrl.lllCtrl );
+                subLLLCtrl.jumpstart = true;
+                subLLLCtrl.startCol = startCol;
+                subLLLCtrl.recursive = false;
+                if( ctrl.time )
+                    bkz::bkzTimer.Start();
+                LLLInfo<Real> lllInfo;
+                if( U == nullptr )
+                {
+                    lllInfo = LLLWithQ( BSub, QRSub, tSub, dSub, subLLLCtrl );
+                }
+                else
+                {
+                    Matrix<F> W;
+                    Identity( W, h+1, h+1 );
+                    lllInfo =
+                      LLLWithQ( BSub, W, QRSub, tSub, dSub, subLLLCtrl );
+                    auto USub = (*U)( ALL, subInd );
+                    auto USubCopy( USub );
+                    Gemm( NORMAL, NORMAL, F(1), USubCopy, W, USub );
+                }
+                if( ctrl.time )
+                    Output("Merge LLL time: ",bkz::bkzTimer.Stop()," seconds");
+                numSwaps += lllInfo.numSwaps;
+            }
+        }
+        ++tour;
+        if( ctrl.progress )
+            Output
+            ("Finished parallel tour ",tour," after ",numEnums," enumerations");
+        if( !tourChanged )
+            break;
+        if( ctrl.earlyAbort && numEnums >= ctrl.numEnumsBeforeAbort )
+            break;
+    }
+}
+
 } // namespace bkz
 
 template<typename F>
@@ -558,6 +827,17 @@ BKZInfo<Base<F>> BKZWithQ
     Int z=0;
     Int j = ( ctrl.jumpstart ? ctrl.startCol : 0 ) - 1;
     Int numEnums=0, numEnumFailures=0;
+    if( ctrl.numConcurrentWindows > 1 )
+    {
+        // The parallel tours only return once an entire tour left the basis
+        // unchanged (or after an early abort)
+        bkz::ParallelTours
+        ( B, &U, QR, t, d, rank, ctrl,
+          failedEnumFile, streakSizesFile, normsFile, projNormsFile,
+          nontrivialCoordsFile,
+          numSwaps, numEnums, numEnumFailures );
+        z = rank-1;
+    }
     const Int indent = PushIndent(); 
     while( z < rank-1 ) 
     {
@@ -920,6 +1200,17 @@ BKZInfo<Base<F>> BKZWithQ
     Int z=0;
     Int j = ( ctrl.jumpstart ? ctrl.startCol : 0 ) - 1;
     Int numEnums=0, numEnumFailures=0;
+    if( ctrl.numConcurrentWindows > 1 )
+    {
+        // The parallel tours only return once an entire tour left the basis
+        // unchanged (or after an early abort)
+        bkz::ParallelTours
+        ( B, static_cast<Matrix<F>*>(nullptr), QR, t, d, rank, ctrl,
+          failedEnumFile, streakSizesFile, normsFile, projNormsFile,
+          nontrivialCoordsFile,
+          numSwaps, numEnums, numEnumFailures );
+        z = rank-1;
+    }
     const Int indent = PushIndent(); 
     while( z < rank-1 ) 
     {
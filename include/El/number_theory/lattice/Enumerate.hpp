@@ -34,6 +34,15 @@ struct EnumCtrl
     // Explicitly transpose 'N' to encourage unit-stride access
     bool explicitTranspose=true;
 
+    // FULL_ENUM and GNR_ENUM
+    // ----------------------
+    // If positive, the enumeration tree is split into the subtrees rooted at
+    // the (partial) coordinate vectors of length 'parallelDepth', which are
+    // then searched by the loop threads. The threads share the best norm found
+    // so far in order to prune, and so the returned vector is the shortest
+    // (rather than the first) one satisfying the bounds.
+    Int parallelDepth=0;
+
     // GNR_ENUM
     // --------
     // TODO: Add ability to further tune the bounding function
@@ -72,6 +81,7 @@ struct EnumCtrl
         progress = ctrl.progress;
         innerProgress = ctrl.innerProgress;
         explicitTranspose = ctrl.explicitTranspose;
+        parallelDepth = ctrl.parallelDepth;
 
         // GNR_ENUM
         // --------
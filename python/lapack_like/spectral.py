@@ -548,7 +548,10 @@ class SignCtrl_s(ctypes.Structure):
   _fields_ = [("maxIts",iType),
               ("tol",sType),
               ("power",sType),
-              ("scaling",c_uint)]
+              ("scaling",c_uint),
+              ("newtonSchulz",bType),
+              ("newtonSchulzTol",sType),
+              ("progress",bType)]
   def __init__(self):
     lib.ElSignCtrlDefault_s(pointer(self))
 
@@ -557,7 +560,10 @@ class SignCtrl_d(ctypes.Structure):
   _fields_ = [("maxIts",iType),
               ("tol",dType),
               ("power",dType),
-              ("scaling",c_uint)]
+              ("scaling",c_uint),
+              ("newtonSchulz",bType),
+              ("newtonSchulzTol",dType),
+              ("progress",bType)]
   def __init__(self):
     lib.ElSignCtrlDefault_d(pointer(self))
 
@@ -1137,6 +1143,7 @@ class PseudospecCtrl_s(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("shiftGroupSize",iType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl),
               ("center",cType),
@@ -1163,6 +1170,7 @@ class PseudospecCtrl_d(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("shiftGroupSize",iType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl),
               ("center",zType),
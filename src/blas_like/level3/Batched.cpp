@@ -0,0 +1,328 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+namespace batched {
+
+// Each of the following kernels operates on numMembers consecutive members of
+// a batch, where entry (i,j) of member t of a matrix X is stored at
+// X[i*XRS+j*XCS+t*XBS]. The innermost loops run over the batch.
+
+template<Int N,typename T>
+void GemmKernel
+( Int m, Int n, Int kInner, Int numMembers,
+  bool conjA, bool conjB,
+  T alpha,
+  const T* A, Int ARS, Int ACS, Int ABS,
+  const T* B, Int BRS, Int BCS, Int BBS,
+  T beta,
+        T* C, Int CRS, Int CCS, Int CBS )
+{
+    const Int K = ( N > 0 ? N : kInner );
+    vector<T> acc( numMembers );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            for( Int t=0; t<numMembers; ++t )
+                acc[t] = T(0);
+            for( Int l=0; l<K; ++l )
+            {
+                const T* a = &A[i*ARS+l*ACS];
+                const T* b = &B[l*BRS+j*BCS];
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                {
+                    const T a_t = ( conjA ? Conj(a[t*ABS]) : a[t*ABS] );
+                    const T b_t = ( conjB ? Conj(b[t*BBS]) : b[t*BBS] );
+                    acc[t] += a_t*b_t;
+                }
+            }
+            T* c = &C[i*CRS+j*CCS];
+            if( beta == T(0) )
+            {
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                    c[t*CBS] = alpha*acc[t];
+            }
+            else
+            {
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                    c[t*CBS] = alpha*acc[t] + beta*c[t*CBS];
+            }
+        }
+    }
+}
+
+// Solve op(L) X = B, where op(L)(i,j) = L[i*LRS+j*LCS] (conjugated if
+// requested) is lower triangular
+template<Int N,typename F>
+void LowerSolveKernel
+( Int nTri, Int numRHS, Int numMembers,
+  bool conjugate, bool unit,
+  const F* L, Int LRS, Int LCS, Int LBS,
+        F* X, Int XRS, Int XCS, Int XBS )
+{
+    const Int n = ( N > 0 ? N : nTri );
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int i=0; i<n; ++i )
+        {
+            F* xi = &X[i*XRS+j*XCS];
+            for( Int l=0; l<i; ++l )
+            {
+                const F* lambda = &L[i*LRS+l*LCS];
+                const F* xl = &X[l*XRS+j*XCS];
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                {
+                    const F lambda_t =
+                      ( conjugate ? Conj(lambda[t*LBS]) : lambda[t*LBS] );
+                    xi[t*XBS] -= lambda_t*xl[t*XBS];
+                }
+            }
+            if( !unit )
+            {
+                const F* delta = &L[i*LRS+i*LCS];
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                {
+                    const F delta_t =
+                      ( conjugate ? Conj(delta[t*LBS]) : delta[t*LBS] );
+                    xi[t*XBS] /= delta_t;
+                }
+            }
+        }
+    }
+}
+
+// Solve op(U) X = B, where op(U)(i,j) = U[i*URS+j*UCS] (conjugated if
+// requested) is upper triangular
+template<Int N,typename F>
+void UpperSolveKernel
+( Int nTri, Int numRHS, Int numMembers,
+  bool conjugate, bool unit,
+  const F* U, Int URS, Int UCS, Int UBS,
+        F* X, Int XRS, Int XCS, Int XBS )
+{
+    const Int n = ( N > 0 ? N : nTri );
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int i=n-1; i>=0; --i )
+        {
+            F* xi = &X[i*XRS+j*XCS];
+            for( Int l=i+1; l<n; ++l )
+            {
+                const F* upsilon = &U[i*URS+l*UCS];
+                const F* xl = &X[l*XRS+j*XCS];
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                {
+                    const F upsilon_t =
+                      ( conjugate ? Conj(upsilon[t*UBS]) : upsilon[t*UBS] );
+                    xi[t*XBS] -= upsilon_t*xl[t*XBS];
+                }
+            }
+            if( !unit )
+            {
+                const F* delta = &U[i*URS+i*UCS];
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                {
+                    const F delta_t =
+                      ( conjugate ? Conj(delta[t*UBS]) : delta[t*UBS] );
+                    xi[t*XBS] /= delta_t;
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const BatchMatrix<T>& A, const BatchMatrix<T>& B,
+  T beta,        BatchMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = ( orientA == NORMAL ? A.Height() : A.Width() );
+    const Int kInner = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const Int n = ( orientB == NORMAL ? B.Width() : B.Height() );
+    EL_DEBUG_ONLY(
+      const Int kInnerB = ( orientB == NORMAL ? B.Height() : B.Width() );
+      if( kInner != kInnerB || C.Height() != m || C.Width() != n )
+          LogicError("Nonconformal batched Gemm");
+      if( A.BatchSize() != C.BatchSize() || B.BatchSize() != C.BatchSize() )
+          LogicError("Batch sizes did not match");
+    )
+    const Int batchSize = C.BatchSize();
+
+    // op(A)(i,l) = A[i*ARS+l*ACS] and op(B)(l,j) = B[l*BRS+j*BCS]
+    const Int ARS = ( orientA == NORMAL ? A.InnerStride() : A.LDim() );
+    const Int ACS = ( orientA == NORMAL ? A.LDim() : A.InnerStride() );
+    const Int BRS = ( orientB == NORMAL ? B.InnerStride() : B.LDim() );
+    const Int BCS = ( orientB == NORMAL ? B.LDim() : B.InnerStride() );
+    const bool conjA = ( orientA == ADJOINT );
+    const bool conjB = ( orientB == ADJOINT );
+    const Int ABS = A.BatchStride();
+    const Int BBS = B.BatchStride();
+    const Int CBS = C.BatchStride();
+    const Int CRS = C.InnerStride();
+    const Int CCS = C.LDim();
+
+    const T* ABuf = A.LockedBuffer();
+    const T* BBuf = B.LockedBuffer();
+          T* CBuf = C.Buffer();
+
+    const Int numChunks = (batchSize+CHUNK_SIZE-1) / CHUNK_SIZE;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int kBeg = chunk*CHUNK_SIZE;
+        const Int numMembers = Min( CHUNK_SIZE, batchSize-kBeg );
+        EL_BATCH_DISPATCH
+        ( kInner, GemmKernel,
+          m, n, kInner, numMembers, conjA, conjB,
+          alpha, &ABuf[kBeg*ABS], ARS, ACS, ABS,
+                 &BBuf[kBeg*BBS], BRS, BCS, BBS,
+          beta,  &CBuf[kBeg*CBS], CRS, CCS, CBS )
+    }
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const BatchMatrix<F>& A, BatchMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Triangular matrices must be square");
+      if( (side == LEFT && A.Height() != B.Height()) ||
+          (side == RIGHT && A.Height() != B.Width()) )
+          LogicError("Nonconformal batched Trsm");
+      if( A.BatchSize() != B.BatchSize() )
+          LogicError("Batch sizes did not match");
+    )
+    const Int batchSize = B.BatchSize();
+    const Int nTri = A.Height();
+    const bool unit = ( diag == UNIT );
+
+    // Reduce each case to solving op(T) X = alpha B from the left, where
+    // op(T)(i,j) = A[i*TRS+j*TCS] (possibly conjugated). Right-sided solves
+    // are handled through X op(A) = B <=> op(A)^T X^T = B^T.
+    Int TRS, TCS, XRS, XCS, numRHS;
+    bool lowerTri, conjugate;
+    if( side == LEFT )
+    {
+        XRS = B.InnerStride();
+        XCS = B.LDim();
+        numRHS = B.Width();
+        if( orientation == NORMAL )
+        {
+            TRS = A.InnerStride();
+            TCS = A.LDim();
+            lowerTri = ( uplo == LOWER );
+        }
+        else
+        {
+            TRS = A.LDim();
+            TCS = A.InnerStride();
+            lowerTri = ( uplo == UPPER );
+        }
+        conjugate = ( orientation == ADJOINT );
+    }
+    else
+    {
+        XRS = B.LDim();
+        XCS = B.InnerStride();
+        numRHS = B.Height();
+        if( orientation == NORMAL )
+        {
+            TRS = A.LDim();
+            TCS = A.InnerStride();
+            lowerTri = ( uplo == UPPER );
+        }
+        else
+        {
+            TRS = A.InnerStride();
+            TCS = A.LDim();
+            lowerTri = ( uplo == LOWER );
+        }
+        conjugate = ( orientation == ADJOINT );
+    }
+    const Int TBS = A.BatchStride();
+    const Int XBS = B.BatchStride();
+
+    const F* ABuf = A.LockedBuffer();
+          F* BBuf = B.Buffer();
+
+    const Int numChunks = (batchSize+CHUNK_SIZE-1) / CHUNK_SIZE;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int kBeg = chunk*CHUNK_SIZE;
+        const Int numMembers = Min( CHUNK_SIZE, batchSize-kBeg );
+        const F* Tri = &ABuf[kBeg*TBS];
+              F* X = &BBuf[kBeg*XBS];
+        if( alpha != F(1) )
+        {
+            for( Int j=0; j<numRHS; ++j )
+            {
+                for( Int i=0; i<nTri; ++i )
+                {
+                    F* xi = &X[i*XRS+j*XCS];
+                    EL_SIMD
+                    for( Int t=0; t<numMembers; ++t )
+                        xi[t*XBS] *= alpha;
+                }
+            }
+        }
+        if( lowerTri )
+        {
+            EL_BATCH_DISPATCH
+            ( nTri, LowerSolveKernel,
+              nTri, numRHS, numMembers, conjugate, unit,
+              Tri, TRS, TCS, TBS, X, XRS, XCS, XBS )
+        }
+        else
+        {
+            EL_BATCH_DISPATCH
+            ( nTri, UpperSolveKernel,
+              nTri, numRHS, numMembers, conjugate, unit,
+              Tri, TRS, TCS, TBS, X, XRS, XCS, XBS )
+        }
+    }
+}
+
+#define PROTO_INT(T) \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const BatchMatrix<T>& A, const BatchMatrix<T>& B, \
+    T beta,        BatchMatrix<T>& C );
+
+#define PROTO(T) \
+  PROTO_INT(T) \
+  template void Trsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    T alpha, const BatchMatrix<T>& A, BatchMatrix<T>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace batched
+} // namespace El
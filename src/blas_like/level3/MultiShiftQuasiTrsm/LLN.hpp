@@ -61,15 +61,12 @@ void LLNUnb( const Matrix<F>& L, const Matrix<F>& shifts, Matrix<F>& X )
                 const F chi2 = xBuf[k+1];
                 xBuf[k  ] = c*chi1 - Conj(s)*chi2;
                 xBuf[k+1] = s*chi1 +       c*chi2;
-
-                // Update x2 := x2 - L21 x1
-                blas::Axpy
-                ( m-(k+2), -xBuf[k  ], 
-                  &LBuf[(k+2)+ k   *ldl], 1, &xBuf[k+2], 1 );
-                blas::Axpy
-                ( m-(k+2), -xBuf[k+1], 
-                  &LBuf[(k+2)+(k+1)*ldl], 1, &xBuf[k+2], 1 );
             }
+            // Update all of the right-hand sides at once: X2 -= L21 X1
+            blas::Gemm
+            ( 'N', 'N', m-(k+2), n, 2,
+              F(-1), &LBuf[(k+2)+k*ldl], ldl, &XBuf[k], ldx,
+              F(1), &XBuf[k+2], ldx );
 
             k += 2;
         }
@@ -79,9 +76,11 @@ void LLNUnb( const Matrix<F>& L, const Matrix<F>& shifts, Matrix<F>& X )
             {
                 F* xBuf = &XBuf[j*ldx];
                 xBuf[k] /= LBuf[k+k*ldl] - shifts.Get(j,0);
-                blas::Axpy
-                ( m-(k+1), -xBuf[k], &LBuf[(k+1)+k*ldl], 1, &xBuf[k+1], 1 );
             }
+            // Update all of the right-hand sides at once: X2 -= l21 x1
+            blas::Geru
+            ( m-(k+1), n, F(-1), &LBuf[(k+1)+k*ldl], 1,
+              &XBuf[k], ldx, &XBuf[k+1], ldx );
             k += 1;
         }
     }
@@ -65,11 +65,12 @@ void LLTUnb
                 xBuf[k+1] /= gamma22;
                 xBuf[k  ] -= gamma21*xBuf[k+1];
                 xBuf[k  ] /= gamma11;
-
-                // Update x0 := x0 - L10^T x1
-                blas::Axpy( k, -xBuf[k  ], &LBuf[k  ], ldl, xBuf, 1 );
-                blas::Axpy( k, -xBuf[k+1], &LBuf[k+1], ldl, xBuf, 1 );
             }
+            // Update all of the right-hand sides at once: X0 -= L10^T X1
+            blas::Gemm
+            ( 'T', 'N', k, n, 2,
+              F(-1), &LBuf[k], ldl, &XBuf[k], ldx,
+              F(1), XBuf, ldx );
         }
         else
         {
@@ -78,10 +79,11 @@ void LLTUnb
                 F* xBuf = &XBuf[j*ldx];
                 // Solve the 1x1 linear system
                 xBuf[k] /= LBuf[k+k*ldl] - shifts.Get(j,0);
-
-                // Update x0 := x0 - l10^T chi_1
-                blas::Axpy( k, -xBuf[k], &LBuf[k], ldl, xBuf, 1 );
             }
+            // Update all of the right-hand sides at once: X0 -= l10^T x1
+            blas::Geru
+            ( k, n, F(-1), &LBuf[k], ldl,
+              &XBuf[k], ldx, XBuf, ldx );
         }
         --k;
     }
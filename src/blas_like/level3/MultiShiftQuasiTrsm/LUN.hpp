@@ -69,11 +69,12 @@ void LUNUnb( const Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X )
                 xBuf[k+1] /= gamma22;
                 xBuf[k  ] -= gamma12*xBuf[k+1];
                 xBuf[k  ] /= gamma11;
-
-                // Update x0 := x0 - U01 x1
-                blas::Axpy( k, -xBuf[k  ], &UBuf[ k   *ldu], 1, xBuf, 1 );
-                blas::Axpy( k, -xBuf[k+1], &UBuf[(k+1)*ldu], 1, xBuf, 1 );
             }
+            // Update all of the right-hand sides at once: X0 -= U01 X1
+            blas::Gemm
+            ( 'N', 'N', k, n, 2,
+              F(-1), &UBuf[k*ldu], ldu, &XBuf[k], ldX,
+              F(1), XBuf, ldX );
         }
         else
         {
@@ -82,10 +83,11 @@ void LUNUnb( const Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X )
                 F* xBuf = &XBuf[j*ldX];
                 // Solve the 1x1 linear system
                 xBuf[k] /= UBuf[k+k*ldu] - shifts.Get(j,0);
-
-                // Update x0 := x0 - u01 chi_1
-                blas::Axpy( k, -xBuf[k], &UBuf[k*ldu], 1, xBuf, 1 );
             }
+            // Update all of the right-hand sides at once: X0 -= u01 x1
+            blas::Geru
+            ( k, n, F(-1), &UBuf[k*ldu], 1,
+              &XBuf[k], ldX, XBuf, ldX );
         }
         --k;
     }
@@ -164,17 +166,16 @@ void LUNUnb
                 xImagBuf[k+0] = eta1.imag();
                 xRealBuf[k+1] = eta2.real();
                 xImagBuf[k+1] = eta2.imag();
-
-                // Update x0 := x0 - U01 x1
-                blas::Axpy
-                ( k, -xRealBuf[k  ], &UBuf[ k   *ldu], 1, xRealBuf, 1 );
-                blas::Axpy
-                ( k, -xImagBuf[k  ], &UBuf[ k   *ldu], 1, xImagBuf, 1 );
-                blas::Axpy
-                ( k, -xRealBuf[k+1], &UBuf[(k+1)*ldu], 1, xRealBuf, 1 );
-                blas::Axpy
-                ( k, -xImagBuf[k+1], &UBuf[(k+1)*ldu], 1, xImagBuf, 1 );
             }
+            // Update all of the right-hand sides at once: X0 -= U01 X1
+            blas::Gemm
+            ( 'N', 'N', k, n, 2,
+              Real(-1), &UBuf[k*ldu], ldu, &XRealBuf[k], ldXReal,
+              Real(1), XRealBuf, ldXReal );
+            blas::Gemm
+            ( 'N', 'N', k, n, 2,
+              Real(-1), &UBuf[k*ldu], ldu, &XImagBuf[k], ldXImag,
+              Real(1), XImagBuf, ldXImag );
         }
         else
         {
@@ -187,11 +188,14 @@ void LUNUnb
                 eta1 /= UBuf[k+k*ldu] - shifts.Get(j,0);
                 xRealBuf[k] = eta1.real();
                 xImagBuf[k] = eta1.imag();
-
-                // Update x0 := x0 - u01 chi_1
-                blas::Axpy( k, -xRealBuf[k], &UBuf[k*ldu], 1, xRealBuf, 1 );
-                blas::Axpy( k, -xImagBuf[k], &UBuf[k*ldu], 1, xImagBuf, 1 );
             }
+            // Update all of the right-hand sides at once: X0 -= u01 x1
+            blas::Geru
+            ( k, n, Real(-1), &UBuf[k*ldu], 1,
+              &XRealBuf[k], ldXReal, XRealBuf, ldXReal );
+            blas::Geru
+            ( k, n, Real(-1), &UBuf[k*ldu], 1,
+              &XImagBuf[k], ldXImag, XImagBuf, ldXImag );
         }
         --k;
     }
@@ -66,15 +66,12 @@ void LUTUnb
                 // Solve against Q^T
                 xBuf[k  ] = c*chi1 - Conj(s)*chi2;
                 xBuf[k+1] = s*chi1 +       c*chi2;
-
-                // Update x2 := x2 - U12^T x1
-                blas::Axpy
-                ( m-(k+2), -xBuf[k  ],
-                  &UBuf[ k   +(k+2)*ldU], ldU, &xBuf[k+2], 1 );
-                blas::Axpy
-                ( m-(k+2), -xBuf[k+1],
-                  &UBuf[(k+1)+(k+2)*ldU], ldU, &xBuf[k+2], 1 );
             }
+            // Update all of the right-hand sides at once: X2 -= U12^T X1
+            blas::Gemm
+            ( 'T', 'N', m-(k+2), n, 2,
+              F(-1), &UBuf[k+(k+2)*ldU], ldU, &XBuf[k], ldX,
+              F(1), &XBuf[k+2], ldX );
             k += 2;
         }
         else
@@ -83,9 +80,11 @@ void LUTUnb
             {
                 F* xBuf = &XBuf[j*ldX];
                 xBuf[k] /= UBuf[k+k*ldU] - shifts.Get(j,0);
-                blas::Axpy
-                ( m-(k+1), -xBuf[k], &UBuf[k+(k+1)*ldU], ldU, &xBuf[k+1], 1 );
             }
+            // Update all of the right-hand sides at once: X2 -= u12^T x1
+            blas::Geru
+            ( m-(k+1), n, F(-1), &UBuf[k+(k+1)*ldU], ldU,
+              &XBuf[k], ldX, &XBuf[k+1], ldX );
             k += 1;
         }
     }
@@ -160,21 +159,16 @@ void LUTUnb
                 xImagBuf[k  ] = eta1.imag();
                 xRealBuf[k+1] = eta2.real();
                 xImagBuf[k+1] = eta2.imag();
-
-                // Update x2 := x2 - U12^T x1
-                blas::Axpy
-                ( m-(k+2), -xRealBuf[k  ],
-                  &UBuf[ k   +(k+2)*ldU], ldU, &xRealBuf[k+2], 1 );
-                blas::Axpy
-                ( m-(k+2), -xImagBuf[k  ],
-                  &UBuf[ k   +(k+2)*ldU], ldU, &xImagBuf[k+2], 1 );
-                blas::Axpy
-                ( m-(k+2), -xRealBuf[k+1],
-                  &UBuf[(k+1)+(k+2)*ldU], ldU, &xRealBuf[k+2], 1 );
-                blas::Axpy
-                ( m-(k+2), -xImagBuf[k+1],
-                  &UBuf[(k+1)+(k+2)*ldU], ldU, &xImagBuf[k+2], 1 );
             }
+            // Update all of the right-hand sides at once: X2 -= U12^T X1
+            blas::Gemm
+            ( 'T', 'N', m-(k+2), n, 2,
+              Real(-1), &UBuf[k+(k+2)*ldU], ldU, &XRealBuf[k], ldXReal,
+              Real(1), &XRealBuf[k+2], ldXReal );
+            blas::Gemm
+            ( 'T', 'N', m-(k+2), n, 2,
+              Real(-1), &UBuf[k+(k+2)*ldU], ldU, &XImagBuf[k], ldXImag,
+              Real(1), &XImagBuf[k+2], ldXImag );
             k += 2;
         }
         else
@@ -187,13 +181,14 @@ void LUTUnb
                 eta1 /= UBuf[k+k*ldU] - shifts.Get(j,0);
                 xRealBuf[k] = eta1.real();
                 xImagBuf[k] = eta1.imag();
-                blas::Axpy
-                ( m-(k+1), -xRealBuf[k], 
-                  &UBuf[k+(k+1)*ldU], ldU, &xRealBuf[k+1], 1 );
-                blas::Axpy
-                ( m-(k+1), -xImagBuf[k], 
-                  &UBuf[k+(k+1)*ldU], ldU, &xImagBuf[k+1], 1 );
             }
+            // Update all of the right-hand sides at once: X2 -= u12^T x1
+            blas::Geru
+            ( m-(k+1), n, Real(-1), &UBuf[k+(k+1)*ldU], ldU,
+              &XRealBuf[k], ldXReal, &XRealBuf[k+1], ldXReal );
+            blas::Geru
+            ( m-(k+1), n, Real(-1), &UBuf[k+(k+1)*ldU], ldU,
+              &XImagBuf[k], ldXImag, &XImagBuf[k+1], ldXImag );
             k += 1;
         }
     }
@@ -10,38 +10,75 @@
 namespace El {
 namespace mstrsm {
 
+// Rather than shifting the diagonal of T and performing a separate triangular
+// solve for each shift, each step of the following updates all of the
+// right-hand sides at once so that T is only traversed once (and is never
+// modified).
 template<typename F>
 void LeftUnb
 ( UpperOrLower uplo,
   Orientation orientation,
-        Matrix<F>& T,
+  const Matrix<F>& T,
   const Matrix<F>& shifts,
-        Matrix<F>& X ) 
+        Matrix<F>& X )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
       if( shifts.Height() != X.Width() )
           LogicError("Incompatible number of shifts");
     )
-    const char uploChar = ( uplo==LOWER ? 'L' : 'U' );
-    char orientChar; 
-    switch( orientation )
-    {
-    case NORMAL:    orientChar = 'N'; break;
-    case TRANSPOSE: orientChar = 'T'; break;
-    default:        orientChar = 'C';
-    }
-    auto diag = GetDiagonal(T);
     const Int n = T.Height();
-    const Int ldim = T.LDim();
-    const Int numShifts = shifts.Height();
-    for( Int j=0; j<numShifts; ++j )
+    const Int numShifts = X.Width();
+    const bool conjugate = ( orientation == ADJOINT );
+    const bool forward = ( (uplo == LOWER) == (orientation == NORMAL) );
+
+    const F* TBuf = T.LockedBuffer();
+    const F* shiftBuf = shifts.LockedBuffer();
+          F* XBuf = X.Buffer();
+    const Int ldT = T.LDim();
+    const Int ldX = X.LDim();
+
+    vector<F> t;
+    for( Int step=0; step<n; ++step )
     {
-        ShiftDiagonal( T, -shifts.Get(j,0) );
-        blas::Trsv
-        ( uploChar, orientChar, 'N', n, 
-          T.LockedBuffer(), ldim, X.Buffer(0,j), 1 );
-        SetDiagonal( T, diag );
+        const Int i = ( forward ? step : n-1-step );
+        // The indices of X which have already been solved for
+        const Int solvedBeg = ( forward ? 0 : i+1 );
+        const Int solvedEnd = ( forward ? i : n );
+        const Int numSolved = solvedEnd - solvedBeg;
+        if( orientation != NORMAL && numSolved > 0 )
+        {
+            // x(i) -= op(T)(i,solved) X(solved,:) for all of the shifts
+            t.resize( numSolved );
+            for( Int r=0; r<numSolved; ++r )
+            {
+                const F tau = TBuf[(solvedBeg+r)+i*ldT];
+                t[r] = ( conjugate ? Conj(tau) : tau );
+            }
+            blas::Gemv
+            ( 'T', numSolved, numShifts,
+              F(-1), &XBuf[solvedBeg], ldX, t.data(), 1,
+              F(1),  &XBuf[i],         ldX );
+        }
+
+        const F tauii = TBuf[i+i*ldT];
+        for( Int j=0; j<numShifts; ++j )
+        {
+            const F delta = tauii - shiftBuf[j];
+            XBuf[i+j*ldX] /= ( conjugate ? Conj(delta) : delta );
+        }
+
+        if( orientation == NORMAL )
+        {
+            // X(unsolved,:) -= T(unsolved,i) x(i) for all of the shifts
+            const Int unsolvedBeg = ( forward ? i+1 : 0 );
+            const Int unsolvedEnd = ( forward ? n : i );
+            blas::Geru
+            ( unsolvedEnd-unsolvedBeg, numShifts,
+              F(-1), &TBuf[unsolvedBeg+i*ldT], 1,
+                     &XBuf[i],                 ldX,
+                     &XBuf[unsolvedBeg],       ldX );
+        }
     }
 }
 
@@ -0,0 +1,227 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/control.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/lapack_like/props.hpp>
+#include <El/matrices.hpp>
+
+namespace El {
+
+// A is assumed to be Hermitian positive-definite and B tall-skinny. Z is then
+// returned such that X ~= Z Z^H approximately solves
+//    A X + X A^H = B B^H
+// using the low-rank ADI iteration with positive shifts p_k,
+//
+//    V_k     = inv(A + p_k I) W_{k-1},
+//    W_k     = W_{k-1} - 2 p_k V_k,
+//    Z_k     = [Z_{k-1}, sqrt(2 p_k) V_k],
+//
+// with W_0 = B. The residual A Z_k Z_k^H + Z_k Z_k^H A^H - B B^H is then
+// exactly -W_k W_k^H, so that its two-norm is cheaply available as
+// || W_k^H W_k ||_2.
+//
+// Since every shifted matrix has the same sparsity pattern (the diagonal of A
+// is explicitly added to it), the nested-dissection reordering and symbolic
+// factorization are only computed once.
+//
+// See Benner, Kurschner, and Saak's "An improved numerical method for
+// balanced truncation for symmetric second-order systems" and Li and White's
+// "Low rank solution of Lyapunov equations".
+
+namespace lr_lyap {
+
+// Return || W^H W ||_2 = || W W^H ||_2
+template<typename Field>
+Base<Field> GramTwoNorm( const DistMultiVec<Field>& W )
+{
+    EL_DEBUG_CSE
+    const Int width = W.Width();
+    Matrix<Field> G;
+    Zeros( G, width, width );
+    if( W.LocalHeight() > 0 )
+        Gemm
+        ( ADJOINT, NORMAL,
+          Field(1), W.LockedMatrix(), W.LockedMatrix(), Field(0), G );
+    mpi::AllReduce( G.Buffer(), width*width, W.Grid().Comm() );
+    return TwoNorm( G );
+}
+
+template<typename Field>
+void EstimateShifts
+( const DistSparseMatrix<Field>& A,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Base<Field>>& shifts,
+  const LowRankLyapunovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Int numShifts = ctrl.numShifts;
+    if( numShifts < 1 )
+        LogicError("Must request at least one shift");
+
+    // Since the Ritz values of A are poor estimates of its smallest
+    // eigenvalue, refine the latter with inverse iteration using the
+    // (already computed) factorization of A
+    auto extremal = HermitianExtremalSingValEst( A, ctrl.basisSize );
+    Real lambdaMin = extremal.first;
+    const Real lambdaMax = extremal.second;
+    DistMultiVec<Field> x(A.Grid()), y(A.Grid());
+    Gaussian( x, n, 1 );
+    for( Int it=0; it<ctrl.numInverseIts; ++it )
+    {
+        x *= Field(1)/FrobeniusNorm(x);
+        y = x;
+        sparseLDLFact.Solve( y );
+        const Real rho = RealPart(Dot(x,y));
+        if( rho <= Real(0) )
+            RuntimeError("A did not appear to be positive-definite");
+        lambdaMin = Min( lambdaMin, Real(1)/rho );
+        x = y;
+    }
+    if( lambdaMin <= Real(0) )
+        RuntimeError("A did not appear to be positive-definite");
+    if( ctrl.progress && A.Grid().Rank() == 0 )
+        Output
+        ("Estimated the spectrum of A to lie in [",lambdaMin,",",lambdaMax,"]");
+
+    Zeros( shifts, numShifts, 1 );
+    const Real ratio = Max( lambdaMax, lambdaMin ) / lambdaMin;
+    for( Int j=0; j<numShifts; ++j )
+        shifts(j) =
+          lambdaMin*Pow( ratio, Real(2*j+1)/Real(2*numShifts) );
+}
+
+} // namespace lr_lyap
+
+template<typename Field>
+void LowRankLyapunov
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& Z,
+  const LowRankLyapunovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Int width = B.Width();
+    const Grid& grid = A.Grid();
+    const int commRank = grid.Rank();
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != n )
+          LogicError("B must conform with A");
+      if( !mpi::Congruent( grid.Comm(), B.Grid().Comm() ) )
+          LogicError("A and B must share a communicator");
+    )
+
+    // Explicitly store the diagonal of A so that every shifted matrix shares
+    // the same nonzero pattern
+    DistSparseMatrix<Field> AShift( A );
+    ShiftDiagonal( AShift, Field(0) );
+    const Int localHeight = AShift.LocalHeight();
+    vector<Int> diagOffsets( localHeight );
+    vector<Field> diag( localHeight );
+    {
+        const Field* valBuf = AShift.LockedValueBuffer();
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = AShift.GlobalRow(iLoc);
+            diagOffsets[iLoc] = AShift.Offset( iLoc, i );
+            diag[iLoc] = valBuf[diagOffsets[iLoc]];
+        }
+    }
+
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( AShift, true, ctrl.bisectCtrl );
+    // Initialize pulled in the values of the unshifted matrix, so any other
+    // shift must be explicitly pushed into the factorization
+    Real pulledShift = 0;
+    bool haveFactored = false;
+    Real factoredShift = 0;
+    auto factorWithShift = [&]( const Real& shift )
+    {
+        if( shift != pulledShift )
+        {
+            Field* valBuf = AShift.ValueBuffer();
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                valBuf[diagOffsets[iLoc]] = diag[iLoc] + shift;
+            sparseLDLFact.ChangeNonzeroValues( AShift );
+            pulledShift = shift;
+        }
+        sparseLDLFact.Factor();
+        haveFactored = true;
+        factoredShift = shift;
+    };
+
+    Matrix<Real> shifts( ctrl.shifts );
+    if( shifts.Height() == 0 )
+    {
+        factorWithShift( Real(0) );
+        lr_lyap::EstimateShifts( A, sparseLDLFact, shifts, ctrl );
+    }
+    if( shifts.Width() != 1 )
+        LogicError("The ADI shifts should be stored in a column vector");
+    const Int numShifts = shifts.Height();
+    for( Int j=0; j<numShifts; ++j )
+        if( shifts(j) <= Real(0) )
+            LogicError("The ADI shifts must be positive");
+
+    const Real BNorm = lr_lyap::GramTwoNorm( B );
+    DistMultiVec<Field> W( B ), V( grid );
+    vector<Matrix<Field>> ZBlocks;
+    for( Int it=0; it<ctrl.maxIts; ++it )
+    {
+        const Real shift = shifts(it % numShifts);
+        // Refactoring is only required when the shift changes
+        if( !haveFactored || shift != factoredShift )
+            factorWithShift( shift );
+
+        V = W;
+        sparseLDLFact.Solve( V );
+        Axpy( Field(-2*shift), V, W );
+        V *= Field(Sqrt(2*shift));
+        ZBlocks.push_back( V.LockedMatrix() );
+
+        const Real residNorm = lr_lyap::GramTwoNorm( W );
+        if( ctrl.progress && commRank == 0 )
+            Output
+            ("ADI iteration ",it,": shift=",shift,
+             ", || R ||_2 / || B B^H ||_2=",residNorm/BNorm);
+        if( residNorm <= ctrl.relTol*BNorm )
+            break;
+    }
+
+    const Int numBlocks = ZBlocks.size();
+    Z.SetGrid( grid );
+    Z.Resize( n, numBlocks*width );
+    for( Int k=0; k<numBlocks; ++k )
+    {
+        auto ZBlock = Z.Matrix()( ALL, IR(k*width,(k+1)*width) );
+        ZBlock = ZBlocks[k];
+    }
+}
+
+#define PROTO(F) \
+  template void LowRankLyapunov \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<F>& B, \
+          DistMultiVec<F>& Z, \
+    const LowRankLyapunovCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -18,7 +18,7 @@ namespace El {
 // See Chapter 2 of Nicholas J. Higham's "Functions of Matrices"
 
 template<typename F>
-void Lyapunov
+SignInfo Lyapunov
 ( const Matrix<F>& A, const Matrix<F>& C, Matrix<F>& X, 
   SignCtrl<Base<F>> ctrl )
 {
@@ -29,22 +29,14 @@ void Lyapunov
       if( C.Height() != A.Height() || C.Width() != A.Height() )
           LogicError("C must conform with A");
     )
-    const Int m = A.Height();
-    Matrix<F> W, WTL, WTR,
-                 WBL, WBR;
-    W.Resize( 2*m, 2*m );
-    Zero( W );
-    PartitionDownDiagonal
-    ( W, WTL, WTR,
-         WBL, WBR, m );
-    WTL = A;
-    Adjoint( A, WBR ); WBR *= -1;
-    WTR = C;           WTR *= -1;
-    Sylvester( m, W, X, ctrl );
+    // This is the Sylvester equation with B = A^H
+    Matrix<F> AAdj;
+    Adjoint( A, AAdj );
+    return Sylvester( A, AAdj, C, X, ctrl );
 }
 
 template<typename F>
-void Lyapunov
+SignInfo Lyapunov
 ( const ElementalMatrix<F>& A,
   const ElementalMatrix<F>& C, 
         ElementalMatrix<F>& X, SignCtrl<Base<F>> ctrl )
@@ -57,28 +49,19 @@ void Lyapunov
           LogicError("C must conform with A");
       AssertSameGrids( A, C );
     )
-    const Grid& g = A.Grid();
-    const Int m = A.Height();
-    DistMatrix<F> W(g), WTL(g), WTR(g),
-                        WBL(g), WBR(g);
-    W.Resize( 2*m, 2*m );
-    Zero( W );
-    PartitionDownDiagonal
-    ( W, WTL, WTR,
-         WBL, WBR, m );
-    WTL = A;
-    Adjoint( A, WBR ); WBR *= -1;
-    WTR = C;           WTR *= -1;
-    Sylvester( m, W, X, ctrl );
+    // This is the Sylvester equation with B = A^H
+    DistMatrix<F> AAdj( A.Grid() );
+    Adjoint( A, AAdj );
+    return Sylvester( A, AAdj, C, X, ctrl );
 }
 
 #define PROTO(F) \
-  template void Lyapunov \
+  template SignInfo Lyapunov \
   ( const Matrix<F>& A, \
     const Matrix<F>& C, \
           Matrix<F>& X, \
     SignCtrl<Base<F>> ctrl ); \
-  template void Lyapunov \
+  template SignInfo Lyapunov \
   ( const ElementalMatrix<F>& A, \
     const ElementalMatrix<F>& C, \
           ElementalMatrix<F>& X, \
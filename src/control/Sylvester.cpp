@@ -7,7 +7,9 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
 #include <El/lapack_like/funcs.hpp>
+#include <El/lapack_like/props.hpp>
 #include <El/control.hpp>
 
 namespace El {
@@ -17,43 +19,420 @@ namespace El {
 //
 // The solution, X, to the equation
 //   A X + X B = C
-// is returned, as well as the number of Newton iterations for computing sgn(W).
+// is returned, as well as the iteration counts for computing sgn(W).
 //
 // See Chapter 2 of Nicholas J. Higham's "Functions of Matrices"
 
+namespace sylvester {
+
+// Since W is block upper-triangular, so are all of the sign iterates, and the
+// iteration only needs to be carried out on the coupled blocks
+//
+//   | A C |
+//   | 0 B |,
+//
+// where inv(W) has the diagonal blocks inv(A) and inv(B) and the top-right
+// block -inv(A) C inv(B). The zero block is therefore never formed, and only
+// the diagonal blocks are ever inverted. Once the iterates are sufficiently
+// close to an involution, the inverse-free Newton-Schulz iteration is used,
+// which only requires Gemm on the three blocks.
+//
+// See Benner, Quintana-Orti, and Quintana-Orti's "Solving Stable Sylvester
+// Equations via Rational Iterative Schemes".
+
+template<typename Real>
+Real BlockFrobeniusNorm
+( const Real& alpha, const Real& beta, const Real& gamma )
+{
+    const Real scale = Max( Max( alpha, beta ), gamma );
+    if( scale == Real(0) )
+        return Real(0);
+    const Real alphaScaled = alpha / scale;
+    const Real betaScaled = beta / scale;
+    const Real gammaScaled = gamma / scale;
+    return scale*Sqrt( alphaScaled*alphaScaled + betaScaled*betaScaled +
+                       gammaScaled*gammaScaled );
+}
+
+template<typename F>
+void NewtonStep
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& ANew,
+        Matrix<F>& BNew,
+        Matrix<F>& CNew,
+  SignScaling scaling )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = B.Height();
+
+    // Calculate mu while forming the diagonal blocks of inv(W)
+    Real mu=1;
+    Permutation PA, PB;
+    ANew = A;
+    BNew = B;
+    LU( ANew, PA );
+    LU( BNew, PB );
+    if( scaling == SIGN_SCALE_DET )
+    {
+        SafeProduct<F> detA = det::AfterLUPartialPiv( ANew, PA );
+        SafeProduct<F> detB = det::AfterLUPartialPiv( BNew, PB );
+        const Real kappa = (Real(m)*detA.kappa+Real(n)*detB.kappa)/Real(m+n);
+        mu = Real(1)/Exp(kappa);
+    }
+    inverse::AfterLUPartialPiv( ANew, PA );
+    inverse::AfterLUPartialPiv( BNew, PB );
+
+    // CNew := -inv(A) C inv(B)
+    Matrix<F> T;
+    Gemm( NORMAL, NORMAL, F(1), ANew, C, T );
+    Gemm( NORMAL, NORMAL, F(-1), T, BNew, CNew );
+    if( scaling == SIGN_SCALE_FROB )
+    {
+        const Real frobInv = BlockFrobeniusNorm
+          ( FrobeniusNorm(ANew), FrobeniusNorm(BNew), FrobeniusNorm(CNew) );
+        const Real frob = BlockFrobeniusNorm
+          ( FrobeniusNorm(A), FrobeniusNorm(B), FrobeniusNorm(C) );
+        mu = Sqrt( frobInv/frob );
+    }
+
+    // Overwrite the blocks of WNew with the new iterate
+    const Real halfMu = mu/Real(2);
+    const Real halfMuInv = Real(1)/(2*mu);
+    ANew *= halfMuInv;
+    BNew *= halfMuInv;
+    CNew *= halfMuInv;
+    Axpy( halfMu, A, ANew );
+    Axpy( halfMu, B, BNew );
+    Axpy( halfMu, C, CNew );
+}
+
+template<typename F>
+void NewtonStep
+( const DistMatrix<F>& A,
+  const DistMatrix<F>& B,
+  const DistMatrix<F>& C,
+        DistMatrix<F>& ANew,
+        DistMatrix<F>& BNew,
+        DistMatrix<F>& CNew,
+  SignScaling scaling )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = B.Height();
+
+    // Calculate mu while forming the diagonal blocks of inv(W)
+    Real mu=1;
+    DistPermutation PA( A.Grid() ), PB( A.Grid() );
+    ANew = A;
+    BNew = B;
+    LU( ANew, PA );
+    LU( BNew, PB );
+    if( scaling == SIGN_SCALE_DET )
+    {
+        SafeProduct<F> detA = det::AfterLUPartialPiv( ANew, PA );
+        SafeProduct<F> detB = det::AfterLUPartialPiv( BNew, PB );
+        const Real kappa = (Real(m)*detA.kappa+Real(n)*detB.kappa)/Real(m+n);
+        mu = Real(1)/Exp(kappa);
+    }
+    inverse::AfterLUPartialPiv( ANew, PA );
+    inverse::AfterLUPartialPiv( BNew, PB );
+
+    // CNew := -inv(A) C inv(B)
+    DistMatrix<F> T( A.Grid() );
+    Gemm( NORMAL, NORMAL, F(1), ANew, C, T );
+    Gemm( NORMAL, NORMAL, F(-1), T, BNew, CNew );
+    if( scaling == SIGN_SCALE_FROB )
+    {
+        const Real frobInv = BlockFrobeniusNorm
+          ( FrobeniusNorm(ANew), FrobeniusNorm(BNew), FrobeniusNorm(CNew) );
+        const Real frob = BlockFrobeniusNorm
+          ( FrobeniusNorm(A), FrobeniusNorm(B), FrobeniusNorm(C) );
+        mu = Sqrt( frobInv/frob );
+    }
+
+    // Overwrite the blocks of WNew with the new iterate
+    const Real halfMu = mu/Real(2);
+    const Real halfMuInv = Real(1)/(2*mu);
+    ANew *= halfMuInv;
+    BNew *= halfMuInv;
+    CNew *= halfMuInv;
+    Axpy( halfMu, A, ANew );
+    Axpy( halfMu, B, BNew );
+    Axpy( halfMu, C, CNew );
+}
+
+// If || W^2 - I ||_F > maxResid, false is returned without forming WNew. In
+// either case, || W^2 - I ||_F is returned in 'resid'.
+template<typename F>
+bool NewtonSchulzStep
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& ANew,
+        Matrix<F>& BNew,
+        Matrix<F>& CNew,
+  Base<F> maxResid,
+  Base<F>& resid )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+
+    // R := W^2 - I = | A^2 - I, A C + C B |
+    //                | 0,       B^2 - I   |
+    Matrix<F> RA, RB, RC;
+    Gemm( NORMAL, NORMAL, F(1), A, A, RA );
+    Gemm( NORMAL, NORMAL, F(1), B, B, RB );
+    Gemm( NORMAL, NORMAL, F(1), A, C, RC );
+    Gemm( NORMAL, NORMAL, F(1), C, B, F(1), RC );
+    ShiftDiagonal( RA, F(-1) );
+    ShiftDiagonal( RB, F(-1) );
+    resid = BlockFrobeniusNorm
+      ( FrobeniusNorm(RA), FrobeniusNorm(RB), FrobeniusNorm(RC) );
+    if( resid > maxResid )
+        return false;
+
+    // WNew := W - 1/2 W R = 1/2 W (3I - W^2)
+    ANew = A;
+    BNew = B;
+    CNew = C;
+    Gemm( NORMAL, NORMAL, F(-1)/F(2), A, RA, F(1), ANew );
+    Gemm( NORMAL, NORMAL, F(-1)/F(2), B, RB, F(1), BNew );
+    Gemm( NORMAL, NORMAL, F(-1)/F(2), A, RC, F(1), CNew );
+    Gemm( NORMAL, NORMAL, F(-1)/F(2), C, RB, F(1), CNew );
+    return true;
+}
+
+template<typename F>
+bool NewtonSchulzStep
+( const DistMatrix<F>& A,
+  const DistMatrix<F>& B,
+  const DistMatrix<F>& C,
+        DistMatrix<F>& ANew,
+        DistMatrix<F>& BNew,
+        DistMatrix<F>& CNew,
+  Base<F> maxResid,
+  Base<F>& resid )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+
+    // R := W^2 - I = | A^2 - I, A C + C B |
+    //                | 0,       B^2 - I   |
+    DistMatrix<F> RA(g), RB(g), RC(g);
+    Gemm( NORMAL, NORMAL, F(1), A, A, RA );
+    Gemm( NORMAL, NORMAL, F(1), B, B, RB );
+    Gemm( NORMAL, NORMAL, F(1), A, C, RC );
+    Gemm( NORMAL, NORMAL, F(1), C, B, F(1), RC );
+    ShiftDiagonal( RA, F(-1) );
+    ShiftDiagonal( RB, F(-1) );
+    resid = BlockFrobeniusNorm
+      ( FrobeniusNorm(RA), FrobeniusNorm(RB), FrobeniusNorm(RC) );
+    if( resid > maxResid )
+        return false;
+
+    // WNew := W - 1/2 W R = 1/2 W (3I - W^2)
+    ANew = A;
+    BNew = B;
+    CNew = C;
+    Gemm( NORMAL, NORMAL, F(-1)/F(2), A, RA, F(1), ANew );
+    Gemm( NORMAL, NORMAL, F(-1)/F(2), B, RB, F(1), BNew );
+    Gemm( NORMAL, NORMAL, F(-1)/F(2), A, RC, F(1), CNew );
+    Gemm( NORMAL, NORMAL, F(-1)/F(2), C, RB, F(1), CNew );
+    return true;
+}
+
+// Overwrite the blocks of W with those of sgn(W) and return the iteration
+// counts. Convergence is measured with the Frobenius norm of the difference of
+// successive iterates, and Newton-Schulz steps are scheduled as in sign::Newton
+// so that a rejected trial is not repeated on every subsequent iteration.
+template<typename F>
+SignInfo Sign
+( Matrix<F>& A,
+  Matrix<F>& B,
+  Matrix<F>& C,
+  const SignCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = (A.Height()+B.Height())*limits::Epsilon<Real>();
+
+    SignInfo info;
+    bool tryNewtonSchulz=false;
+    Real trialDiff=ctrl.newtonSchulzTol, relDiff=limits::Infinity<Real>();
+    Matrix<F> ANew, BNew, CNew;
+    Timer timer;
+    while( info.numIts < ctrl.maxIts )
+    {
+        if( ctrl.progress )
+            timer.Start();
+
+        bool newtonSchulz = false;
+        if( tryNewtonSchulz )
+        {
+            Real resid;
+            newtonSchulz = NewtonSchulzStep
+              ( A, B, C, ANew, BNew, CNew, ctrl.newtonSchulzTol, resid );
+            if( newtonSchulz )
+            {
+                ++info.numNewtonSchulzIts;
+            }
+            else
+            {
+                ++info.numNewtonSchulzRejections;
+                tryNewtonSchulz = false;
+                trialDiff = relDiff*(ctrl.newtonSchulzTol/resid);
+            }
+        }
+        if( !newtonSchulz )
+            NewtonStep( A, B, C, ANew, BNew, CNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), ANew, A );
+        Axpy( Real(-1), BNew, B );
+        Axpy( Real(-1), CNew, C );
+        const Real frobDiff = BlockFrobeniusNorm
+          ( FrobeniusNorm(A), FrobeniusNorm(B), FrobeniusNorm(C) );
+        const Real frobNew = BlockFrobeniusNorm
+          ( FrobeniusNorm(ANew), FrobeniusNorm(BNew), FrobeniusNorm(CNew) );
+        relDiff = frobDiff/frobNew;
+
+        // Ensure that the blocks hold the current iterate and break if
+        // possible
+        ++info.numIts;
+        A = ANew;
+        B = BNew;
+        C = CNew;
+        if( ctrl.progress )
+        {
+            const double iterTime = timer.Stop();
+            cout << "after " << info.numIts
+                 << ( newtonSchulz ? " Newton-Schulz" : " Newton" )
+                 << " iter's: frobDiff=" << frobDiff << ", frobNew="
+                 << frobNew << ", frobDiff/frobNew=" << frobDiff/frobNew
+                 << ", tol=" << tol << " (" << iterTime << " seconds)"
+                 << endl;
+        }
+        if( relDiff <= Pow(frobNew,ctrl.power)*tol )
+            break;
+        if( ctrl.newtonSchulz && relDiff <= trialDiff )
+            tryNewtonSchulz = true;
+    }
+    return info;
+}
+
+template<typename F>
+SignInfo Sign
+( DistMatrix<F>& A,
+  DistMatrix<F>& B,
+  DistMatrix<F>& C,
+  const SignCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = (A.Height()+B.Height())*limits::Epsilon<Real>();
+
+    SignInfo info;
+    bool tryNewtonSchulz=false;
+    Real trialDiff=ctrl.newtonSchulzTol, relDiff=limits::Infinity<Real>();
+    DistMatrix<F> ANew(g), BNew(g), CNew(g);
+    Timer timer;
+    while( info.numIts < ctrl.maxIts )
+    {
+        if( ctrl.progress )
+            timer.Start();
+
+        bool newtonSchulz = false;
+        if( tryNewtonSchulz )
+        {
+            Real resid;
+            newtonSchulz = NewtonSchulzStep
+              ( A, B, C, ANew, BNew, CNew, ctrl.newtonSchulzTol, resid );
+            if( newtonSchulz )
+            {
+                ++info.numNewtonSchulzIts;
+            }
+            else
+            {
+                ++info.numNewtonSchulzRejections;
+                tryNewtonSchulz = false;
+                trialDiff = relDiff*(ctrl.newtonSchulzTol/resid);
+            }
+        }
+        if( !newtonSchulz )
+            NewtonStep( A, B, C, ANew, BNew, CNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), ANew, A );
+        Axpy( Real(-1), BNew, B );
+        Axpy( Real(-1), CNew, C );
+        const Real frobDiff = BlockFrobeniusNorm
+          ( FrobeniusNorm(A), FrobeniusNorm(B), FrobeniusNorm(C) );
+        const Real frobNew = BlockFrobeniusNorm
+          ( FrobeniusNorm(ANew), FrobeniusNorm(BNew), FrobeniusNorm(CNew) );
+        relDiff = frobDiff/frobNew;
+
+        // Ensure that the blocks hold the current iterate and break if
+        // possible
+        ++info.numIts;
+        A = ANew;
+        B = BNew;
+        C = CNew;
+        if( ctrl.progress )
+        {
+            const double iterTime = timer.Stop();
+            if( g.Rank() == 0 )
+                cout << "after " << info.numIts
+                     << ( newtonSchulz ? " Newton-Schulz" : " Newton" )
+                     << " iter's: frobDiff=" << frobDiff << ", frobNew="
+                     << frobNew << ", frobDiff/frobNew=" << frobDiff/frobNew
+                     << ", tol=" << tol << " (" << iterTime << " seconds)"
+                     << endl;
+        }
+        if( relDiff <= Pow(frobNew,ctrl.power)*tol )
+            break;
+        if( ctrl.newtonSchulz && relDiff <= trialDiff )
+            tryNewtonSchulz = true;
+    }
+    return info;
+}
+
+} // namespace sylvester
+
 template<typename F>
-void Sylvester
+SignInfo Sylvester
 ( Int m,
   Matrix<F>& W,
   Matrix<F>& X,
   SignCtrl<Base<F>> ctrl )
 {
     EL_DEBUG_CSE
-    Sign( W, ctrl );
     Matrix<F> WTL, WTR,
               WBL, WBR;
     PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, m );
-    // WTL and WBR should be the positive and negative identity, WBL should be 
-    // zero, and WTR should be -2 X
+    // Only the coupled blocks are iterated on since WBL is assumed to be zero
+    auto info = sylvester::Sign( WTL, WBR, WTR, ctrl );
+    // WTL and WBR should be the positive and negative identity and WTR should
+    // be -2 X
     X = WTR;
     X *= -F(1)/F(2);
-
-    // TODO: Think of how to probe for checks on other quadrants.
-    /*
-    typedef Base<F> Real; 
-    UpdateDiagonal( WTL, F(-1) );
-    const Real errorWTL = FrobeniusNorm( WTL );
-    const Int n = W.Height() - m;
-    UpdateDiagonal( WBR, F(1) );
-    const Real errorWBR = FrobeniusNorm( WBR );
-    const Real errorWBL = FrobeniusNorm( WBL );
-    */
+    return info;
 }
 
 template<typename F>
-void Sylvester
+SignInfo Sylvester
 ( Int m,
   ElementalMatrix<F>& WPre,
   ElementalMatrix<F>& X, 
@@ -61,36 +440,26 @@ void Sylvester
 {
     EL_DEBUG_CSE
 
-    DistMatrixReadProxy<F,F,MC,MR> WProx( WPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> WProx( WPre );
     auto& W = WProx.Get();
 
     const Grid& g = W.Grid();
-    Sign( W, ctrl );
     DistMatrix<F> WTL(g), WTR(g),
                   WBL(g), WBR(g);
     PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, m );
-    // WTL and WBR should be the positive and negative identity, WBL should be 
-    // zero, and WTR should be -2 X
+    // Only the coupled blocks are iterated on since WBL is assumed to be zero
+    auto info = sylvester::Sign( WTL, WBR, WTR, ctrl );
+    // WTL and WBR should be the positive and negative identity and WTR should
+    // be -2 X
     Copy( WTR, X );
     X *= -F(1)/F(2);
-
-    // TODO: Think of how to probe for checks on other quadrants.
-    //       Add UpdateDiagonal routine to avoid explicit identity Axpy?
-    /*
-    typedef Base<F> Real; 
-    UpdateDiagonal( WTL, F(-1) );
-    const Real errorWTL = FrobeniusNorm( WTL );
-    const Int n = W.Height() - m;
-    UpdateDiagonal( WBR, F(1) );
-    const Real errorWBR = FrobeniusNorm( WBR );
-    const Real errorWBL = FrobeniusNorm( WBL );
-    */
+    return info;
 }
 
 template<typename F>
-void Sylvester
+SignInfo Sylvester
 ( const Matrix<F>& A,
   const Matrix<F>& B,
   const Matrix<F>& C,
@@ -106,27 +475,22 @@ void Sylvester
       if( C.Height() != A.Height() || C.Width() != B.Height() )
           LogicError("C must conform with A and B");
     )
-    const Int m = C.Height();
-    const Int n = C.Width();
-    Matrix<F> W, WTL, WTR,
-                 WBL, WBR;
-    W.Resize( m+n, m+n );
-    Zero( W );
-    PartitionDownDiagonal
-    ( W, WTL, WTR,
-         WBL, WBR, m );
-    WTL = A;
-    WBR = B; WBR *= -1;
-    WTR = C; WTR *= -1;
-    Sylvester( m, W, X, ctrl );
+    // Iterate directly on the blocks of W rather than forming it
+    Matrix<F> WTL( A ), WBR( B );
+    WBR *= -1;
+    X = C;
+    X *= -1;
+    auto info = sylvester::Sign( WTL, WBR, X, ctrl );
+    X *= -F(1)/F(2);
+    return info;
 }
 
 template<typename F>
-void Sylvester
+SignInfo Sylvester
 ( const ElementalMatrix<F>& A,
   const ElementalMatrix<F>& B, 
   const ElementalMatrix<F>& C,
-        ElementalMatrix<F>& X, 
+        ElementalMatrix<F>& XPre, 
   SignCtrl<Base<F>> ctrl )
 {
     EL_DEBUG_CSE
@@ -139,40 +503,40 @@ void Sylvester
           LogicError("C must conform with A and B");
       AssertSameGrids( A, B, C );
     )
-    const Int m = C.Height();
-    const Int n = C.Width();
+    DistMatrixWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& X = XProx.Get();
+
+    // Iterate directly on the blocks of W rather than forming it
     const Grid& g = A.Grid();
-    DistMatrix<F> W(g), WTL(g), WTR(g),
-                        WBL(g), WBR(g);
-    W.Resize( m+n, m+n );
-    Zero( W );
-    PartitionDownDiagonal
-    ( W, WTL, WTR,
-         WBL, WBR, m );
-    WTL = A;
-    WBR = B; WBR *= -1;
-    WTR = C; WTR *= -1;
-    Sylvester( m, W, X, ctrl );
+    DistMatrix<F> WTL(g), WBR(g);
+    Copy( A, WTL );
+    Copy( B, WBR );
+    WBR *= -1;
+    Copy( C, X );
+    X *= -1;
+    auto info = sylvester::Sign( WTL, WBR, X, ctrl );
+    X *= -F(1)/F(2);
+    return info;
 }
 
 #define PROTO(F) \
-  template void Sylvester \
+  template SignInfo Sylvester \
   ( Int m, \
     Matrix<F>& W, \
     Matrix<F>& X, \
     SignCtrl<Base<F>> ctrl ); \
-  template void Sylvester \
+  template SignInfo Sylvester \
   ( Int m, \
     ElementalMatrix<F>& W, \
     ElementalMatrix<F>& X, \
     SignCtrl<Base<F>> ctrl ); \
-  template void Sylvester \
+  template SignInfo Sylvester \
   ( const Matrix<F>& A, \
     const Matrix<F>& B, \
     const Matrix<F>& C, \
           Matrix<F>& X, \
     SignCtrl<Base<F>> ctrl ); \
-  template void Sylvester \
+  template SignInfo Sylvester \
   ( const ElementalMatrix<F>& A, \
     const ElementalMatrix<F>& B, \
     const ElementalMatrix<F>& C, \
@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+template<typename T>
+BatchMatrix<T>::BatchMatrix() { }
+
+template<typename T>
+BatchMatrix<T>::BatchMatrix
+( Int height, Int width, Int batchSize, BatchLayout layout )
+: layout_(layout)
+{ Resize( height, width, batchSize ); }
+
+template<typename T>
+void BatchMatrix<T>::Empty()
+{
+    height_ = width_ = batchSize_ = 0;
+    SwapClear( buffer_ );
+}
+
+template<typename T>
+void BatchMatrix<T>::Resize( Int height, Int width, Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( height < 0 || width < 0 || batchSize < 0 )
+          LogicError
+          ("Cannot resize a batch to ",height," x ",width," x ",batchSize);
+    )
+    height_ = height;
+    width_ = width;
+    batchSize_ = batchSize;
+    buffer_.resize( height*width*batchSize );
+}
+
+template<typename T>
+void BatchMatrix<T>::SetLayout( BatchLayout layout )
+{
+    EL_DEBUG_CSE
+    if( layout == layout_ )
+        return;
+    BatchMatrix<T> B( height_, width_, batchSize_, layout );
+    for( Int k=0; k<batchSize_; ++k )
+        for( Int j=0; j<width_; ++j )
+            for( Int i=0; i<height_; ++i )
+                B.buffer_[B.Offset(i,j,k)] = buffer_[Offset(i,j,k)];
+    layout_ = layout;
+    std::swap( buffer_, B.buffer_ );
+}
+
+template<typename T>
+Int BatchMatrix<T>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename T>
+Int BatchMatrix<T>::Width() const EL_NO_EXCEPT { return width_; }
+template<typename T>
+Int BatchMatrix<T>::BatchSize() const EL_NO_EXCEPT { return batchSize_; }
+template<typename T>
+BatchLayout BatchMatrix<T>::Layout() const EL_NO_EXCEPT { return layout_; }
+
+template<typename T>
+Int BatchMatrix<T>::InnerStride() const EL_NO_EXCEPT
+{ return layout_ == BATCH_INTERLEAVED ? batchSize_ : 1; }
+
+template<typename T>
+Int BatchMatrix<T>::LDim() const EL_NO_EXCEPT
+{ return layout_ == BATCH_INTERLEAVED ? batchSize_*height_ : height_; }
+
+template<typename T>
+Int BatchMatrix<T>::BatchStride() const EL_NO_EXCEPT
+{ return layout_ == BATCH_INTERLEAVED ? 1 : height_*width_; }
+
+template<typename T>
+Int BatchMatrix<T>::Offset( Int i, Int j, Int k ) const EL_NO_EXCEPT
+{ return i*InnerStride() + j*LDim() + k*BatchStride(); }
+
+template<typename T>
+T* BatchMatrix<T>::Buffer() EL_NO_EXCEPT { return buffer_.data(); }
+
+template<typename T>
+const T* BatchMatrix<T>::LockedBuffer() const EL_NO_EXCEPT
+{ return buffer_.data(); }
+
+template<typename T>
+T BatchMatrix<T>::Get( Int i, Int j, Int k ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= height_ || j < 0 || j >= width_ ||
+          k < 0 || k >= batchSize_ )
+          LogicError("(",i,",",j,",",k,") is out of bounds");
+    )
+    return buffer_[Offset(i,j,k)];
+}
+
+template<typename T>
+void BatchMatrix<T>::Set( Int i, Int j, Int k, T alpha )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= height_ || j < 0 || j >= width_ ||
+          k < 0 || k >= batchSize_ )
+          LogicError("(",i,",",j,",",k,") is out of bounds");
+    )
+    buffer_[Offset(i,j,k)] = alpha;
+}
+
+template<typename T>
+void BatchMatrix<T>::GetMatrix( Int k, Matrix<T>& A ) const
+{
+    EL_DEBUG_CSE
+    A.Resize( height_, width_ );
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<width_; ++j )
+        for( Int i=0; i<height_; ++i )
+            ABuf[i+j*ALDim] = buffer_[Offset(i,j,k)];
+}
+
+template<typename T>
+void BatchMatrix<T>::SetMatrix( Int k, const Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != height_ || A.Width() != width_ )
+          LogicError
+          ("Expected a ",height_," x ",width_," matrix but received ",
+           A.Height()," x ",A.Width());
+    )
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<width_; ++j )
+        for( Int i=0; i<height_; ++i )
+            buffer_[Offset(i,j,k)] = ABuf[i+j*ALDim];
+}
+
+#define PROTO(T) template class BatchMatrix<T>;
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
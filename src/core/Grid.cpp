@@ -72,13 +72,74 @@ int Grid::DefaultHeight( int gridSize ) EL_NO_EXCEPT
     return gridHeight;
 }
 
-Grid::Grid( mpi::Comm comm, GridOrder order )
-: haveViewers_(false), order_(order)
+int Grid::NodeHeight
+( int gridSize, int nodeSize, GridOrder order ) EL_NO_EXCEPT
+{
+    // The dimension kept within a node must divide both the number of
+    // processes and the node size
+    const int maxLocalDim = El::GCD( gridSize, nodeSize );
+    const int defaultHeight = DefaultHeight( gridSize );
+    const int defaultLocalDim =
+      ( order==COLUMN_MAJOR ? defaultHeight : gridSize/defaultHeight );
+    auto distortion = [&]( int d )
+      { return std::max
+               ( double(d)/defaultLocalDim, double(defaultLocalDim)/d ); };
+    int localDim = 1;
+    for( int d=2; d<=maxLocalDim; ++d )
+        if( maxLocalDim % d == 0 && distortion(d) < distortion(localDim) )
+            localDim = d;
+    return ( order==COLUMN_MAJOR ? localDim : gridSize/localDim );
+}
+
+// Form viewingComm_ from comm, reordering the processes by node (and socket)
+// for NODE_MAPPING. If each node holds the same number of processes, said
+// number is returned through 'nodeSize' (which is otherwise zero).
+void Grid::SetUpViewingComm( mpi::Comm comm, int& nodeSize )
+{
+    EL_DEBUG_CSE
+    nodeSize = 0;
+    if( mapping_ == RANK_MAPPING )
+    {
+        mpi::Dup( comm, viewingComm_ );
+        return;
+    }
+
+    const int commSize = mpi::Size( comm );
+    int myLocality[3] =
+      { mpi::NodeIndex( comm ), mpi::SocketIndex( comm ), mpi::Rank( comm ) };
+    vector<int> localities( 3*commSize );
+    mpi::AllGather( myLocality, 3, localities.data(), 3, comm );
+
+    // Sort the ranks by (node, socket, rank) and use the resulting positions
+    // as the keys for the new ordering
+    vector<int> order( commSize );
+    for( int q=0; q<commSize; ++q )
+        order[q] = q;
+    std::sort
+    ( order.begin(), order.end(),
+      [&]( int a, int b )
+      { return std::lexicographical_compare
+               ( &localities[3*a], &localities[3*a+3],
+                 &localities[3*b], &localities[3*b+3] ); } );
+    int key = 0;
+    while( order[key] != myLocality[2] )
+        ++key;
+    mpi::Split( comm, 0, key, viewingComm_ );
+
+    int numNodes, maxNodeSize;
+    mpi::NodeComposition( comm, numNodes, maxNodeSize );
+    if( numNodes*maxNodeSize == commSize )
+        nodeSize = maxNodeSize;
+}
+
+Grid::Grid( mpi::Comm comm, GridOrder order, GridMapping mapping )
+: haveViewers_(false), order_(order), mapping_(mapping)
 {
     EL_DEBUG_CSE
 
     // Extract our rank, the underlying group, and the number of processes
-    mpi::Dup( comm, viewingComm_ );
+    int nodeSize;
+    SetUpViewingComm( comm, nodeSize );
     mpi::CommGroup( viewingComm_, viewingGroup_ );
     size_ = mpi::Size( viewingComm_ );
 
@@ -86,17 +147,21 @@ Grid::Grid( mpi::Comm comm, GridOrder order )
     owningGroup_ = viewingGroup_;
 
     // Factor p
-    height_ = DefaultHeight( size_ );
+    if( nodeSize > 0 )
+        height_ = NodeHeight( size_, nodeSize, order_ );
+    else
+        height_ = DefaultHeight( size_ );
     SetUpGrid();
 }
 
-Grid::Grid( mpi::Comm comm, int height, GridOrder order )
-: haveViewers_(false), order_(order)
+Grid::Grid( mpi::Comm comm, int height, GridOrder order, GridMapping mapping )
+: haveViewers_(false), order_(order), mapping_(mapping)
 {
     EL_DEBUG_CSE
 
     // Extract our rank, the underlying group, and the number of processes
-    mpi::Dup( comm, viewingComm_ );
+    int nodeSize;
+    SetUpViewingComm( comm, nodeSize );
     mpi::CommGroup( viewingComm_, viewingGroup_ );
     size_ = mpi::Size( viewingComm_ );
 
@@ -300,6 +365,7 @@ int Grid::Size()   const EL_NO_EXCEPT { return VCSize(); }
 int Grid::Rank()   const EL_NO_RELEASE_EXCEPT { return OwningRank(); }
 
 GridOrder Grid::Order() const EL_NO_EXCEPT { return order_; }
+GridMapping Grid::Mapping() const EL_NO_EXCEPT { return mapping_; }
 
 int Grid::Row() const EL_NO_RELEASE_EXCEPT { return MCRank(); }
 int Grid::Col() const EL_NO_RELEASE_EXCEPT { return MRRank(); }
@@ -313,7 +379,7 @@ mpi::Comm Grid::Comm() const EL_NO_EXCEPT
 
 // Currently forces a columnMajor absolute rank on the grid
 Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
-: haveViewers_(true), order_(order)
+: haveViewers_(true), order_(order), mapping_(RANK_MAPPING)
 {
     EL_DEBUG_CSE
 
@@ -457,6 +523,29 @@ int Grid::BlacsVRHandle() const { return blacsVRHandle_; }
 int Grid::BlacsMCMRContext() const { return blacsMCMRContext_; }
 #endif
 
+void PrintNodeComposition( const Grid& grid, ostream& os )
+{
+    EL_DEBUG_CSE
+    if( !grid.InGrid() )
+        return;
+    const std::pair<string,mpi::Comm> comms[] =
+      { {"MC",grid.MCComm()}, {"MR",grid.MRComm()},
+        {"MD",grid.MDComm()}, {"MDPerp",grid.MDPerpComm()},
+        {"VC",grid.VCComm()} };
+    for( const auto& pair : comms )
+    {
+        int composition[2];
+        mpi::NodeComposition
+        ( pair.second, composition[0], composition[1] );
+        mpi::AllReduce( composition, 2, mpi::MAX, grid.VCComm() );
+        if( grid.VCRank() == 0 )
+            os << pair.first << ": " << mpi::Size(pair.second)
+               << " processes spanning " << composition[0]
+               << " node(s) with at most " << composition[1]
+               << " per node" << std::endl;
+    }
+}
+
 // Comparison functions
 // ====================
 
@@ -197,6 +197,13 @@ void Initialize( int& argc, char**& argv )
     mpi::CreateCustom();
 }
 
+void Initialize( int& argc, char**& argv, const ThreadingCtrl& threadingCtrl )
+{
+    Initialize( argc, argv );
+    SetNumBlasThreads( threadingCtrl.numBlasThreads );
+    SetNumLoopThreads( threadingCtrl.numLoopThreads );
+}
+
 void Finalize()
 {
     EL_DEBUG_CSE
@@ -228,6 +235,7 @@ void Finalize()
 
 
         EmptyBlocksizeStack();
+        EmptyThreadingCtrlStack();
 
 #ifdef EL_HAVE_QD
         FinalizeQD();
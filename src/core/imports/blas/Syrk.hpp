@@ -274,8 +274,9 @@ void Herk
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+    const char transFixed = ( std::toupper(trans) == 'T' ? 'C' : trans );
     EL_BLAS(cherk)
-    ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
+    ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
 
 void Herk
@@ -286,8 +287,9 @@ void Herk
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    const char transFixed = ( std::toupper(trans) == 'T' ? 'C' : trans );
     EL_BLAS(zherk)
-    ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
+    ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
 
 template<typename T>
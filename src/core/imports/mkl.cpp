@@ -154,11 +154,20 @@ void EL_BLAS(zgemmt)
         dcomplex* C, const BlasInt* CLDim );
 #endif
 
+void MKL_Set_Num_Threads( int numThreads );
+int MKL_Get_Max_Threads();
+
 } // extern "C"
 
 namespace El {
 namespace mkl {
 
+void SetNumThreads( int numThreads )
+{ MKL_Set_Num_Threads( numThreads ); }
+
+int NumThreads()
+{ return MKL_Get_Max_Threads(); }
+
 // TODO: Ensure that BlasInt is compatible with MKL_INT in the following
 //       routines
 
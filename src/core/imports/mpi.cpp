@@ -78,8 +78,13 @@ int InitializeThread( int& argc, char**& argv, int required ) EL_NO_EXCEPT
     return provided;
 }
 
+namespace { void FreeNodeTopologies(); }
+
 void Finalize() EL_NO_EXCEPT
-{ MPI_Finalize(); }
+{
+    FreeNodeTopologies();
+    MPI_Finalize();
+}
 
 bool Initialized() EL_NO_EXCEPT
 {
@@ -546,6 +551,464 @@ int GetCount( Status& status ) EL_NO_RELEASE_EXCEPT
     return count;
 }
 
+// Node-aware collectives
+// ======================
+
+namespace {
+
+bool nodeAwareCollectives = false;
+
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+
+// The node layout of a communicator and the shared-memory window used for the
+// intra-node stages of its collectives
+struct NodeTopology
+{
+    // The processes of comm which share this process's node and the
+    // processes with rank zero within their node (on said processes)
+    MPI_Comm nodeComm=MPI_COMM_NULL;
+    MPI_Comm leaderComm=MPI_COMM_NULL;
+    int nodeRank, nodeSize, nodeIndex;
+    int numNodes, maxNodeSize;
+
+    // The processes ordered by node (and then by rank within their node):
+    // node k owns positions [nodeOffsets[k],nodeOffsets[k+1]) and
+    // commRanks[pos] is the rank in comm of the process at position pos
+    vector<int> nodeOffsets, commRanks;
+
+    // The window is split in two halves which successive collectives
+    // alternate between so that a collective only needs to synchronize
+    // before its results are read (and not after)
+    MPI_Win window=MPI_WIN_NULL;
+    byte* buffer=nullptr;
+    size_t halfSize=0;
+    int parity=0;
+};
+
+int nodeTopologyKeyval = MPI_KEYVAL_INVALID;
+
+int FreeNodeTopology
+( MPI_Comm comm, int keyval, void* attribute, void* extraState )
+{
+    auto topology = static_cast<NodeTopology*>(attribute);
+    if( topology->window != MPI_WIN_NULL )
+    {
+        MPI_Win_unlock_all( topology->window );
+        MPI_Win_free( &topology->window );
+    }
+    if( topology->leaderComm != MPI_COMM_NULL )
+        MPI_Comm_free( &topology->leaderComm );
+    MPI_Comm_free( &topology->nodeComm );
+    delete topology;
+    return MPI_SUCCESS;
+}
+
+// Return the (cached) node layout of comm, which is collectively formed the
+// first time it is requested
+NodeTopology& GetNodeTopology( MPI_Comm comm )
+{
+    EL_DEBUG_CSE
+    if( nodeTopologyKeyval == MPI_KEYVAL_INVALID )
+        SafeMpi
+        ( MPI_Comm_create_keyval
+          ( MPI_COMM_NULL_COPY_FN, FreeNodeTopology, &nodeTopologyKeyval,
+            nullptr ) );
+    void* attribute;
+    int found;
+    SafeMpi
+    ( MPI_Comm_get_attr( comm, nodeTopologyKeyval, &attribute, &found ) );
+    if( found )
+        return *static_cast<NodeTopology*>(attribute);
+
+    auto topology = new NodeTopology;
+    int commRank, commSize;
+    SafeMpi( MPI_Comm_rank( comm, &commRank ) );
+    SafeMpi( MPI_Comm_size( comm, &commSize ) );
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm, MPI_COMM_TYPE_SHARED, commRank, MPI_INFO_NULL,
+        &topology->nodeComm ) );
+    SafeMpi( MPI_Comm_rank( topology->nodeComm, &topology->nodeRank ) );
+    SafeMpi( MPI_Comm_size( topology->nodeComm, &topology->nodeSize ) );
+    const bool leader = ( topology->nodeRank == 0 );
+    SafeMpi
+    ( MPI_Comm_split
+      ( comm, leader ? 0 : MPI_UNDEFINED, commRank, &topology->leaderComm ) );
+
+    // Number the nodes by the ranks of their leaders within leaderComm
+    topology->nodeIndex = 0;
+    if( leader )
+        SafeMpi( MPI_Comm_rank( topology->leaderComm, &topology->nodeIndex ) );
+    SafeMpi
+    ( MPI_Bcast( &topology->nodeIndex, 1, MPI_INT, 0, topology->nodeComm ) );
+    vector<int> nodeIndices( commSize );
+    SafeMpi
+    ( MPI_Allgather
+      ( &topology->nodeIndex, 1, MPI_INT, nodeIndices.data(), 1, MPI_INT,
+        comm ) );
+
+    topology->numNodes = 0;
+    for( int q=0; q<commSize; ++q )
+        topology->numNodes = Max( topology->numNodes, nodeIndices[q]+1 );
+    topology->nodeOffsets.assign( topology->numNodes+1, 0 );
+    for( int q=0; q<commSize; ++q )
+        ++topology->nodeOffsets[nodeIndices[q]+1];
+    topology->maxNodeSize = 0;
+    for( int k=0; k<topology->numNodes; ++k )
+    {
+        topology->maxNodeSize =
+          Max( topology->maxNodeSize, topology->nodeOffsets[k+1] );
+        topology->nodeOffsets[k+1] += topology->nodeOffsets[k];
+    }
+    // Since the node communicators were ordered by rank in comm, so are the
+    // processes of each node
+    vector<int> offsets( topology->nodeOffsets );
+    topology->commRanks.resize( commSize );
+    for( int q=0; q<commSize; ++q )
+        topology->commRanks[offsets[nodeIndices[q]]++] = q;
+
+    SafeMpi( MPI_Comm_set_attr( comm, nodeTopologyKeyval, topology ) );
+    return *topology;
+}
+
+// Return the half of the node's shared window for the next collective after
+// ensuring that it holds at least 'numBytes' bytes
+byte* SharedBuffer( NodeTopology& topology, size_t numBytes )
+{
+    EL_DEBUG_CSE
+    if( numBytes > topology.halfSize )
+    {
+        if( topology.window != MPI_WIN_NULL )
+        {
+            SafeMpi( MPI_Win_unlock_all( topology.window ) );
+            SafeMpi( MPI_Win_free( &topology.window ) );
+        }
+        topology.halfSize = Max( numBytes, 2*topology.halfSize );
+
+        // Allocate the entire window on the node leader so that it is
+        // contiguous
+        const MPI_Aint localSize =
+          ( topology.nodeRank == 0 ? 2*topology.halfSize : 0 );
+        byte* localBuffer;
+        SafeMpi
+        ( MPI_Win_allocate_shared
+          ( localSize, 1, MPI_INFO_NULL, topology.nodeComm, &localBuffer,
+            &topology.window ) );
+        MPI_Aint size;
+        int dispUnit;
+        SafeMpi
+        ( MPI_Win_shared_query
+          ( topology.window, 0, &size, &dispUnit, &topology.buffer ) );
+        SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, topology.window ) );
+        topology.parity = 0;
+    }
+    byte* buffer = topology.buffer + topology.parity*topology.halfSize;
+    topology.parity = 1 - topology.parity;
+    return buffer;
+}
+
+// Make the writes of each process on the node to the shared window visible to
+// the others
+void NodeSync( NodeTopology& topology )
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Win_sync( topology.window ) );
+    SafeMpi( MPI_Barrier( topology.nodeComm ) );
+    SafeMpi( MPI_Win_sync( topology.window ) );
+}
+
+bool UseNodeAware( Comm comm )
+{
+    if( !nodeAwareCollectives || comm == COMM_NULL || Size(comm) <= 2 )
+        return false;
+    return GetNodeTopology( comm.comm ).maxNodeSize > 1;
+}
+
+// The node leaders exchange their blocks with int byte counts and
+// displacements, and so the flat collectives are used when the exchanged
+// extent would overflow them
+bool FitsInInt( size_t numBytes )
+{ return numBytes <= size_t(std::numeric_limits<int>::max()); }
+#else
+bool UseNodeAware( Comm ) { return false; }
+#endif // ifdef EL_HAVE_MPI3_SHARED_MEMORY
+
+// Some MPI implementations only delete the attributes of the predefined
+// communicators after they have begun tearing down the windows, and so the
+// cached layouts of said communicators are released before MPI_Finalize
+void FreeNodeTopologies()
+{
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    if( nodeTopologyKeyval == MPI_KEYVAL_INVALID )
+        return;
+    for( MPI_Comm comm : { MPI_COMM_WORLD, MPI_COMM_SELF } )
+    {
+        void* attribute;
+        int found;
+        MPI_Comm_get_attr( comm, nodeTopologyKeyval, &attribute, &found );
+        if( found )
+            MPI_Comm_delete_attr( comm, nodeTopologyKeyval );
+    }
+    MPI_Comm_free_keyval( &nodeTopologyKeyval );
+#endif
+}
+
+// Only the built-in operations are known to be commutative, which the
+// reordering of the hierarchical reductions requires
+bool UseNodeAware( Comm comm, Op op )
+{
+    if( op != SUM && op != PROD && op != MAX && op != MIN )
+        return false;
+    return UseNodeAware( comm );
+}
+
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+// Each process contributes 'numBytes' bytes and receives the contributions
+// ordered by rank in comm. False is returned (without communicating) if the
+// flat collective must be used instead.
+bool NodeAwareAllGather
+( const void* sbuf, void* rbuf, size_t numBytes, Comm comm )
+{
+    EL_DEBUG_CSE
+    auto& topology = GetNodeTopology( comm.comm );
+    const int commSize = topology.commRanks.size();
+    if( !FitsInInt( size_t(commSize)*numBytes ) )
+        return false;
+    byte* shared = SharedBuffer( topology, commSize*numBytes );
+
+    // Place the contribution within its node's (contiguous) block
+    const int pos =
+      topology.nodeOffsets[topology.nodeIndex] + topology.nodeRank;
+    MemCopy
+    ( shared+pos*numBytes, static_cast<const byte*>(sbuf), numBytes );
+    NodeSync( topology );
+
+    // Exchange the node blocks between the node leaders
+    if( topology.numNodes > 1 )
+    {
+        if( topology.leaderComm != MPI_COMM_NULL )
+        {
+            const int numNodes = topology.numNodes;
+            vector<int> counts( numNodes ), displs( numNodes );
+            for( int k=0; k<numNodes; ++k )
+            {
+                displs[k] = topology.nodeOffsets[k]*numBytes;
+                counts[k] = topology.nodeOffsets[k+1]*numBytes - displs[k];
+            }
+            SafeMpi
+            ( MPI_Allgatherv
+              ( MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
+                shared, counts.data(), displs.data(), MPI_BYTE,
+                topology.leaderComm ) );
+        }
+        NodeSync( topology );
+    }
+
+    auto recvBuf = static_cast<byte*>(rbuf);
+    for( int q=0; q<commSize; ++q )
+        MemCopy
+        ( recvBuf+topology.commRanks[q]*numBytes, shared+q*numBytes,
+          numBytes );
+    return true;
+}
+
+// Each process sends 'numBytes' bytes to every process in comm. False is
+// returned (without communicating) if the flat collective must be used
+// instead.
+bool NodeAwareAllToAll
+( const void* sbuf, void* rbuf, size_t numBytes, Comm comm )
+{
+    EL_DEBUG_CSE
+    auto& topology = GetNodeTopology( comm.comm );
+    const int commSize = topology.commRanks.size();
+    // The largest node size (rather than that of this node) keeps the
+    // decision consistent across the nodes
+    if( !FitsInInt( size_t(topology.maxNodeSize)*commSize*numBytes ) )
+        return false;
+    const int numNodes = topology.numNodes;
+    const int nodeSize = topology.nodeSize;
+    const size_t blockSize = size_t(nodeSize)*commSize*numBytes;
+    byte* sendShared = SharedBuffer( topology, 2*blockSize );
+    byte* recvShared = sendShared + blockSize;
+
+    // The data sent from this node to node k is stored contiguously in the
+    // order (source within this node, destination within node k), and the
+    // data received from node k in the order (source within node k,
+    // destination within this node)
+    vector<size_t> sendOffsets( numNodes ), recvOffsets( numNodes );
+    for( int k=0; k<numNodes; ++k )
+    {
+        sendOffsets[k] = size_t(nodeSize)*topology.nodeOffsets[k]*numBytes;
+        recvOffsets[k] = size_t(topology.nodeOffsets[k])*nodeSize*numBytes;
+    }
+
+    auto sendBuf = static_cast<const byte*>(sbuf);
+    for( int k=0; k<numNodes; ++k )
+    {
+        const int kOff = topology.nodeOffsets[k];
+        const int kSize = topology.nodeOffsets[k+1] - kOff;
+        for( int j=0; j<kSize; ++j )
+            MemCopy
+            ( sendShared+sendOffsets[k]+
+              (size_t(topology.nodeRank)*kSize+j)*numBytes,
+              sendBuf+size_t(topology.commRanks[kOff+j])*numBytes,
+              numBytes );
+    }
+    NodeSync( topology );
+
+    if( numNodes == 1 )
+    {
+        // The send blocks are already in place
+        recvShared = sendShared;
+    }
+    else
+    {
+        if( topology.leaderComm != MPI_COMM_NULL )
+        {
+            vector<int> sendCounts( numNodes ), sendDispls( numNodes ),
+                        recvCounts( numNodes ), recvDispls( numNodes );
+            for( int k=0; k<numNodes; ++k )
+            {
+                const int kSize =
+                  topology.nodeOffsets[k+1] - topology.nodeOffsets[k];
+                sendCounts[k] = nodeSize*kSize*numBytes;
+                sendDispls[k] = sendOffsets[k];
+                recvCounts[k] = kSize*nodeSize*numBytes;
+                recvDispls[k] = recvOffsets[k];
+            }
+            SafeMpi
+            ( MPI_Alltoallv
+              ( sendShared, sendCounts.data(), sendDispls.data(), MPI_BYTE,
+                recvShared, recvCounts.data(), recvDispls.data(), MPI_BYTE,
+                topology.leaderComm ) );
+        }
+        NodeSync( topology );
+    }
+
+    auto recvBuf = static_cast<byte*>(rbuf);
+    for( int k=0; k<numNodes; ++k )
+    {
+        const int kOff = topology.nodeOffsets[k];
+        const int kSize = topology.nodeOffsets[k+1] - kOff;
+        for( int i=0; i<kSize; ++i )
+            MemCopy
+            ( recvBuf+size_t(topology.commRanks[kOff+i])*numBytes,
+              recvShared+recvOffsets[k]+
+              (size_t(i)*nodeSize+topology.nodeRank)*numBytes,
+              numBytes );
+    }
+    return true;
+}
+
+// Reduce 'count' entries of the given type, where sbuf may equal rbuf
+void NodeAwareAllReduce
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  Comm comm )
+{
+    EL_DEBUG_CSE
+    auto& topology = GetNodeTopology( comm.comm );
+    const int nodeSize = topology.nodeSize;
+    const int nodeRank = topology.nodeRank;
+    int typeSize;
+    SafeMpi( MPI_Type_size( type, &typeSize ) );
+    const size_t numBytes = size_t(count)*typeSize;
+    byte* shared = SharedBuffer( topology, nodeSize*numBytes );
+
+    MemCopy
+    ( shared+nodeRank*numBytes, static_cast<const byte*>(sbuf), numBytes );
+    NodeSync( topology );
+
+    // Each process reduces a slice of the node's contributions into the
+    // first contribution
+    const int sliceBeg = (size_t(count)*nodeRank) / nodeSize;
+    const int sliceEnd = (size_t(count)*(nodeRank+1)) / nodeSize;
+    if( sliceEnd > sliceBeg )
+        for( int p=1; p<nodeSize; ++p )
+            SafeMpi
+            ( MPI_Reduce_local
+              ( shared+p*numBytes+size_t(sliceBeg)*typeSize,
+                shared+size_t(sliceBeg)*typeSize,
+                sliceEnd-sliceBeg, type, op ) );
+    NodeSync( topology );
+
+    if( topology.numNodes > 1 )
+    {
+        if( topology.leaderComm != MPI_COMM_NULL )
+            SafeMpi
+            ( MPI_Allreduce
+              ( MPI_IN_PLACE, shared, count, type, op,
+                topology.leaderComm ) );
+        NodeSync( topology );
+    }
+    MemCopy( static_cast<byte*>(rbuf), shared, numBytes );
+}
+#else
+// UseNodeAware always returns false without MPI-3 shared memory
+bool NodeAwareAllGather( const void*, void*, size_t, Comm )
+{ return false; }
+bool NodeAwareAllToAll( const void*, void*, size_t, Comm )
+{ return false; }
+void NodeAwareAllReduce( const void*, void*, int, MPI_Datatype, MPI_Op, Comm )
+{ LogicError("Node-aware collectives require MPI-3 shared memory"); }
+#endif // ifdef EL_HAVE_MPI3_SHARED_MEMORY
+
+} // anonymous namespace
+
+void SetNodeAwareCollectives( bool nodeAware ) EL_NO_EXCEPT
+{ nodeAwareCollectives = nodeAware; }
+
+bool NodeAwareCollectives() EL_NO_EXCEPT
+{ return nodeAwareCollectives; }
+
+void NodeComposition( Comm comm, int& numNodes, int& maxNodeSize )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    const auto& topology = GetNodeTopology( comm.comm );
+    numNodes = topology.numNodes;
+    maxNodeSize = topology.maxNodeSize;
+#else
+    // Without MPI_Comm_split_type, each process is treated as its own node
+    numNodes = Size( comm );
+    maxNodeSize = 1;
+#endif
+}
+
+int NodeIndex( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    return GetNodeTopology( comm.comm ).nodeIndex;
+#else
+    return Rank( comm );
+#endif
+}
+
+int SocketIndex( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#if defined(EL_HAVE_MPI3_SHARED_MEMORY) && \
+    defined(EL_HAVE_OMPI_COMM_TYPE_SOCKET)
+    const auto& topology = GetNodeTopology( comm.comm );
+    MPI_Comm socketComm;
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( topology.nodeComm, OMPI_COMM_TYPE_SOCKET, topology.nodeRank,
+        MPI_INFO_NULL, &socketComm ) );
+    // Label each socket by the smallest node rank placed upon it
+    int socketIndex;
+    SafeMpi
+    ( MPI_Allreduce
+      ( const_cast<int*>(&topology.nodeRank), &socketIndex, 1, MPI_INT,
+        MPI_MIN, socketComm ) );
+    SafeMpi( MPI_Comm_free( &socketComm ) );
+    return socketIndex;
+#else
+    return 0;
+#endif
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
@@ -1416,6 +1879,9 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( sc == rc && UseNodeAware(comm) &&
+        NodeAwareAllGather( sbuf, rbuf, sizeof(Real)*sc, comm ) )
+        return;
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1440,6 +1906,9 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( sc == rc && UseNodeAware(comm) &&
+        NodeAwareAllGather( sbuf, rbuf, sizeof(Complex<Real>)*sc, comm ) )
+        return;
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1760,6 +2229,9 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( sc == rc && UseNodeAware(comm) &&
+        NodeAwareAllToAll( sbuf, rbuf, sizeof(Real)*sc, comm ) )
+        return;
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1774,6 +2246,9 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( sc == rc && UseNodeAware(comm) &&
+        NodeAwareAllToAll( sbuf, rbuf, sizeof(Complex<Real>)*sc, comm ) )
+        return;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -2154,6 +2629,11 @@ EL_NO_RELEASE_EXCEPT
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
+        if( UseNodeAware(comm,op) )
+        {
+            NodeAwareAllReduce( sbuf, rbuf, count, TypeMap<Real>(), opC, comm );
+            return;
+        }
         SafeMpi
         ( MPI_Allreduce
           ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
@@ -2170,6 +2650,20 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( count != 0 )
     {
+        if( UseNodeAware(comm,op) )
+        {
+#ifdef EL_AVOID_COMPLEX_MPI
+            if( op == SUM )
+                NodeAwareAllReduce
+                ( sbuf, rbuf, 2*count, TypeMap<Real>(), NativeOp<Real>(op),
+                  comm );
+            else
+#endif
+                NodeAwareAllReduce
+                ( sbuf, rbuf, count, TypeMap<Complex<Real>>(),
+                  NativeOp<Complex<Real>>(op), comm );
+            return;
+        }
 #ifdef EL_AVOID_COMPLEX_MPI
         if( op == SUM )
         {
@@ -2245,6 +2739,11 @@ EL_NO_RELEASE_EXCEPT
         return;
 
     MPI_Op opC = NativeOp<Real>( op );
+    if( UseNodeAware(comm,op) )
+    {
+        NodeAwareAllReduce( buf, buf, count, TypeMap<Real>(), opC, comm );
+        return;
+    }
     SafeMpi
     ( MPI_Allreduce
       ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
@@ -2259,6 +2758,19 @@ EL_NO_RELEASE_EXCEPT
     if( count == 0 || Size(comm) == 1 )
         return;
 
+    if( UseNodeAware(comm,op) )
+    {
+#ifdef EL_AVOID_COMPLEX_MPI
+        if( op == SUM )
+            NodeAwareAllReduce
+            ( buf, buf, 2*count, TypeMap<Real>(), NativeOp<Real>(op), comm );
+        else
+#endif
+            NodeAwareAllReduce
+            ( buf, buf, count, TypeMap<Complex<Real>>(),
+              NativeOp<Complex<Real>>(op), comm );
+        return;
+    }
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -2311,6 +2823,88 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 || Size(comm) == 1 )
+        return;
+
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    AllReduce( buf, count, op, comm );
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 || Size(comm) == 1 )
+        return;
+
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        SafeMpi
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
+            comm.comm, &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
+        comm.comm, &request.backend ) );
+#endif
+#else
+    AllReduce( buf, count, op, comm );
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce( T* buf, int count, Op op, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    // The serialized buffers would need to outlive this call, so the
+    // reduction is simply performed in a blocking manner
+    request.backend = MPI_REQUEST_NULL;
+    AllReduce( buf, count, op, comm );
+}
+
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{ IAllReduce( buf, count, SUM, comm, request ); }
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
@@ -2991,6 +3585,12 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce( T* buf, int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce \
+  ( T* buf, int count, Op op, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce \
+  ( T* buf, int count, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm ) \
@@ -15,6 +15,9 @@ using El::dcomplex;
 
 extern "C" {
 
+void openblas_set_num_threads( int numThreads );
+int openblas_get_num_threads();
+
 // The following routines seem to not be defined by the shared library on Mac OS X.
 // Further, there appear to be open bugs with OpenBLAS's imatcopy:
 // https://github.com/xianyi/OpenBLAS/issues/899
@@ -66,6 +69,12 @@ void EL_BLAS(zimatcopy)
 namespace El {
 namespace openblas {
 
+void SetNumThreads( int numThreads )
+{ openblas_set_num_threads( numThreads ); }
+
+int NumThreads()
+{ return openblas_get_num_threads(); }
+
 /*
 void omatcopy
 ( Orientation orientation, BlasInt m, BlasInt n,
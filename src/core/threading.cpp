@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <stack>
+
+#ifdef EL_HAVE_BLIS_LAPACK
+extern "C" {
+// BLIS's dim_t is a 64-bit integer by default
+void bli_thread_set_num_threads( long long numThreads );
+long long bli_thread_get_num_threads();
+} // extern "C"
+#endif
+
+namespace {
+using namespace El;
+
+std::stack<ThreadingCtrl> threadingCtrlStack;
+
+// A nonpositive value implies that all of the OpenMP threads should be used
+Int numLoopThreads = 0;
+
+}
+
+namespace El {
+
+Int MaxThreads()
+{
+#ifdef EL_HYBRID
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+Int NumBlasThreads()
+{
+#if defined(EL_HAVE_MKL)
+    return mkl::NumThreads();
+#elif defined(EL_HAVE_OPENBLAS)
+    return openblas::NumThreads();
+#elif defined(EL_HAVE_BLIS_LAPACK)
+    return bli_thread_get_num_threads();
+#else
+    return 1;
+#endif
+}
+
+void SetNumBlasThreads( Int numThreads )
+{
+    EL_DEBUG_CSE
+    if( numThreads <= 0 )
+        return;
+#if defined(EL_HAVE_MKL)
+    mkl::SetNumThreads( numThreads );
+#elif defined(EL_HAVE_OPENBLAS)
+    openblas::SetNumThreads( numThreads );
+#elif defined(EL_HAVE_BLIS_LAPACK)
+    bli_thread_set_num_threads( numThreads );
+#endif
+}
+
+Int NumLoopThreads()
+{ return ::numLoopThreads > 0 ? ::numLoopThreads : MaxThreads(); }
+
+void SetNumLoopThreads( Int numThreads )
+{
+    EL_DEBUG_CSE
+    if( numThreads <= 0 )
+        return;
+    ::numLoopThreads = Min( numThreads, MaxThreads() );
+}
+
+// NOTE: The stored (rather than resolved) number of loop threads is returned
+// so that a default policy survives being pushed and popped
+ThreadingCtrl CurrentThreadingCtrl()
+{
+    ThreadingCtrl ctrl;
+    ctrl.numBlasThreads = NumBlasThreads();
+    ctrl.numLoopThreads = ::numLoopThreads;
+    return ctrl;
+}
+
+void PushThreadingCtrl( const ThreadingCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    // Save the current policy so that it can be restored upon popping
+    ::threadingCtrlStack.push( CurrentThreadingCtrl() );
+    SetNumBlasThreads( ctrl.numBlasThreads );
+    SetNumLoopThreads( ctrl.numLoopThreads );
+}
+
+void PopThreadingCtrl()
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( ::threadingCtrlStack.empty() )
+          LogicError("Attempted to pop an empty threading policy stack");
+    )
+    const ThreadingCtrl ctrl = ::threadingCtrlStack.top();
+    ::threadingCtrlStack.pop();
+    SetNumBlasThreads( ctrl.numBlasThreads );
+    // Restore the stored value directly, as a nonpositive value (which
+    // SetNumLoopThreads ignores) means that all OpenMP threads are used
+    ::numLoopThreads = ctrl.numLoopThreads;
+}
+
+void EmptyThreadingCtrlStack()
+{
+    while( !::threadingCtrlStack.empty() )
+        PopThreadingCtrl();
+}
+
+} // namespace El
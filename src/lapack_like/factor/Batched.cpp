@@ -0,0 +1,212 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace batched {
+
+// As in the batched BLAS kernels, entry (i,j) of member t of A is stored at
+// A[i*ARS+j*ACS+t*ABS] and the innermost loops run over the batch.
+
+// Left-looking computation of A = L L^H, where only the lower triangle of
+// A(i,j) = A[i*ARS+j*ACS] is accessed
+template<Int N,typename Field>
+void LowerCholeskyKernel
+( Int nA, Int numMembers, Field* A, Int ARS, Int ACS, Int ABS )
+{
+    typedef Base<Field> Real;
+    const Int n = ( N > 0 ? N : nA );
+    for( Int j=0; j<n; ++j )
+    {
+        // A(j:n-1,j) -= A(j:n-1,0:j-1) A(j,0:j-1)^H
+        for( Int l=0; l<j; ++l )
+        {
+            const Field* ajl = &A[j*ARS+l*ACS];
+            for( Int i=j; i<n; ++i )
+            {
+                      Field* aij = &A[i*ARS+j*ACS];
+                const Field* ail = &A[i*ARS+l*ACS];
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                    aij[t*ABS] -= ail[t*ABS]*Conj(ajl[t*ABS]);
+            }
+        }
+
+        // A(j,j) := sqrt(A(j,j)), which is NaN if A(j,j) < 0
+        Field* ajj = &A[j*ARS+j*ACS];
+        EL_SIMD
+        for( Int t=0; t<numMembers; ++t )
+            ajj[t*ABS] = Sqrt( RealPart(ajj[t*ABS]) );
+
+        // A(j+1:n-1,j) /= A(j,j)
+        for( Int i=j+1; i<n; ++i )
+        {
+            Field* aij = &A[i*ARS+j*ACS];
+            EL_SIMD
+            for( Int t=0; t<numMembers; ++t )
+            {
+                const Real delta = RealPart(ajj[t*ABS]);
+                aij[t*ABS] /= delta;
+            }
+        }
+    }
+}
+
+// Right-looking LU with partial pivoting. The pivot searches and row swaps
+// are performed member-by-member, whereas the rank-one updates are
+// vectorized across the batch.
+template<Int N,typename Field>
+void LUKernel
+( Int mA, Int nA, Int numMembers,
+  Field* A, Int ARS, Int ACS, Int ABS,
+  Int* pivots, Int pivotLDim )
+{
+    typedef Base<Field> Real;
+    const Int m = ( N > 0 ? N : mA );
+    const Int n = ( N > 0 ? N : nA );
+    const Int minDim = Min(m,n);
+    for( Int j=0; j<minDim; ++j )
+    {
+        for( Int t=0; t<numMembers; ++t )
+        {
+            Field* At = &A[t*ABS];
+            Int iPiv = j;
+            Real maxAbs = OneAbs(At[j*ARS+j*ACS]);
+            for( Int i=j+1; i<m; ++i )
+            {
+                const Real absVal = OneAbs(At[i*ARS+j*ACS]);
+                if( absVal > maxAbs )
+                {
+                    iPiv = i;
+                    maxAbs = absVal;
+                }
+            }
+            pivots[j+t*pivotLDim] = iPiv;
+            if( iPiv != j )
+                for( Int c=0; c<n; ++c )
+                    std::swap( At[j*ARS+c*ACS], At[iPiv*ARS+c*ACS] );
+        }
+
+        // A(j+1:m-1,j) /= A(j,j) (unless the pivot is exactly zero)
+        const Field* ajj = &A[j*ARS+j*ACS];
+        for( Int i=j+1; i<m; ++i )
+        {
+            Field* aij = &A[i*ARS+j*ACS];
+            EL_SIMD
+            for( Int t=0; t<numMembers; ++t )
+            {
+                const Field delta = ajj[t*ABS];
+                aij[t*ABS] = ( delta != Field(0) ? aij[t*ABS]/delta
+                                                 : aij[t*ABS] );
+            }
+        }
+
+        // A(j+1:m-1,j+1:n-1) -= A(j+1:m-1,j) A(j,j+1:n-1)
+        for( Int c=j+1; c<n; ++c )
+        {
+            const Field* ajc = &A[j*ARS+c*ACS];
+            for( Int i=j+1; i<m; ++i )
+            {
+                      Field* aic = &A[i*ARS+c*ACS];
+                const Field* aij = &A[i*ARS+j*ACS];
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                    aic[t*ABS] -= aij[t*ABS]*ajc[t*ABS];
+            }
+        }
+    }
+}
+
+template<typename Field>
+void Cholesky( UpperOrLower uplo, BatchMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Batched Cholesky requires square matrices");
+    )
+    const Int n = A.Height();
+    const Int batchSize = A.BatchSize();
+    const Int ABS = A.BatchStride();
+    // The upper-triangular case, A = U^H U, is the lower-triangular
+    // factorization of the (conjugate) transpose, which is exposed by
+    // swapping the row and column strides
+    const Int ARS = ( uplo == LOWER ? A.InnerStride() : A.LDim() );
+    const Int ACS = ( uplo == LOWER ? A.LDim() : A.InnerStride() );
+    Field* ABuf = A.Buffer();
+
+    const Int numChunks = (batchSize+CHUNK_SIZE-1) / CHUNK_SIZE;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int kBeg = chunk*CHUNK_SIZE;
+        const Int numMembers = Min( CHUNK_SIZE, batchSize-kBeg );
+        EL_BATCH_DISPATCH
+        ( n, LowerCholeskyKernel,
+          n, numMembers, &ABuf[kBeg*ABS], ARS, ACS, ABS )
+    }
+
+    // Exceptions cannot escape the threaded loop, so the (non-positive or
+    // NaN) pivots are detected afterwards
+    for( Int k=0; k<batchSize; ++k )
+        for( Int j=0; j<n; ++j )
+            if( !(RealPart(A.Get(j,j,k)) > Base<Field>(0)) )
+                throw NonHPDMatrixException();
+}
+
+template<typename Field>
+void LU( BatchMatrix<Field>& A, Matrix<Int>& pivots )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int batchSize = A.BatchSize();
+    const Int ARS = A.InnerStride();
+    const Int ACS = A.LDim();
+    const Int ABS = A.BatchStride();
+    Field* ABuf = A.Buffer();
+    pivots.Resize( Min(m,n), batchSize );
+    Int* pivotBuf = pivots.Buffer();
+    const Int pivotLDim = pivots.LDim();
+
+    const Int numChunks = (batchSize+CHUNK_SIZE-1) / CHUNK_SIZE;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int kBeg = chunk*CHUNK_SIZE;
+        const Int numMembers = Min( CHUNK_SIZE, batchSize-kBeg );
+        if( m == n )
+        {
+            EL_BATCH_DISPATCH
+            ( n, LUKernel,
+              m, n, numMembers, &ABuf[kBeg*ABS], ARS, ACS, ABS,
+              &pivotBuf[kBeg*pivotLDim], pivotLDim )
+        }
+        else
+        {
+            LUKernel<0>
+            ( m, n, numMembers, &ABuf[kBeg*ABS], ARS, ACS, ABS,
+              &pivotBuf[kBeg*pivotLDim], pivotLDim );
+        }
+    }
+}
+
+#define PROTO(Field) \
+  template void Cholesky( UpperOrLower uplo, BatchMatrix<Field>& A ); \
+  template void LU( BatchMatrix<Field>& A, Matrix<Int>& pivots );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace batched
+} // namespace El
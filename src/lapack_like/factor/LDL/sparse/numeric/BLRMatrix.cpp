@@ -0,0 +1,211 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+template<typename Field>
+void BLRMatrix<Field>::Compress
+( const Matrix<Field>& A, Int tileSizeIn, const Base<Field>& tol )
+{
+    EL_DEBUG_CSE
+    if( tileSizeIn <= 0 )
+        LogicError("Tile size must be positive");
+    Empty();
+    height = A.Height();
+    width = A.Width();
+    tileSize = tileSizeIn;
+
+    const Int numRowTiles = NumRowTiles();
+    const Int numColTiles = NumColTiles();
+    const Int numTiles = numRowTiles*numColTiles;
+    lowRank.resize( numTiles, false );
+    U.resize( numTiles );
+    V.resize( numTiles );
+
+    QRCtrl<Base<Field>> ctrl;
+    ctrl.adaptive = true;
+    ctrl.tol = tol;
+
+    Permutation P;
+    Matrix<Field> Z;
+    for( Int k=0; k<numColTiles; ++k )
+    {
+        const Int colOff = k*tileSize;
+        const Int nb = Min(tileSize,width-colOff);
+        const Range<Int> indk( colOff, colOff+nb );
+        for( Int i=0; i<numRowTiles; ++i )
+        {
+            const Int rowOff = i*tileSize;
+            const Int mb = Min(tileSize,height-rowOff);
+            const Int t = i + k*numRowTiles;
+            auto T = A( IR(rowOff,rowOff+mb), indk );
+
+            // T P^T ~= T(:,J) [I, Z], where J is the set of the first
+            // rank skeleton columns of T P^T
+            ID( T, P, Z, ctrl );
+            const Int rank = Z.Height();
+            if( rank*(mb+nb) >= mb*nb )
+            {
+                U[t] = T;
+                continue;
+            }
+
+            lowRank[t] = true;
+            auto TPerm = T;
+            P.PermuteCols( TPerm );
+            U[t] = TPerm( ALL, IR(0,rank) );
+            Zeros( V[t], rank, nb );
+            auto VL = V[t]( ALL, IR(0,rank) );
+            auto VR = V[t]( ALL, IR(rank,nb) );
+            FillDiagonal( VL, Field(1) );
+            VR = Z;
+            P.InversePermuteCols( V[t] );
+        }
+    }
+}
+
+template<typename Field>
+void BLRMatrix<Field>::Decompress( Matrix<Field>& A ) const
+{
+    EL_DEBUG_CSE
+    Zeros( A, height, width );
+    const Int numRowTiles = NumRowTiles();
+    const Int numColTiles = NumColTiles();
+    for( Int k=0; k<numColTiles; ++k )
+    {
+        const Int colOff = k*tileSize;
+        const Range<Int> indk( colOff, Min(colOff+tileSize,width) );
+        for( Int i=0; i<numRowTiles; ++i )
+        {
+            const Int rowOff = i*tileSize;
+            const Range<Int> indi( rowOff, Min(rowOff+tileSize,height) );
+            const Int t = i + k*numRowTiles;
+            auto ATile = A( indi, indk );
+            if( lowRank[t] )
+                Gemm( NORMAL, NORMAL, Field(1), U[t], V[t], Field(0), ATile );
+            else
+                ATile = U[t];
+        }
+    }
+}
+
+template<typename Field>
+void BLRMatrix<Field>::Empty()
+{
+    EL_DEBUG_CSE
+    height = 0;
+    width = 0;
+    tileSize = 0;
+    SwapClear( lowRank );
+    SwapClear( U );
+    SwapClear( V );
+}
+
+template<typename Field>
+Int BLRMatrix<Field>::Height() const
+{ return height; }
+
+template<typename Field>
+Int BLRMatrix<Field>::Width() const
+{ return width; }
+
+template<typename Field>
+Int BLRMatrix<Field>::NumRowTiles() const
+{ return tileSize == 0 ? 0 : (height+tileSize-1)/tileSize; }
+
+template<typename Field>
+Int BLRMatrix<Field>::NumColTiles() const
+{ return tileSize == 0 ? 0 : (width+tileSize-1)/tileSize; }
+
+template<typename Field>
+Int BLRMatrix<Field>::NumLowRankTiles() const
+{
+    Int numLowRank = 0;
+    for( const bool isLowRank : lowRank )
+        if( isLowRank )
+            ++numLowRank;
+    return numLowRank;
+}
+
+template<typename Field>
+Int BLRMatrix<Field>::NumEntries() const
+{
+    Int numEntries = 0;
+    const Int numTiles = U.size();
+    for( Int t=0; t<numTiles; ++t )
+    {
+        numEntries += U[t].Height()*U[t].Width();
+        if( lowRank[t] )
+            numEntries += V[t].Height()*V[t].Width();
+    }
+    return numEntries;
+}
+
+template<typename Field>
+void BLRMatrix<Field>::Multiply
+( Orientation orientation,
+  Field alpha,
+  const Matrix<Field>& X,
+        Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    EL_DEBUG_ONLY(
+      if( X.Height() != (normal ? width : height) ||
+          Y.Height() != (normal ? height : width) ||
+          X.Width() != Y.Width() )
+          LogicError("Nonconformal BLR multiply");
+    )
+    const Int numRowTiles = NumRowTiles();
+    const Int numColTiles = NumColTiles();
+    Matrix<Field> Z;
+    for( Int k=0; k<numColTiles; ++k )
+    {
+        const Int colOff = k*tileSize;
+        const Range<Int> indk( colOff, Min(colOff+tileSize,width) );
+        for( Int i=0; i<numRowTiles; ++i )
+        {
+            const Int rowOff = i*tileSize;
+            const Range<Int> indi( rowOff, Min(rowOff+tileSize,height) );
+            const Int t = i + k*numRowTiles;
+            auto XSub = X( (normal ? indk : indi), ALL );
+            auto YSub = Y( (normal ? indi : indk), ALL );
+            if( !lowRank[t] )
+            {
+                Gemm( orientation, NORMAL, alpha, U[t], XSub, Field(1), YSub );
+            }
+            else if( U[t].Width() > 0 )
+            {
+                if( normal )
+                {
+                    Gemm( NORMAL, NORMAL, Field(1), V[t], XSub, Z );
+                    Gemm( NORMAL, NORMAL, alpha, U[t], Z, Field(1), YSub );
+                }
+                else
+                {
+                    Gemm( orientation, NORMAL, Field(1), U[t], XSub, Z );
+                    Gemm( orientation, NORMAL, alpha, V[t], Z, Field(1), YSub );
+                }
+            }
+        }
+    }
+}
+
+#define PROTO(Field) template struct BLRMatrix<Field>;
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
@@ -63,7 +63,8 @@ void UnpackEntriesLocal
   const vector<Field>& rEntries,
   const vector<Int>& rTargets,
         vector<int>& offs,
-        vector<int>& entryOffs )
+        vector<int>& entryOffs,
+        DistFrontPullMeta* meta )
 {
     EL_DEBUG_CSE
 
@@ -77,7 +78,7 @@ void UnpackEntriesLocal
         front.children[c].reset( new Front<Field>(&front) );
         UnpackEntriesLocal
         ( *sep.children[c], *node.children[c], *front.children[c],
-          A, rRowLengths, rEntries, rTargets, offs, entryOffs );
+          A, rRowLengths, rEntries, rTargets, offs, entryOffs, meta );
     }
     // Mark this node as a sparse leaf if it does not have any children
     // and is not a duplicate of a dense distributed node
@@ -93,6 +94,13 @@ void UnpackEntriesLocal
         front.workSparse.Empty();
         Zeros( front.workSparse, size, size );
         Zeros( front.LDense, lowerSize, size );
+        Int sparseBuffer=-1, denseBuffer=-1;
+        vector<Int> sparseEntries;
+        if( meta != nullptr )
+        {
+            sparseBuffer = meta->numBuffers++;
+            denseBuffer = meta->numBuffers++;
+        }
 
         Int numSparseEntries = 0;
         auto offsCopy = offs;
@@ -140,6 +148,13 @@ void UnpackEntriesLocal
                     const Field transVal =
                       front.isHermitian ? Conj(value) : value;
                     front.workSparse.QueueUpdate( target-off, t, transVal );
+                    if( meta != nullptr )
+                    {
+                        meta->recvBuffers[entryOff-1] = sparseBuffer;
+                        meta->recvRows[entryOff-1] = target-off;
+                        meta->recvCols[entryOff-1] = t;
+                        sparseEntries.push_back( entryOff-1 );
+                    }
                 }
                 else
                 {
@@ -147,15 +162,35 @@ void UnpackEntriesLocal
                     Int origOff = Find( node.origLowerStruct, target );
                     const Int row = node.origLowerRelInds[origOff];
                     front.LDense(row-size,t) = value;
+                    if( meta != nullptr )
+                    {
+                        meta->recvBuffers[entryOff-1] = denseBuffer;
+                        meta->recvRows[entryOff-1] = row-size;
+                        meta->recvCols[entryOff-1] = t;
+                    }
                 }
             }
         }
         front.workSparse.ProcessQueues();
         MakeSymmetric( LOWER, front.workSparse, front.isHermitian );
+        if( meta != nullptr )
+        {
+            // Convert the (row,column) pairs into offsets into the value
+            // buffer of the symmetrized sparse matrix
+            for( const Int& e : sparseEntries )
+            {
+                const Int row = meta->recvRows[e];
+                const Int col = meta->recvCols[e];
+                meta->recvRows[e] = front.workSparse.Offset( row, col );
+                meta->recvCols[e] =
+                  ( row == col ? -1 : front.workSparse.Offset( col, row ) );
+            }
+        }
     }
     else
     {
         Zeros( front.LDense, size+lowerSize, size );
+        const Int denseBuffer = ( meta != nullptr ? meta->numBuffers++ : -1 );
         for( Int t=0; t<size; ++t )
         {
             const Int i = sep.inds[t];
@@ -174,16 +209,23 @@ void UnpackEntriesLocal
                   if( target < off+t )
                       LogicError("Received entry from upper triangle");
                 )
+                Int row;
                 if( target < off+size )
                 {
-                    front.LDense(target-off,t) = value;
+                    row = target-off;
                 }
                 else
                 {
                     // TODO(poulson): Avoid this binary search?
                     Int origOff = Find( node.origLowerStruct, target );
-                    const Int row = node.origLowerRelInds[origOff];
-                    front.LDense(row,t) = value;
+                    row = node.origLowerRelInds[origOff];
+                }
+                front.LDense(row,t) = value;
+                if( meta != nullptr )
+                {
+                    meta->recvBuffers[entryOff-1] = denseBuffer;
+                    meta->recvRows[entryOff-1] = row;
+                    meta->recvCols[entryOff-1] = t;
                 }
             }
         }
@@ -200,7 +242,8 @@ void UnpackEntries
   const vector<Field>& rEntries,
   const vector<Int>& rTargets,
         vector<int>& offs,
-        vector<int>& entryOffs )
+        vector<int>& entryOffs,
+        DistFrontPullMeta* meta )
 {
     EL_DEBUG_CSE
     const Grid& grid = node.Grid();
@@ -210,7 +253,7 @@ void UnpackEntries
         front.duplicate.reset( new Front<Field>(&front) );
         UnpackEntriesLocal
         ( *sep.duplicate, *node.duplicate, *front.duplicate,
-          A, rRowLengths, rEntries, rTargets, offs, entryOffs );
+          A, rRowLengths, rEntries, rTargets, offs, entryOffs, meta );
 
         front.L2D.Attach( grid, front.duplicate->LDense );
 
@@ -219,13 +262,14 @@ void UnpackEntries
     front.child.reset( new DistFront<Field>(&front) );
     UnpackEntries
     ( *sep.child, *node.child, *front.child,
-      A, rRowLengths, rEntries, rTargets, offs, entryOffs );
+      A, rRowLengths, rEntries, rTargets, offs, entryOffs, meta );
 
     const Int size = node.size;
     const Int off = node.off;
     const Int lowerSize = node.lowerStruct.size();
     front.L2D.SetGrid( grid );
     Zeros( front.L2D, size+lowerSize, size );
+    const Int buffer = ( meta != nullptr ? meta->numBuffers++ : -1 );
 
     const Int localWidth = front.L2D.LocalWidth();
     for( Int tLoc=0; tLoc<localWidth; ++tLoc )
@@ -247,16 +291,28 @@ void UnpackEntries
               if( target < off+t )
                   LogicError("Received entry from upper triangle");
             )
+            Int row;
             if( target < off+size )
             {
-                front.L2D.Set( target-off, t, value );
+                row = target-off;
             }
             else
             {
                 // TODO(poulson): Avoid this binary search?
                 const Int origOff = Find( node.origLowerStruct, target );
-                const Int row = node.origLowerRelInds[origOff];
-                front.L2D.Set( row, t, value );
+                row = node.origLowerRelInds[origOff];
+            }
+            front.L2D.Set( row, t, value );
+            if( meta != nullptr )
+            {
+                if( front.L2D.IsLocalRow(row) )
+                {
+                    meta->recvBuffers[entryOff-1] = buffer;
+                    meta->recvRows[entryOff-1] = front.L2D.LocalRow(row);
+                    meta->recvCols[entryOff-1] = tLoc;
+                }
+                else
+                    meta->recvBuffers[entryOff-1] = -1;
             }
         }
     }
@@ -280,15 +336,31 @@ void DistFront<Field>::Pull
       conjugate );
 }
 
+unsigned long long PullPatternHash( const DistGraph& graph )
+{
+    EL_DEBUG_CSE
+    const Int numLocalEdges = graph.NumLocalEdges();
+    Hasher hasher;
+    hasher.Add( graph.NumSources() );
+    hasher.Add( graph.NumTargets() );
+    hasher.Add( graph.FirstLocalSource() );
+    hasher.Add( numLocalEdges );
+    hasher.Add( graph.LockedSourceBuffer(), numLocalEdges*sizeof(Int) );
+    hasher.Add( graph.LockedTargetBuffer(), numLocalEdges*sizeof(Int) );
+    return hasher.Hash();
+}
+
 template<typename Field>
-void DistFront<Field>::Pull
-( const DistSparseMatrix<Field>& A,
+void PullEntries
+(       DistFront<Field>& front,
+  const DistSparseMatrix<Field>& A,
   const DistMap& reordering,
   const DistSeparator& rootSep,
   const DistNodeInfo& rootInfo,
         vector<Int>& mappedSources,
         vector<Int>& mappedTargets,
         vector<Int>& colOffs,
+        DistFrontPullMeta* meta,
   bool conjugate )
 {
     EL_DEBUG_CSE
@@ -424,6 +496,8 @@ void DistFront<Field>::Pull
     const int numSendEntries = Scan( sEntriesSizes, sEntriesOffs );
     vector<Field> sEntries( numSendEntries );
     vector<Int> sTargets( numSendEntries );
+    if( meta != nullptr )
+        meta->sendInds.resize( numSendEntries );
     for( Int q=0; q<commSize; ++q )
     {
         Int index = sEntriesOffs[q];
@@ -444,6 +518,8 @@ void DistFront<Field>::Pull
                     const Field value = A.Value( rowOff+e );
                     sEntries[index] = (conjugate ? Conj(value) : value);
                     sTargets[index] = iReord;
+                    if( meta != nullptr )
+                        meta->sendInds[index] = rowOff+e;
                     ++index;
                 }
             }
@@ -487,16 +563,199 @@ void DistFront<Field>::Pull
     // Unpack the received entries
     if( time && commRank == 0 )
         timer.Start();
+    if( meta != nullptr )
+    {
+        meta->ready = false;
+        meta->conjugate = conjugate;
+        meta->numLocalEntries = A.NumLocalEntries();
+        meta->patternHash = PullPatternHash( A.LockedDistGraph() );
+        meta->sendSizes = sEntriesSizes;
+        meta->sendOffs = sEntriesOffs;
+        meta->recvSizes = rEntriesSizes;
+        meta->recvOffs = rEntriesOffs;
+        meta->numBuffers = 0;
+        meta->recvBuffers.resize( numRecvEntries );
+        meta->recvRows.resize( numRecvEntries );
+        meta->recvCols.resize( numRecvEntries );
+    }
     // TODO(poulson): Modify constructor of [Dist]Front to default to SYMM_2D?
-    type = SYMM_2D;
-    isHermitian = conjugate;
+    front.type = SYMM_2D;
+    front.isHermitian = conjugate;
     UnpackEntries
-    ( rootSep, rootInfo, *this,
-      A, rRowLengths, rEntries, rTargets, rRowOffs, rEntriesOffs );
+    ( rootSep, rootInfo, front,
+      A, rRowLengths, rEntries, rTargets, rRowOffs, rEntriesOffs, meta );
+    if( meta != nullptr )
+        meta->ready = true;
     if( time && commRank == 0 )
         Output("Unpack: ",timer.Stop()," secs");
 }
 
+template<typename Field>
+void DistFront<Field>::Pull
+( const DistSparseMatrix<Field>& A,
+  const DistMap& reordering,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo,
+        vector<Int>& mappedSources,
+        vector<Int>& mappedTargets,
+        vector<Int>& colOffs,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    PullEntries
+    ( *this, A, reordering, rootSep, rootInfo,
+      mappedSources, mappedTargets, colOffs, nullptr, conjugate );
+}
+
+template<typename Field>
+void DistFront<Field>::Pull
+( const DistSparseMatrix<Field>& A,
+  const DistMap& reordering,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo,
+        vector<Int>& mappedSources,
+        vector<Int>& mappedTargets,
+        vector<Int>& colOffs,
+        DistFrontPullMeta& meta,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    PullEntries
+    ( *this, A, reordering, rootSep, rootInfo,
+      mappedSources, mappedTargets, colOffs, &meta, conjugate );
+}
+
+// The destination buffers of the received entries, in the same order in
+// which UnpackEntries[Local] assigned their indices
+template<typename Field>
+struct PullBuffer
+{
+    Field* buffer;
+    Int ldim;
+    bool sparse;
+};
+
+template<typename Field>
+void ZeroPullBuffersLocal
+( Front<Field>& front, bool conjugate, vector<PullBuffer<Field>>& buffers )
+{
+    EL_DEBUG_CSE
+    for( auto& child : front.children )
+        ZeroPullBuffersLocal( *child, conjugate, buffers );
+
+    front.type = SYMM_2D;
+    front.isHermitian = conjugate;
+    if( front.LBLR.Height() > 0 )
+    {
+        // Restore the dense connectivity that a BLR factorization compressed
+        const Int height = front.LDense.Height() + front.LBLR.Height();
+        const Int width = front.LDense.Width();
+        front.LBLR.Empty();
+        Zeros( front.LDense, height, width );
+    }
+    if( front.children.empty() && !front.sparseLeaf &&
+        front.duplicate == nullptr )
+    {
+        // Restore a leaf that a Cholesky factorization had densified
+        front.sparseLeaf = true;
+        const Int size = front.LDense.Width();
+        Zeros( front.LDense, front.LDense.Height()-size, size );
+    }
+    Zero( front.LDense );
+    if( front.sparseLeaf )
+    {
+        // Every stored entry of the sparse work matrix will be overwritten
+        buffers.push_back( { front.workSparse.ValueBuffer(), 0, true } );
+    }
+    buffers.push_back
+    ( { front.LDense.Buffer(), front.LDense.LDim(), false } );
+}
+
+template<typename Field>
+void ZeroPullBuffers
+( DistFront<Field>& front, bool conjugate, vector<PullBuffer<Field>>& buffers )
+{
+    EL_DEBUG_CSE
+    front.type = SYMM_2D;
+    front.isHermitian = conjugate;
+    if( front.child == nullptr )
+    {
+        ZeroPullBuffersLocal( *front.duplicate, conjugate, buffers );
+        return;
+    }
+    ZeroPullBuffers( *front.child, conjugate, buffers );
+
+    Zero( front.L2D );
+    buffers.push_back
+    ( { front.L2D.Buffer(), front.L2D.LDim(), false } );
+}
+
+template<typename Field>
+void DistFront<Field>::PullValues
+( const DistSparseMatrix<Field>& A, const DistFrontPullMeta& meta )
+{
+    EL_DEBUG_CSE
+    if( !meta.ready )
+        LogicError("The pull metadata has not been formed");
+    if( A.NumLocalEntries() != meta.numLocalEntries ||
+        PullPatternHash(A.LockedDistGraph()) != meta.patternHash )
+        LogicError("The sparsity pattern of A has changed");
+    if( FrontIs1D(type) )
+        LogicError("PullValues requires 2D fronts");
+    const Grid& grid = A.Grid();
+    const bool conjugate = meta.conjugate;
+
+    // Pack and send the values
+    const Int numSendEntries = meta.sendInds.size();
+    const Int numRecvEntries = meta.recvBuffers.size();
+    const Field* AValBuf = A.LockedValueBuffer();
+    vector<Field> sEntries( numSendEntries ), rEntries( numRecvEntries );
+    for( Int k=0; k<numSendEntries; ++k )
+    {
+        const Field value = AValBuf[meta.sendInds[k]];
+        sEntries[k] = ( conjugate ? Conj(value) : value );
+    }
+    mpi::AllToAll
+    ( sEntries.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      rEntries.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+      grid.Comm() );
+
+    // Zero the existing fronts in place and scatter the received values
+    vector<PullBuffer<Field>> buffers;
+    buffers.reserve( meta.numBuffers );
+    ZeroPullBuffers( *this, conjugate, buffers );
+    EL_DEBUG_ONLY(
+      if( Int(buffers.size()) != meta.numBuffers )
+          LogicError("The frontal tree does not match the pull metadata");
+    )
+    for( Int k=0; k<numRecvEntries; ++k )
+    {
+        const Int b = meta.recvBuffers[k];
+        if( b < 0 )
+            continue;
+        const Field value = rEntries[k];
+        const auto& dest = buffers[b];
+        if( dest.sparse )
+        {
+            // Mirror the effect of MakeSymmetric on the lower triangle
+            const Field transVal = conjugate ? Conj(value) : value;
+            const Int col = meta.recvCols[k];
+            if( col < 0 )
+            {
+                dest.buffer[meta.recvRows[k]] =
+                  ( conjugate ? Field(RealPart(transVal)) : transVal );
+            }
+            else
+            {
+                dest.buffer[meta.recvRows[k]] = transVal;
+                dest.buffer[col] = value;
+            }
+        }
+        else
+            dest.buffer[meta.recvRows[k]+meta.recvCols[k]*dest.ldim] = value;
+    }
+}
+
 template<typename Field>
 void DistFront<Field>::PullUpdate
 ( const DistSparseMatrix<Field>& A,
@@ -60,9 +60,12 @@ DistMatrixNode<T>::operator=( const DistMultiVecNode<T>& X )
 {
     EL_DEBUG_CSE
 
+    // Existing nodes are reused (along with their communication metadata when
+    // the shape is unchanged) so that repeated conversions are inexpensive
     if( X.child.get() == nullptr )
     {
-        duplicate.reset( new MatrixNode<T>(this) );
+        if( duplicate.get() == nullptr )
+            duplicate.reset( new MatrixNode<T>(this) );
         *duplicate = *X.duplicate;
 
         matrix.Attach( X.matrix.Grid(), duplicate->matrix );
@@ -70,11 +73,15 @@ DistMatrixNode<T>::operator=( const DistMultiVecNode<T>& X )
         return *this;
     }
 
-    commMeta.Empty();
+    if( matrix.Grid() != X.matrix.Grid() ||
+        matrix.Height() != X.matrix.Height() ||
+        matrix.Width() != X.matrix.Width() )
+        commMeta.Empty();
     matrix.SetGrid( X.matrix.Grid() );
     matrix = X.matrix;
 
-    child.reset( new DistMatrixNode<T>(this) );
+    if( child.get() == nullptr )
+        child.reset( new DistMatrixNode<T>(this) );
     *child = *X.child;
 
     return *this;
@@ -61,8 +61,14 @@ void DistSparseLDLFactorization<Field>::Initialize
     ldl::NestedDissection
     ( A.LockedDistGraph(), map_, *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
+    store_.reset();
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
+    formedPullMetadata_ = false;
+    pullMeta_.Empty();
+    dmvMeta_ = ldl::DistMultiVecNodeMeta();
+    multiVecNodal_.reset();
+    matrixNodal_.reset();
 
     initialized_ = true;
     factored_ = false;
@@ -83,8 +89,14 @@ void DistSparseLDLFactorization<Field>::Initialize2DGridGraph
     ( gridDim0, gridDim1, 1, A.LockedDistGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
+    store_.reset();
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
+    formedPullMetadata_ = false;
+    pullMeta_.Empty();
+    dmvMeta_ = ldl::DistMultiVecNodeMeta();
+    multiVecNodal_.reset();
+    matrixNodal_.reset();
 
     initialized_ = true;
     factored_ = false;
@@ -106,8 +118,14 @@ void DistSparseLDLFactorization<Field>::Initialize3DGridGraph
     ( gridDim0, gridDim1, gridDim2, A.LockedDistGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
+    store_.reset();
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
+    formedPullMetadata_ = false;
+    pullMeta_.Empty();
+    dmvMeta_ = ldl::DistMultiVecNodeMeta();
+    multiVecNodal_.reset();
+    matrixNodal_.reset();
 
     initialized_ = true;
     factored_ = false;
@@ -127,8 +145,15 @@ void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     // Convert from 1D to 2D if necessary
     ChangeFrontType( SYMM_2D );
 
-    // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    // Perform the initial factorization (spilling the completed sequential
+    // fronts if an out-of-core factorization was requested)
+    store_.reset();
+    if( outOfCoreCtrl_.enabled )
+        store_.reset( new ldl::FrontStore<Field>(outOfCoreCtrl_) );
+    ldl::Process
+    ( *info_, *front_, InitialFactorType(frontType), blrCtrl_, store_.get() );
+    if( store_ != nullptr )
+        store_->Flush();
     factored_ = true;
 
     // Convert the fronts from the initial factorization to the requested form
@@ -145,6 +170,33 @@ void DistSparseLDLFactorization<Field>::ChangeFrontType
     ldl::ChangeFrontType( *front_, frontType );
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SetOutOfCoreCtrl
+( const ldl::OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    outOfCoreCtrl_ = ctrl;
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SetBLRCtrl
+( const ldl::BLRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.tileSize <= 0 )
+        LogicError("BLR tile size must be positive");
+    blrCtrl_ = ctrl;
+}
+
+template<typename Field>
+ldl::OutOfCoreStats DistSparseLDLFactorization<Field>::OutOfCoreStats() const
+{
+    EL_DEBUG_CSE
+    if( store_ == nullptr )
+        return ldl::OutOfCoreStats();
+    return store_->Stats();
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::ChangeNonzeroValues
 ( const DistSparseMatrix<Field>& ANew )
@@ -152,15 +204,39 @@ void DistSparseLDLFactorization<Field>::ChangeNonzeroValues
     EL_DEBUG_CSE
     if( !initialized_ )
         LogicError("Must initialize before calling 'ChangeNonzeroValues()'");
-    if( !formedPullMetadata_ )
+    if( store_ != nullptr )
+    {
+        store_->Discard();
+        store_.reset();
+    }
+    // Since the sparsity pattern is usually unchanged, after the first call
+    // only the nonzero values are communicated and written into the existing
+    // fronts (which were overwritten by the factorization).
+    const bool localReuse = pullMeta_.ready &&
+      ANew.NumLocalEntries() == pullMeta_.numLocalEntries &&
+      ldl::PullPatternHash(ANew.LockedDistGraph()) == pullMeta_.patternHash;
+    const bool reuse =
+      mpi::AllReduce( Int(localReuse), mpi::MIN, ANew.Grid().Comm() );
+    if( reuse )
     {
-        ANew.MappedSources( map_, mappedSources_ );
-        ANew.MappedTargets( map_, mappedTargets_, columnOffsets_ );
-        formedPullMetadata_ = true;
+        ldl::ChangeFrontType( *front_, SYMM_2D );
+        front_->PullValues( ANew, pullMeta_ );
+    }
+    else
+    {
+        // If a pattern was recorded, it no longer matches that of ANew, so
+        // neither do the mapped sources and targets
+        if( !formedPullMetadata_ || pullMeta_.ready )
+        {
+            ANew.MappedSources( map_, mappedSources_ );
+            ANew.MappedTargets( map_, mappedTargets_, columnOffsets_ );
+            formedPullMetadata_ = true;
+        }
+        front_->Pull
+        ( ANew, map_, *separator_, *info_,
+          mappedSources_, mappedTargets_, columnOffsets_, pullMeta_,
+          front_->isHermitian );
     }
-    front_->Pull
-    ( ANew, map_, *separator_, *info_,
-      mappedSources_, mappedTargets_, columnOffsets_ );
     factored_ = false;
 }
 
@@ -170,18 +246,25 @@ void DistSparseLDLFactorization<Field>::Solve( DistMultiVec<Field>& B ) const
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before Solve()");
+
+    // Reuse the nodal layouts, along with the metadata for redistributing
+    // to and from them, across calls
+    if( multiVecNodal_.get() == nullptr )
+        multiVecNodal_.reset( new ldl::DistMultiVecNode<Field> );
+    multiVecNodal_->Pull( inverseMap_, *info_, B, dmvMeta_ );
     if( FrontIs1D(front_->type) )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
-        Solve( BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        Solve( *multiVecNodal_ );
     }
     else
     {
-        ldl::DistMatrixNode<Field> BNodal( inverseMap_, *info_, B );
-        Solve( BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        if( matrixNodal_.get() == nullptr )
+            matrixNodal_.reset( new ldl::DistMatrixNode<Field> );
+        *matrixNodal_ = *multiVecNodal_;
+        Solve( *matrixNodal_ );
+        *multiVecNodal_ = *matrixNodal_;
     }
+    multiVecNodal_->Push( inverseMap_, *info_, B, dmvMeta_ );
 }
 
 template<typename Field>
@@ -352,9 +435,10 @@ void DistSparseLDLFactorization<Field>::SolveAgainstL
     if( !factored_ )
         LogicError("Must call Factor() before SolveAgainstL()");
     if( orientation == NORMAL )
-        ldl::LowerForwardSolve( *info_, *front_, B );
+        ldl::LowerForwardSolve( *info_, *front_, B, store_.get() );
     else
-        ldl::LowerBackwardSolve( *info_, *front_, B, orientation==ADJOINT );
+        ldl::LowerBackwardSolve
+        ( *info_, *front_, B, orientation==ADJOINT, store_.get() );
 }
 
 template<typename Field>
@@ -365,9 +449,10 @@ void DistSparseLDLFactorization<Field>::SolveAgainstL
     if( !factored_ )
         LogicError("Must call Factor() before SolveAgainstL()");
     if( orientation == NORMAL )
-        ldl::LowerForwardSolve( *info_, *front_, B );
+        ldl::LowerForwardSolve( *info_, *front_, B, store_.get() );
     else
-        ldl::LowerBackwardSolve( *info_, *front_, B, orientation==ADJOINT );
+        ldl::LowerBackwardSolve
+        ( *info_, *front_, B, orientation==ADJOINT, store_.get() );
 }
 
 template<typename Field>
@@ -398,10 +483,15 @@ void DistSparseLDLFactorization<Field>::MultiplyWithL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before MultiplyWithL()");
+    // The multiplications do not support out-of-core fronts
+    if( store_ != nullptr )
+        store_->LoadAll();
     if( orientation == NORMAL )
         ldl::LowerForwardMultiply( *info_, *front_, B );
     else
         ldl::LowerBackwardMultiply( *info_, *front_, B, orientation==ADJOINT );
+    if( store_ != nullptr )
+        store_->ReleaseAll();
 }
 
 template<typename Field>
@@ -411,10 +501,15 @@ void DistSparseLDLFactorization<Field>::MultiplyWithL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before MultiplyWithL()");
+    // The multiplications do not support out-of-core fronts
+    if( store_ != nullptr )
+        store_->LoadAll();
     if( orientation == NORMAL )
         ldl::LowerForwardMultiply( *info_, *front_, B );
     else
         ldl::LowerBackwardMultiply( *info_, *front_, B, orientation==ADJOINT );
+    if( store_ != nullptr )
+        store_->ReleaseAll();
 }
 
 template<typename Field>
@@ -578,6 +673,16 @@ double DistSparseLDLFactorization<Field>::LocalSolveGFlops( Int numRHS ) const
     return front_->LocalSolveGFlops( numRHS );
 }
 
+template<typename Field>
+ldl::FactorEstimate
+DistSparseLDLFactorization<Field>::Estimate( LDLFrontType frontType ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Estimate()'");
+    return ldl::EstimateFactorization<Field>( *info_, frontType );
+}
+
 template<typename Field>
 ldl::DistFront<Field>& DistSparseLDLFactorization<Field>::Front()
 {
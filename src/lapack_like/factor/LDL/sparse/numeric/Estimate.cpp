@@ -0,0 +1,198 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// The (real) costs of a subtree of fronts on this process, with the entries
+// of the live workspaces tracked separately from those of the factors
+struct SubtreeCost
+{
+    double factorEntries=0;
+    double peakWorkEntries=0;
+    double factorFlops=0;
+    double solveFlops=0;
+};
+
+// These mirror the counts of Front::NumEntries, Front::FactorGFlops, and
+// Front::SolveGFlops, while the workspaces follow the ordering of Process:
+// the update matrix of a front is allocated before its children are
+// processed and each child's update matrix is freed once it is added in.
+SubtreeCost SequentialCost( const NodeInfo& rootInfo, bool cholesky )
+{
+    SubtreeCost cost;
+    function<double(const NodeInfo&)> count =
+      [&]( const NodeInfo& info )
+      {
+        const double n = info.size;
+        const double u = info.lowerStruct.size();
+        double peakTransient = 0;
+        if( info.children.empty() && info.duplicate == nullptr &&
+            !(cholesky && DenseCholeskyLeaf(info)) )
+        {
+            // A sparse leaf
+            const Int numSources = info.LOffsets.size()-1;
+            const double numSparseEntries = info.LOffsets.back();
+            for( Int j=0; j<numSources; ++j )
+            {
+                const double nnz = info.LOffsets[j+1]-info.LOffsets[j];
+                cost.factorFlops += nnz*(nnz+2.);
+            }
+            cost.factorFlops += u*n + u*u*n;
+            cost.factorEntries += numSparseEntries + u*n;
+            cost.solveFlops += numSparseEntries + u*n;
+
+            // The copy of the bottom-left block used for the Schur complement
+            peakTransient = u*n;
+        }
+        else
+        {
+            for( const auto& child : info.children )
+                peakTransient = Max( peakTransient, count(*child) );
+            cost.factorFlops += n*n*n/3 + u*n + u*u*n;
+            cost.factorEntries += (n+u)*n;
+            cost.solveFlops += (n+u)*n;
+        }
+        return u*u + peakTransient;
+      };
+    cost.peakWorkEntries = count( rootInfo );
+    return cost;
+}
+
+template<typename Field>
+FactorEstimate LocalEstimate( const SubtreeCost& cost )
+{
+    const double flopScale = IsComplex<Field>::value ? 4 : 1;
+    FactorEstimate estimate;
+    estimate.localFactorEntries = cost.factorEntries;
+    estimate.localPeakBytes =
+      sizeof(Field)*(cost.factorEntries+cost.peakWorkEntries);
+    estimate.localFactorGFlops = flopScale*cost.factorFlops/1.e9;
+    estimate.localSolveGFlops = flopScale*cost.solveFlops/1.e9;
+
+    estimate.factorEntries = estimate.localFactorEntries;
+    estimate.maxPeakBytes = estimate.localPeakBytes;
+    estimate.factorGFlops = estimate.localFactorGFlops;
+    estimate.solveGFlops = estimate.localSolveGFlops;
+    return estimate;
+}
+
+} // anonymous namespace
+
+bool DenseCholeskyLeaf( const NodeInfo& info )
+{
+    // Switch to the dense kernels once at least half of the strictly lower
+    // triangle of the leaf's factor is filled in
+    const double n = info.size;
+    const double numSparseEntries = info.LOffsets.back();
+    return 4*numSparseEntries >= n*(n-1);
+}
+
+template<typename Field>
+FactorEstimate EstimateFactorization
+( const NodeInfo& rootInfo, LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    // NOTE: Selective inversion is only applied to the distributed fronts
+    return LocalEstimate<Field>
+      ( SequentialCost( rootInfo, CholeskyFactorization(frontType) ) );
+}
+
+template<typename Field>
+FactorEstimate EstimateFactorization
+( const DistNodeInfo& rootInfo, LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    const bool selInv = SelInvFactorization( frontType );
+    const bool cholesky = CholeskyFactorization( frontType );
+
+    // The distributed fronts store their share of the dense factor and
+    // update matrices, and the child updates are redistributed through a
+    // packed send buffer (of the lower triangle) and a receive buffer.
+    double factorEntries=0, factorFlops=0, solveFlops=0;
+    function<double(const DistNodeInfo&)> count =
+      [&]( const DistNodeInfo& info )
+      {
+        if( info.duplicate != nullptr )
+        {
+            const SubtreeCost seqCost =
+              SequentialCost( *info.duplicate, cholesky );
+            factorEntries += seqCost.factorEntries;
+            factorFlops += seqCost.factorFlops;
+            solveFlops += seqCost.solveFlops;
+            return seqCost.peakWorkEntries;
+        }
+        const double childPeak = count( *info.child );
+
+        const double p = info.Grid().Size();
+        const double n = info.size;
+        const double u = info.lowerStruct.size();
+        factorFlops +=
+          ( (selInv ? 2*n*n*n/3 : n*n*n/3) + u*n + u*u*n ) / p;
+        factorEntries += (n+u)*n / p;
+        solveFlops += (n+u)*n / p;
+
+        const double pChild = info.child->Grid().Size();
+        const double uChild = info.child->lowerStruct.size();
+        const double childWork = uChild*uChild / pChild;
+        const double sendEntries = uChild*(uChild+1)/2 / pChild;
+        const double recvEntries = uChild*(uChild+1)/2 / p;
+        const double work = u*u / p;
+        return Max
+          ( Max( childPeak, childWork+sendEntries ),
+            Max( sendEntries+recvEntries, recvEntries+work ) );
+      };
+    SubtreeCost cost;
+    cost.peakWorkEntries = count( rootInfo );
+    cost.factorEntries = factorEntries;
+    cost.factorFlops = factorFlops;
+    cost.solveFlops = solveFlops;
+
+    auto estimate = LocalEstimate<Field>( cost );
+    mpi::Comm comm = rootInfo.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    double localSums[4] =
+      { estimate.localFactorEntries, estimate.localPeakBytes,
+        estimate.localFactorGFlops, estimate.localSolveGFlops };
+    double sums[4];
+    mpi::AllReduce( localSums, sums, 4, mpi::SUM, comm );
+    double localMaxes[2] =
+      { estimate.localPeakBytes, estimate.localFactorGFlops };
+    double maxes[2];
+    mpi::AllReduce( localMaxes, maxes, 2, mpi::MAX, comm );
+
+    estimate.factorEntries = sums[0];
+    estimate.factorGFlops = sums[2];
+    estimate.solveGFlops = sums[3];
+    estimate.maxPeakBytes = maxes[0];
+    if( sums[1] > 0 )
+        estimate.peakImbalance = maxes[0] / (sums[1]/commSize);
+    if( sums[2] > 0 )
+        estimate.factorImbalance = maxes[1] / (sums[2]/commSize);
+    return estimate;
+}
+
+#define PROTO(Field) \
+  template FactorEstimate EstimateFactorization<Field> \
+  ( const NodeInfo& rootInfo, LDLFrontType frontType ); \
+  template FactorEstimate EstimateFactorization<Field> \
+  ( const DistNodeInfo& rootInfo, LDLFrontType frontType );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
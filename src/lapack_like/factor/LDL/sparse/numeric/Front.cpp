@@ -88,6 +88,7 @@ void Front<Field>::Pull
       {
         // Delete any existing children
         SwapClear( front.children );
+        front.LBLR.Empty();
 
         const Int numChildren = node.children.size();
         front.children.resize( numChildren );
@@ -374,6 +375,12 @@ void Front<Field>::Push
         }
         else
         {
+            // Expand the connectivity of block low-rank fronts
+            Matrix<Field> LB;
+            const bool compressed = ( front.LBLR.Height() > 0 );
+            if( compressed )
+                front.LBLR.Decompress( LB );
+
             for( Int t=0; t<node.size; ++t )
             {
                 const Int j = invReorder[node.off+t];
@@ -391,7 +398,8 @@ void Front<Field>::Push
                 for( Int s=0; s<lowerSize; ++s )
                 {
                     const Int i = invReorder[node.lowerStruct[s]];
-                    const Field value = front.LDense(s+node.size,t);
+                    const Field value =
+                      ( compressed ? LB(s,t) : front.LDense(s+node.size,t) );
                     if( value != Field(0) )
                         A.QueueUpdate( i, j, value );
                 }
@@ -491,6 +499,12 @@ void Front<Field>::Unpack
         }
         else
         {
+            // Expand the connectivity of block low-rank fronts
+            Matrix<Field> LB;
+            const bool compressed = ( front.LBLR.Height() > 0 );
+            if( compressed )
+                front.LBLR.Decompress( LB );
+
             for( Int t=0; t<node.size; ++t )
             {
                 const Int j = node.off+t;
@@ -508,7 +522,8 @@ void Front<Field>::Unpack
                 for( Int s=0; s<lowerSize; ++s )
                 {
                     const Int i = node.lowerStruct[s];
-                    const Field value = front.LDense(s+node.size,t);
+                    const Field value =
+                      ( compressed ? LB(s,t) : front.LDense(s+node.size,t) );
                     if( value != Field(0) )
                         A.QueueUpdate( i, j, value );
                 }
@@ -527,6 +542,7 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
     sparseLeaf = front.sparseLeaf;
     type = front.type;
     LDense = front.LDense;
+    LBLR = front.LBLR;
     LSparse = front.LSparse;
     diag = front.diag;
     subdiag = front.subdiag;
@@ -548,9 +564,18 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
     return *this;
 }
 
+template<typename Field>
+Int Front<Field>::DenseHeight() const
+{ return spilled ? spillHeight : LDense.Height(); }
+
+template<typename Field>
+Int Front<Field>::DenseWidth() const
+{ return spilled ? spillWidth : LDense.Width(); }
+
 template<typename Field>
 Int Front<Field>::Height() const
-{ return sparseLeaf ? LDense.Height()+LDense.Width() : LDense.Height(); }
+{ return sparseLeaf ? DenseHeight()+DenseWidth()
+                    : DenseHeight()+LBLR.Height(); }
 
 template<typename Field>
 Int Front<Field>::NumEntries() const
@@ -579,12 +604,13 @@ Int Front<Field>::NumEntries() const
             }
 
             // Count the connectivity
-            numEntries += front.LDense.Height() * front.LDense.Width();
+            numEntries += front.DenseHeight() * front.DenseWidth();
         }
         else
         {
             // Add in L
-            numEntries += front.LDense.Height() * front.LDense.Width();
+            numEntries += front.DenseHeight() * front.DenseWidth();
+            numEntries += front.LBLR.NumEntries();
         }
         // Add in the workspace for the Schur complement
         numEntries += front.workDense.Height()*front.workDense.Width();
@@ -620,7 +646,7 @@ Int Front<Field>::NumTopLeftEntries() const
         }
         else
         {
-            const Int n = front.LDense.Width();
+            const Int n = front.DenseWidth();
             numEntries += n*n;
         }
       };
@@ -638,15 +664,15 @@ Int Front<Field>::NumBottomLeftEntries() const
       {
         for( const auto& child : front.children )
             count( *child );
-        const Int m = front.LDense.Height();
-        const Int n = front.LDense.Width();
+        const Int m = front.DenseHeight();
+        const Int n = front.DenseWidth();
         if( front.sparseLeaf )
         {
             numEntries += m*n;
         }
         else
         {
-            numEntries += (m-n)*n;
+            numEntries += (m-n)*n + front.LBLR.NumEntries();
         }
       };
     count( *this );
@@ -663,8 +689,8 @@ double Front<Field>::FactorGFlops() const
       {
         for( const auto& child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
-        const double n = front.LDense.Width();
+        const double m = front.DenseHeight() + front.LBLR.Height();
+        const double n = front.DenseWidth();
         double realFrontFlops=0;
         if( front.sparseLeaf )
         {
@@ -704,8 +730,8 @@ double Front<Field>::SolveGFlops( Int numRHS ) const
       {
         for( const auto& child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
-        const double n = front.LDense.Width();
+        const double m = front.DenseHeight();
+        const double n = front.DenseWidth();
         double realFrontFlops = 0;
         if( front.sparseLeaf )
         {
@@ -717,7 +743,7 @@ double Front<Field>::SolveGFlops( Int numRHS ) const
         }
         else
         {
-            realFrontFlops = m*n*numRHS;
+            realFrontFlops = (m*n+front.LBLR.NumEntries())*numRHS;
         }
         gflops += (IsComplex<Field>::value ? 4*realFrontFlops
                                        : realFrontFlops)/1.e9;
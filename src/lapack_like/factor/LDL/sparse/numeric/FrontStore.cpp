@@ -0,0 +1,352 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <future>
+#include <mutex>
+
+namespace El {
+namespace ldl {
+
+// The scratch file and the asynchronous operations upon it. Reads and writes
+// may be in flight simultaneously, so each one holds the lock while it
+// positions and uses the (shared) stream. Since the workers make no Elemental
+// calls (in particular, they cannot throw), each operation returns an errno
+// value (zero upon success) which is checked by the calling thread.
+struct FrontStoreState
+{
+    string filename;
+    std::fstream file;
+    std::mutex fileMutex;
+
+    // The factor which is being written (which is freed by the main thread
+    // once the write completes)
+    std::future<int> pendingWrite;
+    unique_ptr<char[]> writeBuffer;
+
+    // The buffers of the fronts which are being read ahead, indexed by their
+    // position in the spill order
+    std::map<Int,std::future<int>> pendingReads;
+    std::map<Int,unique_ptr<vector<char>>> readBuffers;
+};
+
+namespace {
+
+Int numFrontStores = 0;
+
+template<typename Field>
+size_t DenseBytes( const Front<Field>& front )
+{ return size_t(front.DenseHeight())*front.DenseWidth()*sizeof(Field); }
+
+// Return the errno value describing the failure of a stream operation (which
+// need not have set errno) and reset the stream so that later operations may
+// be attempted
+int StreamError( std::fstream& file )
+{
+    const int error = ( errno != 0 ? errno : EIO );
+    file.clear();
+    return error;
+}
+
+int WriteBytes
+( FrontStoreState& state, size_t offset, const char* buffer, size_t numBytes )
+{
+    std::lock_guard<std::mutex> guard( state.fileMutex );
+    errno = 0;
+    state.file.seekp( offset );
+    state.file.write( buffer, numBytes );
+    state.file.flush();
+    return state.file.good() ? 0 : StreamError( state.file );
+}
+
+int ReadBytes
+( FrontStoreState& state, size_t offset, char* buffer, size_t numBytes )
+{
+    std::lock_guard<std::mutex> guard( state.fileMutex );
+    errno = 0;
+    state.file.seekg( offset );
+    state.file.read( buffer, numBytes );
+    return state.file.good() ? 0 : StreamError( state.file );
+}
+
+void CheckStatus( int status, const char* operation, const string& filename )
+{
+    if( status != 0 )
+        RuntimeError
+        ("Could not ",operation," ",filename,": ",std::strerror(status));
+}
+
+} // anonymous namespace
+
+template<typename Field>
+FrontStore<Field>::FrontStore( const OutOfCoreCtrl& ctrl )
+: ctrl_(ctrl), state_(new FrontStoreState)
+{
+    EL_DEBUG_CSE
+    // The dense factors are written out as raw bytes
+    if( !std::is_trivially_copyable<Field>::value )
+        LogicError("Out-of-core fronts are not supported for this datatype");
+
+    ostringstream os;
+    os << ctrl.scratchDir << "/El-fronts-" << mpi::Rank(mpi::COMM_WORLD)
+       << "-" << numFrontStores++ << "-" << std::time(nullptr) << ".bin";
+    state_->filename = os.str();
+    state_->file.open
+    ( state_->filename.c_str(),
+      std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary );
+    if( !state_->file.is_open() )
+        RuntimeError("Could not open ",state_->filename);
+}
+
+template<typename Field>
+FrontStore<Field>::~FrontStore()
+{
+    EL_DEBUG_CSE
+    // The fronts may have already been destroyed, so they are not touched
+    try
+    {
+        if( state_->pendingWrite.valid() )
+            state_->pendingWrite.wait();
+        for( auto& entry : state_->pendingReads )
+            entry.second.wait();
+    }
+    catch( ... ) { }
+    state_->file.close();
+    std::remove( state_->filename.c_str() );
+}
+
+template<typename Field>
+void FrontStore<Field>::Add( Front<Field>& front )
+{
+    EL_DEBUG_CSE
+    resident_.push_back( &front );
+    residentBytes_ += DenseBytes( front );
+    while( residentBytes_ > ctrl_.memoryBudget && !resident_.empty() )
+    {
+        Front<Field>* oldest = resident_.front();
+        resident_.pop_front();
+        residentBytes_ -= DenseBytes( *oldest );
+        Spill( *oldest );
+    }
+}
+
+template<typename Field>
+void FrontStore<Field>::Spill( Front<Field>& front )
+{
+    EL_DEBUG_CSE
+    // Only allow a single write to be in flight so that at most one extra
+    // front's worth of memory is held by the store
+    Flush();
+
+    const size_t numBytes = DenseBytes( front );
+    const size_t offset = fileSize_;
+    fileSize_ += numBytes;
+    spillIndex_[&front] = spilled_.size();
+    spilled_.push_back( &front );
+    offsets_.push_back( offset );
+
+    front.spillHeight = front.LDense.Height();
+    front.spillWidth = front.LDense.Width();
+    front.spilled = true;
+
+    // Pack the factor into the write buffer and release it
+    const Int height = front.LDense.Height();
+    const Int width = front.LDense.Width();
+    const size_t colBytes = height*sizeof(Field);
+    state_->writeBuffer.reset( new char[numBytes] );
+    char* buf = state_->writeBuffer.get();
+    for( Int j=0; j<width; ++j )
+        MemCopy
+        ( &buf[j*colBytes],
+          reinterpret_cast<const char*>(front.LDense.LockedBuffer(0,j)),
+          colBytes );
+    front.LDense.Empty();
+
+    FrontStoreState* state = state_.get();
+    state_->pendingWrite = std::async
+    ( std::launch::async,
+      [=]() { return WriteBytes( *state, offset, buf, numBytes ); } );
+
+    ++stats_.numFrontsSpilled;
+    stats_.bytesSpilled += numBytes;
+}
+
+template<typename Field>
+void FrontStore<Field>::Flush()
+{
+    EL_DEBUG_CSE
+    if( !state_->pendingWrite.valid() )
+        return;
+    const int status = state_->pendingWrite.get();
+    state_->writeBuffer.reset();
+    CheckStatus( status, "write to", state_->filename );
+}
+
+template<typename Field>
+void FrontStore<Field>::Load( Int index )
+{
+    EL_DEBUG_CSE
+    Front<Field>& front = *spilled_[index];
+    if( front.LDense.Height() == front.spillHeight &&
+        front.LDense.Width() == front.spillWidth )
+        return;
+
+    const size_t numBytes = DenseBytes( front );
+    front.LDense.Resize( front.spillHeight, front.spillWidth );
+    char* buf = reinterpret_cast<char*>(front.LDense.Buffer());
+    auto it = state_->pendingReads.find( index );
+    int status;
+    if( it != state_->pendingReads.end() )
+    {
+        status = it->second.get();
+        state_->pendingReads.erase( it );
+        if( status == 0 )
+        {
+            auto& readBuffer = state_->readBuffers[index];
+            MemCopy( buf, readBuffer->data(), numBytes );
+        }
+        state_->readBuffers.erase( index );
+    }
+    else
+    {
+        status = ReadBytes( *state_, offsets_[index], buf, numBytes );
+    }
+    if( status != 0 )
+        front.LDense.Empty();
+    CheckStatus( status, "read from", state_->filename );
+    ++stats_.numFrontsRead;
+    stats_.bytesRead += numBytes;
+}
+
+template<typename Field>
+void FrontStore<Field>::Release( Int index )
+{
+    EL_DEBUG_CSE
+    spilled_[index]->LDense.Empty();
+}
+
+template<typename Field>
+void FrontStore<Field>::Traverse
+( const vector<const Front<Field>*>& fronts,
+  function<void(Int)> visit )
+{
+    EL_DEBUG_CSE
+    Flush();
+    const Int numFronts = fronts.size();
+
+    // Find the spill index of each front (or -1 if it is resident)
+    vector<Int> indices( numFronts, -1 );
+    for( Int k=0; k<numFronts; ++k )
+    {
+        auto it = spillIndex_.find( fronts[k] );
+        if( it != spillIndex_.end() )
+            indices[k] = it->second;
+    }
+
+    Int nextRead = 0;
+    for( Int k=0; k<numFronts; ++k )
+    {
+        // Keep (up to) ctrl_.readAhead spilled fronts in flight ahead of the
+        // current one
+        nextRead = Max( nextRead, k+1 );
+        Int numInFlight = state_->pendingReads.size();
+        while( nextRead < numFronts && numInFlight < ctrl_.readAhead )
+        {
+            const Int index = indices[nextRead++];
+            if( index < 0 || state_->pendingReads.count(index) )
+                continue;
+            const size_t numBytes = DenseBytes( *spilled_[index] );
+            if( numBytes == 0 )
+                continue;
+            auto& readBuffer = state_->readBuffers[index];
+            readBuffer.reset( new vector<char>(numBytes) );
+            char* buf = readBuffer->data();
+            const size_t offset = offsets_[index];
+            FrontStoreState* state = state_.get();
+            state_->pendingReads[index] = std::async
+            ( std::launch::async,
+              [=]() { return ReadBytes( *state, offset, buf, numBytes ); } );
+            ++numInFlight;
+        }
+
+        if( indices[k] >= 0 )
+            Load( indices[k] );
+        visit( k );
+        if( indices[k] >= 0 )
+            Release( indices[k] );
+    }
+}
+
+template<typename Field>
+void FrontStore<Field>::LoadAll()
+{
+    EL_DEBUG_CSE
+    Flush();
+    const Int numSpilled = spilled_.size();
+    for( Int index=0; index<numSpilled; ++index )
+        Load( index );
+}
+
+template<typename Field>
+void FrontStore<Field>::ReleaseAll()
+{
+    EL_DEBUG_CSE
+    const Int numSpilled = spilled_.size();
+    for( Int index=0; index<numSpilled; ++index )
+        Release( index );
+}
+
+template<typename Field>
+void FrontStore<Field>::Discard()
+{
+    EL_DEBUG_CSE
+    // The statuses of the pending operations are irrelevant since the spilled
+    // factors are being dropped
+    if( state_->pendingWrite.valid() )
+        state_->pendingWrite.get();
+    state_->writeBuffer.reset();
+    for( auto& entry : state_->pendingReads )
+        entry.second.wait();
+    state_->pendingReads.clear();
+    state_->readBuffers.clear();
+
+    for( auto* front : spilled_ )
+    {
+        front->spilled = false;
+        Zeros( front->LDense, front->spillHeight, front->spillWidth );
+    }
+    spilled_.clear();
+    offsets_.clear();
+    spillIndex_.clear();
+    resident_.clear();
+    residentBytes_ = 0;
+    fileSize_ = 0;
+}
+
+template<typename Field>
+Int FrontStore<Field>::NumSpilled() const
+{ return spilled_.size(); }
+
+template<typename Field>
+const OutOfCoreStats& FrontStore<Field>::Stats() const
+{ return stats_; }
+
+#define PROTO(Field) template class FrontStore<Field>;
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
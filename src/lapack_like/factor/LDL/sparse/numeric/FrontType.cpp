@@ -32,7 +32,9 @@ bool FrontIs1D( LDLFrontType type )
            type == LDL_INTRAPIV_1D        ||
            type == LDL_INTRAPIV_SELINV_1D ||
            type == BLOCK_LDL_1D           ||
-           type == BLOCK_LDL_INTRAPIV_1D;
+           type == BLOCK_LDL_INTRAPIV_1D  ||
+           type == LDL_BLR_1D             ||
+           type == CHOLESKY_1D;
 }
 
 bool BlockFactorization( LDLFrontType type )
@@ -61,6 +63,12 @@ bool PivotedFactorization( LDLFrontType type )
            type == BLOCK_LDL_INTRAPIV_2D;
 }
 
+bool BLRFactorization( LDLFrontType type )
+{ return type == LDL_BLR_1D || type == LDL_BLR_2D; }
+
+bool CholeskyFactorization( LDLFrontType type )
+{ return type == CHOLESKY_1D || type == CHOLESKY_2D; }
+
 LDLFrontType ConvertTo2D( LDLFrontType type )
 {
     EL_DEBUG_CSE
@@ -81,6 +89,10 @@ LDLFrontType ConvertTo2D( LDLFrontType type )
     case BLOCK_LDL_2D:           newType = BLOCK_LDL_2D;           break;
     case BLOCK_LDL_INTRAPIV_1D:
     case BLOCK_LDL_INTRAPIV_2D:  newType = BLOCK_LDL_INTRAPIV_2D;  break;
+    case LDL_BLR_1D:
+    case LDL_BLR_2D:             newType = LDL_BLR_2D;             break;
+    case CHOLESKY_1D:
+    case CHOLESKY_2D:            newType = CHOLESKY_2D;            break;
     default: LogicError("Invalid front type");
     }
     return newType;
@@ -106,6 +118,10 @@ LDLFrontType ConvertTo1D( LDLFrontType type )
     case BLOCK_LDL_2D:           newType = BLOCK_LDL_1D;           break;
     case BLOCK_LDL_INTRAPIV_1D:
     case BLOCK_LDL_INTRAPIV_2D:  newType = BLOCK_LDL_INTRAPIV_1D;  break;
+    case LDL_BLR_1D:
+    case LDL_BLR_2D:             newType = LDL_BLR_1D;             break;
+    case CHOLESKY_1D:
+    case CHOLESKY_2D:            newType = CHOLESKY_1D;            break;
     default: LogicError("Invalid front type");
     }
     return newType;
@@ -149,6 +165,10 @@ LDLFrontType InitialFactorType( LDLFrontType type )
         return ConvertTo2D(type);
     else if( PivotedFactorization(type) )
         return LDL_INTRAPIV_2D;
+    else if( BLRFactorization(type) )
+        return LDL_BLR_2D;
+    else if( CholeskyFactorization(type) )
+        return CHOLESKY_2D;
     else
         return LDL_2D;
 }
@@ -59,7 +59,7 @@ void FrontLowerBackwardMultiply
     }
     else
     {
-        if( type == LDL_2D )
+        if( type == LDL_2D || type == CHOLESKY_2D )
             FrontVanillaLowerBackwardMultiply( front.LDense, W, conjugate );
         else
             LogicError("Unsupported front type");
@@ -147,7 +147,7 @@ void FrontLowerBackwardMultiply
     if( Unfactored(front.type) )
         LogicError("Cannot multiply against an unfactored matrix");
 
-    if( front.type == LDL_2D )
+    if( front.type == LDL_2D || front.type == CHOLESKY_2D )
         FrontVanillaLowerBackwardMultiply( front.L2D, W, conjugate );
     else
         LogicError("Unsupported front type");
@@ -161,7 +161,7 @@ void FrontLowerBackwardMultiply
     if( Unfactored(front.type) )
         LogicError("Cannot multiply against an unfactored matrix");
 
-    if( front.type == LDL_1D )
+    if( front.type == LDL_1D || front.type == CHOLESKY_1D )
         FrontVanillaLowerBackwardMultiply( front.L1D, W, conjugate );
     else
         LogicError("Unsupported front type");
@@ -47,8 +47,9 @@ void FrontLowerForwardMultiply( const Front<F>& front, Matrix<F>& W )
     EL_DEBUG_CSE
     if( Unfactored(front.type) )
         LogicError("Cannot multiply against an unfactored front");
-    if( BlockFactorization(front.type) || PivotedFactorization(front.type) )
-        LogicError("Blocked and pivoted factorizations not supported");
+    if( BlockFactorization(front.type) || PivotedFactorization(front.type) ||
+        BLRFactorization(front.type) )
+        LogicError("Blocked, pivoted, and BLR factorizations not supported");
     if( front.sparseLeaf )
     {
         LogicError("Sparse leaves not supported in FrontLowerForwardMultiply");
@@ -132,7 +133,7 @@ void
 FrontLowerForwardMultiply( const DistFront<F>& front, DistMatrix<F,VC,STAR>& W )
 {
     EL_DEBUG_CSE
-    if( front.type == LDL_1D )
+    if( front.type == LDL_1D || front.type == CHOLESKY_1D )
         FrontVanillaLowerForwardMultiply( front.L1D, W );
     else
         LogicError("Unsupported front type");
@@ -143,7 +144,7 @@ void
 FrontLowerForwardMultiply( const DistFront<F>& front, DistMatrix<F>& W )
 {
     EL_DEBUG_CSE
-    if( front.type == LDL_2D )
+    if( front.type == LDL_2D || front.type == CHOLESKY_2D )
         FrontVanillaLowerForwardMultiply( front.L2D, W );
     else
         LogicError("Unsupported front type");
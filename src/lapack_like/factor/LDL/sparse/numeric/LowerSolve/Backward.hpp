@@ -21,12 +21,14 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_BACKWARD_HPP
 
 #include "./FrontBackward.hpp"
+#include "./Schedule.hpp"
 
 namespace El {
 namespace ldl {
 
+// Solve against a single front and set up the workspaces of its children
 template<typename F> 
-inline void LowerBackwardSolve
+inline void LowerBackwardSolveNode
 ( const NodeInfo& info, 
   const Front<F>& front,
         MatrixNode<F>& X, bool conjugate )
@@ -64,11 +66,13 @@ inline void LowerBackwardSolve
 
         // Update the child's workspace
         const Int childUSize = childWB.Height();
-        for( Int iChild=0; iChild<childUSize; ++iChild )
+        const auto& relInds = info.childRelInds[c];
+        for( Int j=0; j<numRHS; ++j )
         {
-            const Int i = info.childRelInds[c][iChild];
-            for( Int j=0; j<numRHS; ++j )
-                childWB(iChild,j) = W(i,j);
+            const F* WCol = W.LockedBuffer(0,j);
+            F* childWBCol = childWB.Buffer(0,j);
+            for( Int iChild=0; iChild<childUSize; ++iChild )
+                childWBCol[iChild] = WCol[relInds[iChild]];
         }
     }
     if( haveParent )
@@ -77,22 +81,96 @@ inline void LowerBackwardSolve
         dupMV->work.Empty();
     else if( haveDupMatParent )
         dupMat->work.Empty();
+}
 
+template<typename F> 
+inline void LowerBackwardSolveSubtree
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X, bool conjugate )
+{
+    EL_DEBUG_CSE
+    LowerBackwardSolveNode( info, front, X, conjugate );
+    const Int numChildren = front.children.size();
     for( Int c=0; c<numChildren; ++c )
-        LowerBackwardSolve
+        LowerBackwardSolveSubtree
         ( *info.children[c], *front.children[c], *X.children[c], conjugate );
 }
 
+// Solve one front at a time in reverse post-order, with the spilled factors
+// read back from the out-of-core store ahead of their use
+template<typename F> 
+inline void LowerBackwardSolveOutOfCore
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X, bool conjugate,
+        FrontStore<F>& store )
+{
+    EL_DEBUG_CSE
+    vector<SolveTask<F>> nodes;
+    PostOrderSolveTasks( info, front, X, nodes );
+    std::reverse( nodes.begin(), nodes.end() );
+    vector<const Front<F>*> fronts;
+    for( const auto& node : nodes )
+        fronts.push_back( node.front );
+    store.Traverse
+    ( fronts,
+      [&]( Int k )
+      {
+          LowerBackwardSolveNode
+          ( *nodes[k].info, *nodes[k].front, *nodes[k].X, conjugate );
+      } );
+}
+
+template<typename F> 
+inline void LowerBackwardSolve
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X, bool conjugate,
+        FrontStore<F>* store=nullptr )
+{
+    EL_DEBUG_CSE
+    if( store != nullptr && store->NumSpilled() > 0 )
+    {
+        LowerBackwardSolveOutOfCore( info, front, X, conjugate, *store );
+        return;
+    }
+
+    vector<SolveTask<F>> subtrees, topNodes;
+    ScheduleSolveTree( info, front, X, subtrees, topNodes );
+    const Int numSubtrees = subtrees.size();
+    if( numSubtrees == 1 )
+    {
+        LowerBackwardSolveSubtree( info, front, X, conjugate );
+        return;
+    }
+
+    // Process the top of the tree one front at a time (with each parent
+    // preceding its children)
+    for( auto it=topNodes.rbegin(); it!=topNodes.rend(); ++it )
+        LowerBackwardSolveNode( *it->info, *it->front, *it->X, conjugate );
+
+    // Solve the independent subtrees with a single-threaded BLAS
+    SolveSubtrees
+    ( subtrees,
+      [&]( const SolveTask<F>& task )
+      {
+          LowerBackwardSolveSubtree
+          ( *task.info, *task.front, *task.X, conjugate );
+      } );
+}
+
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
-  const DistFront<F>& front, DistMultiVecNode<F>& X, bool conjugate )
+  const DistFront<F>& front, DistMultiVecNode<F>& X, bool conjugate,
+  FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
     if( front.duplicate != nullptr )
     {
         LowerBackwardSolve
-        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
+        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate, store );
         return;
     }
 
@@ -183,20 +261,22 @@ inline void LowerBackwardSolve
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    LowerBackwardSolve( *info.child, *front.child, *X.child, conjugate );
+    LowerBackwardSolve
+    ( *info.child, *front.child, *X.child, conjugate, store );
 }
 
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMatrixNode<F>& X, bool conjugate )
+        DistMatrixNode<F>& X, bool conjugate,
+        FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
     if( front.duplicate != nullptr )
     {
         LowerBackwardSolve
-        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
+        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate, store );
         return;
     }
 
@@ -291,7 +371,8 @@ inline void LowerBackwardSolve
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    LowerBackwardSolve( *info.child, *front.child, *X.child, conjugate );
+    LowerBackwardSolve
+    ( *info.child, *front.child, *X.child, conjugate, store );
 }
 
 } // namespace ldl
@@ -21,23 +21,20 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_FORWARD_HPP
 
 #include "./FrontForward.hpp"
+#include "./Schedule.hpp"
 
 namespace El {
 namespace ldl {
 
+// Solve against a single front after its children have been processed
 template<typename F> 
-void LowerForwardSolve
+void LowerForwardSolveNode
 ( const NodeInfo& info, 
   const Front<F>& front,
         MatrixNode<F>& X )
 {
     EL_DEBUG_CSE
 
-    const Int numChildren = info.children.size();
-    for( Int c=0; c<numChildren; ++c )
-        LowerForwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c] );
-
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
     //       (or a duplicate's parent)
@@ -50,6 +47,7 @@ void LowerForwardSolve
     Zero( WB );
 
     // Update using the children (if they exist)
+    const Int numChildren = info.children.size();
     for( Int c=0; c<numChildren; ++c )
     {
         auto& childW = X.children[c]->work;
@@ -58,11 +56,13 @@ void LowerForwardSolve
         const Int childUSize = childHeight-childSize;
 
         auto childU = childW( IR(childSize,childHeight), IR(0,numRHS) );
-        for( Int iChild=0; iChild<childUSize; ++iChild )
+        const auto& relInds = info.childRelInds[c];
+        for( Int j=0; j<numRHS; ++j )
         {
-            const Int iFront = info.childRelInds[c][iChild]; 
-            for( Int j=0; j<numRHS; ++j )
-                W(iFront,j) += childU(iChild,j);
+            const F* childUCol = childU.LockedBuffer(0,j);
+            F* WCol = W.Buffer(0,j);
+            for( Int iChild=0; iChild<childUSize; ++iChild )
+                WCol[relInds[iChild]] += childUCol[iChild];
         }
         childW.Empty();
     }
@@ -74,11 +74,82 @@ void LowerForwardSolve
     X.matrix = WT;
 }
 
+template<typename F> 
+void LowerForwardSolveSubtree
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        LowerForwardSolveSubtree
+        ( *info.children[c], *front.children[c], *X.children[c] );
+    LowerForwardSolveNode( info, front, X );
+}
+
+// Solve one front at a time in post-order, with the spilled factors read back
+// from the out-of-core store ahead of their use
+template<typename F> 
+void LowerForwardSolveOutOfCore
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X,
+        FrontStore<F>& store )
+{
+    EL_DEBUG_CSE
+    vector<SolveTask<F>> nodes;
+    PostOrderSolveTasks( info, front, X, nodes );
+    vector<const Front<F>*> fronts;
+    for( const auto& node : nodes )
+        fronts.push_back( node.front );
+    store.Traverse
+    ( fronts,
+      [&]( Int k )
+      { LowerForwardSolveNode( *nodes[k].info, *nodes[k].front, *nodes[k].X ); }
+    );
+}
+
+template<typename F> 
+void LowerForwardSolve
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X,
+        FrontStore<F>* store=nullptr )
+{
+    EL_DEBUG_CSE
+    if( store != nullptr && store->NumSpilled() > 0 )
+    {
+        LowerForwardSolveOutOfCore( info, front, X, *store );
+        return;
+    }
+
+    vector<SolveTask<F>> subtrees, topNodes;
+    ScheduleSolveTree( info, front, X, subtrees, topNodes );
+    const Int numSubtrees = subtrees.size();
+    if( numSubtrees == 1 )
+    {
+        LowerForwardSolveSubtree( info, front, X );
+        return;
+    }
+
+    // Solve the independent subtrees with a single-threaded BLAS
+    SolveSubtrees
+    ( subtrees,
+      []( const SolveTask<F>& task )
+      { LowerForwardSolveSubtree( *task.info, *task.front, *task.X ); } );
+
+    // Finish the top of the tree (in post-order) one front at a time
+    for( const auto& task : topNodes )
+        LowerForwardSolveNode( *task.info, *task.front, *task.X );
+}
+
 template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMultiVecNode<F>& X )
+        DistMultiVecNode<F>& X,
+        FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
 
@@ -86,7 +157,8 @@ void LowerForwardSolve
     const Grid& grid = ( frontIs1D ? front.L1D.Grid() : front.L2D.Grid() );
     if( front.duplicate != nullptr )
     {
-        LowerForwardSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        LowerForwardSolve
+        ( *info.duplicate, *front.duplicate, *X.duplicate, store );
         X.work.LockedAttach( grid, X.duplicate->work );
         return;
     }
@@ -98,7 +170,7 @@ void LowerForwardSolve
           LogicError("Incompatible front type mixture");
     )
 
-    LowerForwardSolve( childInfo, childFront, *X.child );
+    LowerForwardSolve( childInfo, childFront, *X.child, store );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is a parent
@@ -183,7 +255,8 @@ template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMatrixNode<F>& X )
+        DistMatrixNode<F>& X,
+        FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -194,7 +267,8 @@ void LowerForwardSolve
     const Grid& grid = front.L2D.Grid();
     if( front.duplicate != nullptr )
     {
-        LowerForwardSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        LowerForwardSolve
+        ( *info.duplicate, *front.duplicate, *X.duplicate, store );
         X.work.LockedAttach( grid, X.duplicate->work );
         return;
     }
@@ -206,7 +280,7 @@ void LowerForwardSolve
           LogicError("Incompatible front type mixture");
     )
 
-    LowerForwardSolve( childInfo, childFront, *X.child );
+    LowerForwardSolve( childInfo, childFront, *X.child, store );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is a parent
@@ -104,6 +104,28 @@ void FrontVanillaLowerBackwardSolve
     Trsm( LEFT, LOWER, orientation, UNIT, F(1), LT, XT, true );
 }
 
+template<typename F>
+void FrontBLRLowerBackwardSolve
+( const Matrix<F>& LT,
+  const BLRMatrix<F>& LB,
+        Matrix<F>& X,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( LT.Height() != LT.Width() || LT.Width() != LB.Width() ||
+          LT.Height()+LB.Height() != X.Height() )
+          LogicError("Nonconformal BLR solve");
+    )
+    const Int n = LT.Width();
+    auto XT = X( IR(0,n),   ALL );
+    auto XB = X( IR(n,END), ALL );
+
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    LB.Multiply( orientation, F(-1), XB, XT );
+    Trsm( LEFT, LOWER, orientation, UNIT, F(1), LT, XT, true );
+}
+
 template<typename F>
 void FrontIntraPivLowerBackwardSolve
 ( const Matrix<F>& L,
@@ -691,6 +713,9 @@ void FrontLowerBackwardSolve
         else if( PivotedFactorization(type) )
             FrontIntraPivLowerBackwardSolve
             ( front.LDense, front.p, W, conjugate );
+        else if( front.LBLR.Height() > 0 )
+            FrontBLRLowerBackwardSolve
+            ( front.LDense, front.LBLR, W, conjugate );
         else
             FrontVanillaLowerBackwardSolve( front.LDense, W, conjugate );
     }
@@ -710,7 +735,7 @@ void FrontLowerBackwardSolve
     )
     const bool blocked = BlockFactorization(type);
 
-    if( type == LDL_2D )
+    if( type == LDL_2D || type == LDL_BLR_2D || type == CHOLESKY_2D )
         FrontVanillaLowerBackwardSolve( front.L2D, W, conjugate );
     else if( type == LDL_SELINV_2D )
         FrontFastLowerBackwardSolve( front.L2D, W, conjugate );
@@ -740,9 +765,9 @@ void FrontLowerBackwardSolve
     )
     const bool blocked = BlockFactorization(type);
 
-    if( type == LDL_1D )
+    if( type == LDL_1D || type == LDL_BLR_1D || type == CHOLESKY_1D )
         FrontVanillaLowerBackwardSolve( front.L1D, W, conjugate );
-    else if( type == LDL_2D )
+    else if( type == LDL_2D || type == LDL_BLR_2D || type == CHOLESKY_2D )
         FrontVanillaLowerBackwardSolve( front.L2D, W, conjugate );
     else if( type == LDL_SELINV_1D )
         FrontFastLowerBackwardSolve( front.L1D, W, conjugate );
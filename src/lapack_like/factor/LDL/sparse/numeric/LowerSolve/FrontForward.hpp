@@ -86,6 +86,26 @@ void FrontBlockLowerForwardSolve
     Gemm( NORMAL, NORMAL, F(-1), LB, XT, F(1), XB );
 }
 
+template<typename F>
+void FrontBLRLowerForwardSolve
+( const Matrix<F>& LT,
+  const BLRMatrix<F>& LB,
+        Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( LT.Height() != LT.Width() || LT.Width() != LB.Width() ||
+          LT.Height()+LB.Height() != X.Height() )
+          LogicError("Nonconformal BLR solve");
+    )
+    const Int n = LT.Width();
+    auto XT = X( IR(0,n),   ALL );
+    auto XB = X( IR(n,END), ALL );
+
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), LT, XT );
+    LB.Multiply( NORMAL, F(-1), XT, XB );
+}
+
 template<typename F>
 void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
 {
@@ -119,6 +139,8 @@ void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
             FrontBlockLowerForwardSolve( front.LDense, W );
         else if( PivotedFactorization(type) )
             FrontIntraPivLowerForwardSolve( front.LDense, front.p, W );
+        else if( front.LBLR.Height() > 0 )
+            FrontBLRLowerForwardSolve( front.LDense, front.LBLR, W );
         else
             FrontVanillaLowerForwardSolve( front.LDense, W );
     }
@@ -666,9 +688,10 @@ FrontLowerForwardSolve
     const LDLFrontType type = front.type;
 
     // TODO: Add support for LDL_2D
-    if( type == LDL_1D )
+    // (the distributed fronts of BLR factorizations are stored densely)
+    if( type == LDL_1D || type == LDL_BLR_1D || type == CHOLESKY_1D )
         FrontVanillaLowerForwardSolve( front.L1D, W );
-    else if( type == LDL_2D )
+    else if( type == LDL_2D || type == LDL_BLR_2D || type == CHOLESKY_2D )
         FrontVanillaLowerForwardSolve( front.L2D, W );
     else if( type == LDL_SELINV_1D )
         FrontFastLowerForwardSolve( front.L1D, W );
@@ -693,7 +716,7 @@ FrontLowerForwardSolve( const DistFront<F>& front, DistMatrix<F>& W )
     EL_DEBUG_CSE
     const LDLFrontType type = front.type;
 
-    if( type == LDL_2D )
+    if( type == LDL_2D || type == LDL_BLR_2D || type == CHOLESKY_2D )
         FrontVanillaLowerForwardSolve( front.L2D, W );
     else if( type == LDL_SELINV_2D )
         FrontFastLowerForwardSolve( front.L2D, W );
@@ -0,0 +1,176 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_SCHEDULE_HPP
+#define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_SCHEDULE_HPP
+
+namespace El {
+namespace ldl {
+
+template<typename F>
+struct SolveTask
+{
+    const NodeInfo* info;
+    const Front<F>* front;
+    MatrixNode<F>* X;
+    double cost;
+};
+
+// A rough estimate of the work required for the triangular solves against
+// each front of the subtree (which is proportional to the number of nonzeros)
+template<typename F>
+double SubtreeSolveCost( const NodeInfo& info, const Front<F>& front )
+{
+    double cost = double(front.Height())*info.size;
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        cost += SubtreeSolveCost( *info.children[c], *front.children[c] );
+    return cost;
+}
+
+// Split the tree (bottom-up, so that each subtree cost is only computed once)
+// into maximal subtrees whose costs do not exceed 'maxSubtreeCost' and the
+// remaining nodes above them, and return the cost of the entire tree
+template<typename F>
+double SplitSolveTree
+( const NodeInfo& info,
+  const Front<F>& front,
+        MatrixNode<F>& X,
+  double maxSubtreeCost,
+        vector<SolveTask<F>>& subtrees,
+        vector<SolveTask<F>>& topNodes )
+{
+    const Int numChildren = info.children.size();
+    const Int numSubtreesBefore = subtrees.size();
+    double cost = double(front.Height())*info.size;
+    for( Int c=0; c<numChildren; ++c )
+        cost += SplitSolveTree
+        ( *info.children[c], *front.children[c], *X.children[c],
+          maxSubtreeCost, subtrees, topNodes );
+    if( cost <= maxSubtreeCost || numChildren == 0 )
+    {
+        // Since the children were also cheap enough to be subtrees (and so
+        // did not add any top nodes), replace them with this node
+        subtrees.resize( numSubtreesBefore );
+        subtrees.push_back( SolveTask<F>{&info,&front,&X,cost} );
+    }
+    else
+    {
+        // The top nodes are stored in post-order
+        topNodes.push_back( SolveTask<F>{&info,&front,&X,cost} );
+    }
+    return cost;
+}
+
+// List the nodes of the tree in post-order (with each child preceding its
+// parent)
+template<typename F>
+void PostOrderSolveTasks
+( const NodeInfo& info,
+  const Front<F>& front,
+        MatrixNode<F>& X,
+        vector<SolveTask<F>>& nodes )
+{
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        PostOrderSolveTasks
+        ( *info.children[c], *front.children[c], *X.children[c], nodes );
+    nodes.push_back( SolveTask<F>{&info,&front,&X,0.} );
+}
+
+// Split the sequential elimination tree into a collection of independent
+// subtrees, which are handed out (largest first) to the loop threads while the
+// BLAS is single-threaded, and the remaining top of the tree, whose fronts are
+// large enough to be processed one at a time with a multithreaded BLAS.
+// If there is nothing to be gained from splitting the tree, 'subtrees' will
+// only contain the root.
+template<typename F>
+void ScheduleSolveTree
+( const NodeInfo& info,
+  const Front<F>& front,
+        MatrixNode<F>& X,
+        vector<SolveTask<F>>& subtrees,
+        vector<SolveTask<F>>& topNodes )
+{
+    EL_DEBUG_CSE
+    subtrees.clear();
+    topNodes.clear();
+    Int numThreads = 1;
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() )
+        numThreads = NumLoopThreads();
+#endif
+    if( numThreads == 1 || info.children.size() == 0 )
+    {
+        subtrees.push_back( SolveTask<F>{&info,&front,&X,0.} );
+        return;
+    }
+
+    // Aim for a few subtrees per thread so that they can be load balanced
+    const double totalCost = SubtreeSolveCost( info, front );
+    const double maxSubtreeCost = totalCost / (4*numThreads);
+    SplitSolveTree( info, front, X, maxSubtreeCost, subtrees, topNodes );
+    std::sort
+    ( subtrees.begin(), subtrees.end(),
+      []( const SolveTask<F>& a, const SolveTask<F>& b )
+      { return a.cost > b.cost; } );
+}
+
+// Apply 'solve' to each of the independent subtrees using the loop threads
+// and a single-threaded BLAS
+template<typename F,typename SolveType>
+void SolveSubtrees( const vector<SolveTask<F>>& subtrees, SolveType solve )
+{
+    EL_DEBUG_CSE
+    const Int numSubtrees = subtrees.size();
+    ThreadingCtrl threadingCtrl;
+    threadingCtrl.numBlasThreads = 1;
+    PushThreadingCtrl( threadingCtrl );
+    // Exceptions cannot propagate out of an OpenMP region, so the first one
+    // is captured (and the remaining subtrees skipped) and rethrown afterwards
+    std::exception_ptr exception;
+    bool failed = false;
+#ifdef EL_HYBRID
+    #pragma omp parallel for schedule(dynamic,1) num_threads(NumLoopThreads())
+#endif
+    for( Int k=0; k<numSubtrees; ++k )
+    {
+        bool skip;
+#ifdef EL_HYBRID
+        #pragma omp atomic read
+#endif
+        skip = failed;
+        if( skip )
+            continue;
+
+        try
+        {
+            solve( subtrees[k] );
+        }
+        catch( ... )
+        {
+#ifdef EL_HYBRID
+            #pragma omp critical(El_ldl_SolveSubtrees_exception)
+#endif
+            if( !exception )
+                exception = std::current_exception();
+#ifdef EL_HYBRID
+            #pragma omp atomic write
+#endif
+            failed = true;
+        }
+    }
+    PopThreadingCtrl();
+    if( exception )
+        std::rethrow_exception( exception );
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_SCHEDULE_HPP
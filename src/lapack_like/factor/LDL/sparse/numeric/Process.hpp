@@ -30,7 +30,11 @@ namespace ldl {
 
 template<typename Field>
 void Process
-( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+( const NodeInfo& info,
+        Front<Field>& front,
+        LDLFrontType factorType,
+  const BLRCtrl<Base<Field>>& blrCtrl=BLRCtrl<Base<Field>>(),
+        FrontStore<Field>* store=nullptr )
 {
     EL_DEBUG_CSE
     const int updateSize = info.lowerStruct.size();
@@ -38,6 +42,32 @@ void Process
     FBR.Empty();
     Zeros( FBR, updateSize, updateSize );
 
+    if( front.sparseLeaf && CholeskyFactorization(factorType) &&
+        DenseCholeskyLeaf(info) )
+    {
+        // Leaves whose factors are mostly dense are factored with the dense
+        // kernels. The sparse diagonal block is retained so that the values
+        // of the front can later be repulled in place.
+        const Int n = front.workSparse.Height();
+        const Int lowerSize = front.LDense.Height();
+        Matrix<Field> FL;
+        Zeros( FL, n+lowerSize, n );
+        const Int numEntries = front.workSparse.NumEntries();
+        for( Int e=0; e<numEntries; ++e )
+        {
+            const Int i = front.workSparse.Row(e);
+            const Int j = front.workSparse.Col(e);
+            if( i < j )
+                continue;
+            const Field value = front.workSparse.Value(e);
+            FL(i,j) = front.isHermitian ? Conj(value) : value;
+        }
+        auto FBL = FL( IR(n,END), ALL );
+        FBL = front.LDense;
+        front.LDense = FL;
+        front.sparseLeaf = false;
+    }
+
     if( front.sparseLeaf )
     {
         front.type = factorType;
@@ -123,7 +153,9 @@ void Process
         const int numChildren = info.children.size();
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
+            Process
+            ( *info.children[c], *front.children[c], factorType, blrCtrl,
+              store );
 
             auto& childU = front.children[c]->workDense;
             const int childUSize = childU.Height();
@@ -142,13 +174,22 @@ void Process
             }
             childU.Empty();
         }
-        ProcessFront( front, factorType );
+        ProcessFront( front, factorType, blrCtrl );
     }
+
+    // The dense factor of the top of a sequential subtree of a distributed
+    // tree is shared with its DistFront and therefore cannot be spilled
+    if( store != nullptr && front.duplicate == nullptr )
+        store->Add( front );
 }
 
 template<typename Field>
 void Process
-( const DistNodeInfo& info, DistFront<Field>& front, LDLFrontType factorType )
+( const DistNodeInfo& info,
+        DistFront<Field>& front,
+        LDLFrontType factorType,
+  const BLRCtrl<Base<Field>>& blrCtrl=BLRCtrl<Base<Field>>(),
+        FrontStore<Field>* store=nullptr )
 {
     EL_DEBUG_CSE
 
@@ -158,7 +199,7 @@ void Process
         const Grid& grid = info.Grid();
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        Process( *info.duplicate, frontDup, factorType, blrCtrl, store );
 
         // Pull the relevant information up from the duplicate
         front.type = frontDup.type;
@@ -179,7 +220,7 @@ void Process
 
     const auto& childInfo = *info.child;
     auto& childFront = *front.child;
-    Process( childInfo, childFront, factorType );
+    Process( childInfo, childFront, factorType, blrCtrl, store );
 
     const Int updateSize = info.lowerStruct.size();
     front.work.Empty();
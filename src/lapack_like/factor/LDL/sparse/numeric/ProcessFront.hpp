@@ -72,6 +72,36 @@ void ProcessFrontVanilla( Matrix<F>& AL, Matrix<F>& ABR, bool conjugate )
     }
 }
 
+template<typename F>
+void ProcessFrontCholesky( Matrix<F>& AL, Matrix<F>& ABR, bool conjugate )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( ABR.Height() != ABR.Width() )
+          LogicError("ABR must be square");
+      if( AL.Height() != AL.Width() + ABR.Width() )
+          LogicError("AL and ABR don't have conformal dimensions");
+    )
+    if( IsComplex<F>::value && !conjugate )
+        LogicError("Cholesky fronts require a Hermitian matrix");
+    const Int n = AL.Width();
+    auto ATL = AL( IR(0,n), ALL );
+    auto ABL = AL( IR(n,END), ALL );
+
+    // Factor the diagonal block as C C^H and form the Schur complement
+    Cholesky( LOWER, ATL );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), ATL, ABL );
+    Herk( LOWER, NORMAL, Base<F>(-1), ABL, Base<F>(1), ABR );
+
+    // Store L D L^H, with L = C inv(diag(C)) and D = diag(C)^2, so that the
+    // factors can be applied by the usual unit-diagonal LDL solves
+    Matrix<F> c;
+    GetDiagonal( ATL, c );
+    DiagonalSolve( RIGHT, NORMAL, c, AL );
+    for( Int j=0; j<n; ++j )
+        ATL(j,j) = c(j)*c(j);
+}
+
 template<typename F>
 void ProcessFrontIntraPiv
 ( Matrix<F>& AL,
@@ -153,8 +183,106 @@ void ProcessFrontBlock
     }
 }
 
+// Factor the diagonal block densely and compress the connectivity into a
+// block low-rank matrix, which is then used to form the Schur complement
+template<typename F>
+void ProcessFrontBLR
+( Matrix<F>& AL,
+  BLRMatrix<F>& LB,
+  Matrix<F>& d,
+  Matrix<F>& ABR,
+  bool conjugate,
+  const BLRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = AL.Width();
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    auto ATL = AL( IR(0,n  ), ALL );
+    auto ABL = AL( IR(n,END), ALL );
+
+    LDL( ATL, conjugate );
+    GetDiagonal( ATL, d );
+
+    // Compress S_BL := A_BL inv(L_TL)^{T/H} and only keep the diagonal block
+    // in dense form
+    Trsm( RIGHT, LOWER, orientation, UNIT, F(1), ATL, ABL );
+    LB.Compress( ABL, ctrl.tileSize, ctrl.tol );
+    Matrix<F> LTL( ATL );
+    AL.Empty();
+    AL = LTL;
+    LTL.Empty();
+
+    // A_BR := A_BR - S_BL inv(D) S_BL^{T/H}, one column of tiles at a time,
+    // while overwriting S_BL with L_BL := S_BL inv(D). A tile of S_BL is
+    // either U (dense) or U R (low-rank), and the update of each pair of
+    // row tiles is accumulated in the cheapest order.
+    const Int m = LB.Height();
+    const Int tileSize = LB.tileSize;
+    const Int numRowTiles = LB.NumRowTiles();
+    const Int numColTiles = LB.NumColTiles();
+    vector<Matrix<F>> Y( numRowTiles );
+    Matrix<F> P, Q;
+    for( Int k=0; k<numColTiles; ++k )
+    {
+        const Range<Int> indk( k*tileSize, Min((k+1)*tileSize,n) );
+        auto dk = d( indk, ALL );
+
+        // Y_i := R_ik inv(D_k), where R_ik is V_ik or the dense tile
+        for( Int i=0; i<numRowTiles; ++i )
+        {
+            const Int t = i + k*numRowTiles;
+            Y[i] = ( LB.lowRank[t] ? LB.V[t] : LB.U[t] );
+            DiagonalSolve( RIGHT, NORMAL, dk, Y[i] );
+        }
+
+        for( Int j=0; j<numRowTiles; ++j )
+        {
+            const Int tj = j + k*numRowTiles;
+            const Range<Int> indj( j*tileSize, Min((j+1)*tileSize,m) );
+            const auto& Rj = ( LB.lowRank[tj] ? LB.V[tj] : LB.U[tj] );
+            if( Rj.Height() == 0 )
+                continue;
+            for( Int i=j; i<numRowTiles; ++i )
+            {
+                const Int ti = i + k*numRowTiles;
+                if( Y[i].Height() == 0 )
+                    continue;
+                const Range<Int> indi( i*tileSize, Min((i+1)*tileSize,m) );
+                auto ABRij = ABR( indi, indj );
+
+                Gemm( NORMAL, orientation, F(1), Y[i], Rj, P );
+                const Matrix<F>* UP = &P;
+                if( LB.lowRank[ti] )
+                {
+                    Gemm( NORMAL, NORMAL, F(1), LB.U[ti], P, Q );
+                    UP = &Q;
+                }
+                if( LB.lowRank[tj] )
+                    Gemm
+                    ( NORMAL, orientation, F(-1), *UP, LB.U[tj], F(1), ABRij );
+                else
+                    ABRij -= *UP;
+            }
+        }
+
+        for( Int i=0; i<numRowTiles; ++i )
+        {
+            const Int t = i + k*numRowTiles;
+            if( LB.lowRank[t] )
+                LB.V[t] = std::move( Y[i] );
+            else
+                LB.U[t] = std::move( Y[i] );
+            Y[i].Empty();
+        }
+    }
+}
+
 template<typename F>
-void ProcessFront( Front<F>& front, LDLFrontType factorType )
+void ProcessFront
+( Front<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl=BLRCtrl<Base<F>>() )
 {
     EL_DEBUG_CSE
     front.type = factorType;
@@ -181,6 +309,28 @@ void ProcessFront( Front<F>& front, LDLFrontType factorType )
           front.isHermitian );
         GetDiagonal( front.LDense, front.diag );
     }
+    else if( CholeskyFactorization(factorType) )
+    {
+        ProcessFrontCholesky
+        ( front.LDense,
+          front.workDense,
+          front.isHermitian );
+        GetDiagonal( front.LDense, front.diag );
+    }
+    else if( BLRFactorization(factorType) &&
+             front.Height() >= blrCtrl.minSize &&
+             front.duplicate == nullptr )
+    {
+        // (The top of a sequential subtree of a distributed tree shares its
+        //  dense factor with its DistFront and is therefore not compressed)
+        ProcessFrontBLR
+        ( front.LDense,
+          front.LBLR,
+          front.diag,
+          front.workDense,
+          front.isHermitian,
+          blrCtrl );
+    }
     else
     {
         ProcessFrontVanilla
@@ -270,6 +420,43 @@ void ProcessFrontVanilla
     }
 }
 
+template<typename F>
+void ProcessFrontCholesky
+( DistMatrix<F>& AL,
+  DistMatrix<F>& ABR,
+  bool conjugate=true )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( ABR.Height() != ABR.Width() )
+          LogicError("ABR must be square");
+      if( AL.Height() != AL.Width()+ABR.Height() )
+          LogicError("AL and ABR must have compatible dimensions");
+      if( AL.Grid() != ABR.Grid() )
+          LogicError("AL and ABR must use the same grid");
+    )
+    if( IsComplex<F>::value && !conjugate )
+        LogicError("Cholesky fronts require a Hermitian matrix");
+    const Grid& g = AL.Grid();
+    const Int n = AL.Width();
+    auto ATL = AL( IR(0,n), ALL );
+    auto ABL = AL( IR(n,END), ALL );
+
+    Cholesky( LOWER, ATL );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), ATL, ABL );
+    Herk( LOWER, NORMAL, Base<F>(-1), ABL, Base<F>(1), ABR );
+
+    // Convert to the L D L^H form used by the solves (see the sequential case)
+    DistMatrix<F,MD,STAR> c(g);
+    GetDiagonal( ATL, c );
+    DiagonalSolve( RIGHT, NORMAL, c, AL );
+    auto& cLoc = c.Matrix();
+    const Int cLocHeight = cLoc.Height();
+    for( Int iLoc=0; iLoc<cLocHeight; ++iLoc )
+        cLoc(iLoc) = cLoc(iLoc)*cLoc(iLoc);
+    SetDiagonal( ATL, c );
+}
+
 template<typename F>
 void ProcessFrontIntraPiv
 ( DistMatrix<F>& AL,
@@ -386,6 +573,14 @@ void ProcessFront( DistFront<F>& front, LDLFrontType factorType )
         front.diag = diag;
         front.subdiag = subdiag;
     }
+    else if( CholeskyFactorization(factorType) )
+    {
+        ProcessFrontCholesky( front.L2D, front.work, front.isHermitian );
+
+        auto diag = GetDiagonal( front.L2D );
+        front.diag.SetGrid( grid );
+        front.diag = diag;
+    }
     else
     {
         ProcessFrontVanilla( front.L2D, front.work, front.isHermitian );
@@ -51,6 +51,7 @@ void SparseLDLFactorization<Field>::Initialize
     ldl::NestedDissection
     ( A.LockedGraph(), map_, *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
+    store_.reset();
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
 
     initialized_ = true;
@@ -72,6 +73,7 @@ void SparseLDLFactorization<Field>::Initialize2DGridGraph
     ( gridDim0, gridDim1, 1, A.LockedGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
+    store_.reset();
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
 
     initialized_ = true;
@@ -94,6 +96,7 @@ void SparseLDLFactorization<Field>::Initialize3DGridGraph
     ( gridDim0, gridDim1, gridDim2, A.LockedGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
+    store_.reset();
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
 
     initialized_ = true;
@@ -114,8 +117,15 @@ void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     // Convert from 1D to 2D if necessary
     ChangeFrontType( SYMM_2D );
     
-    // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    // Perform the initial factorization (spilling the completed sequential
+    // fronts if an out-of-core factorization was requested)
+    store_.reset();
+    if( outOfCoreCtrl_.enabled )
+        store_.reset( new ldl::FrontStore<Field>(outOfCoreCtrl_) );
+    ldl::Process
+    ( *info_, *front_, InitialFactorType(frontType), blrCtrl_, store_.get() );
+    if( store_ != nullptr )
+        store_->Flush();
     factored_ = true;
     
     // Convert the fronts from the initial factorization to the requested form
@@ -131,6 +141,33 @@ void SparseLDLFactorization<Field>::ChangeFrontType( LDLFrontType frontType )
     ldl::ChangeFrontType( *front_, frontType );
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::SetOutOfCoreCtrl
+( const ldl::OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    outOfCoreCtrl_ = ctrl;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::SetBLRCtrl
+( const ldl::BLRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.tileSize <= 0 )
+        LogicError("BLR tile size must be positive");
+    blrCtrl_ = ctrl;
+}
+
+template<typename Field>
+ldl::OutOfCoreStats SparseLDLFactorization<Field>::OutOfCoreStats() const
+{
+    EL_DEBUG_CSE
+    if( store_ == nullptr )
+        return ldl::OutOfCoreStats();
+    return store_->Stats();
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::ChangeNonzeroValues
 ( const SparseMatrix<Field>& ANew )
@@ -138,7 +175,12 @@ void SparseLDLFactorization<Field>::ChangeNonzeroValues
     EL_DEBUG_CSE
     if( !initialized_ )
         LogicError("Must initialize before calling 'ChangeNonzeroValues()'");
-    front_->Pull( ANew, map_, *info_ );
+    if( store_ != nullptr )
+    {
+        store_->Discard();
+        store_.reset();
+    }
+    front_->Pull( ANew, map_, *info_, front_->isHermitian );
     factored_ = false;
 }
 
@@ -259,9 +301,10 @@ void SparseLDLFactorization<Field>::SolveAgainstL
     if( !factored_ )
         LogicError("Must call Factor() before SolveAgainstL()");
     if( orientation == NORMAL )
-        ldl::LowerForwardSolve( *info_, *front_, B );
+        ldl::LowerForwardSolve( *info_, *front_, B, store_.get() );
     else
-        ldl::LowerBackwardSolve( *info_, *front_, B, orientation==ADJOINT );
+        ldl::LowerBackwardSolve
+        ( *info_, *front_, B, orientation==ADJOINT, store_.get() );
 }
 
 template<typename Field>
@@ -283,10 +326,15 @@ void SparseLDLFactorization<Field>::MultiplyWithL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before MultiplyWithL()");
+    // The multiplications do not support out-of-core fronts
+    if( store_ != nullptr )
+        store_->LoadAll();
     if( orientation == NORMAL )
         ldl::LowerForwardMultiply( *info_, *front_, B );
     else
         ldl::LowerBackwardMultiply( *info_, *front_, B, orientation==ADJOINT );
+    if( store_ != nullptr )
+        store_->ReleaseAll();
 }
 
 template<typename Field>
@@ -396,6 +444,16 @@ double SparseLDLFactorization<Field>::SolveGFlops( Int numRHS ) const
     return front_->SolveGFlops( numRHS );
 }
 
+template<typename Field>
+ldl::FactorEstimate
+SparseLDLFactorization<Field>::Estimate( LDLFrontType frontType ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Estimate()'");
+    return ldl::EstimateFactorization<Field>( *info_, frontType );
+}
+
 template<typename Field>
 ldl::Front<Field>& SparseLDLFactorization<Field>::Front()
 {
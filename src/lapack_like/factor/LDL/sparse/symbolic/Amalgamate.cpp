@@ -0,0 +1,258 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// The number of entries in the lower trapezoid of a dense front
+double FrontEntries( double size, double lowerSize )
+{ return size*(size+1)/2 + size*lowerSize; }
+
+// Merge the separators of the subtree into their parents (from the bottom up)
+// and return the number of explicit zeros within the front of 'info'. Each
+// merged front lists the indices of its child before its own so that the
+// child's variables are still eliminated first.
+double AmalgamateSubtree
+( Separator& sep, NodeInfo& info, const BisectCtrl& ctrl )
+{
+    const Int numOrigChildren = info.children.size();
+    vector<double> childZeros( numOrigChildren );
+    for( Int c=0; c<numOrigChildren; ++c )
+        childZeros[c] =
+          AmalgamateSubtree( *sep.children[c], *info.children[c], ctrl );
+
+    // Merging a child into this front leaves our lower structure unchanged
+    const double lowerSize = info.lowerStruct.size();
+    double zeros = 0;
+    Int c = 0;
+    while( c < Int(info.children.size()) )
+    {
+        Separator& childSep = *sep.children[c];
+        NodeInfo& child = *info.children[c];
+        const Int numGrandchildren = child.children.size();
+        if( numGrandchildren == 0 )
+        {
+            // Leave the sparse leaves intact
+            ++c;
+            continue;
+        }
+        const double size = info.size;
+        const double childSize = child.size;
+        const double mergedEntries =
+          FrontEntries( size+childSize, lowerSize );
+        const double mergedZeros =
+          zeros + childZeros[c] + mergedEntries -
+          FrontEntries( size, lowerSize ) -
+          FrontEntries( childSize, child.lowerStruct.size() );
+        if( size+childSize > ctrl.amalgamationSize &&
+            mergedZeros > ctrl.amalgamationTol*mergedEntries )
+        {
+            ++c;
+            continue;
+        }
+
+        sep.inds.insert
+        ( sep.inds.begin(), childSep.inds.begin(), childSep.inds.end() );
+        info.size += child.size;
+        info.origLowerStruct =
+          Union( info.origLowerStruct, child.origLowerStruct );
+        zeros = mergedZeros;
+
+        // Adopt the grandchildren in place of the child
+        auto grandchildSeps = std::move( childSep.children );
+        auto grandchildren = std::move( child.children );
+        for( Int g=0; g<numGrandchildren; ++g )
+        {
+            grandchildSeps[g]->parent = &sep;
+            grandchildren[g]->parent = &info;
+        }
+        sep.children.erase( sep.children.begin()+c );
+        info.children.erase( info.children.begin()+c );
+        childZeros.erase( childZeros.begin()+c );
+        sep.children.insert
+        ( sep.children.begin()+c,
+          std::make_move_iterator(grandchildSeps.begin()),
+          std::make_move_iterator(grandchildSeps.end()) );
+        info.children.insert
+        ( info.children.begin()+c,
+          std::make_move_iterator(grandchildren.begin()),
+          std::make_move_iterator(grandchildren.end()) );
+        childZeros.insert( childZeros.begin()+c, numGrandchildren, 0. );
+        c += numGrandchildren;
+    }
+    return zeros;
+}
+
+// Assign the offsets of the subtree in postorder, where the separator indices
+// are temporarily the previous positions of the variables
+Int Renumber
+( Separator& sep, NodeInfo& info, Int off, Int rangeStart,
+  vector<Int>& newPositions )
+{
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        off = Renumber
+          ( *sep.children[c], *info.children[c], off, rangeStart,
+            newPositions );
+    sep.off = off;
+    info.off = off;
+    for( Int t=0; t<info.size; ++t )
+        newPositions[sep.inds[t]-rangeStart] = off+t;
+    return off + info.size;
+}
+
+void Translate
+( Separator& sep, NodeInfo& info, Int rangeStart,
+  const vector<Int>& newPositions, const vector<Int>& origInds )
+{
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        Translate
+        ( *sep.children[c], *info.children[c], rangeStart, newPositions,
+          origInds );
+
+    // The original structure of a merged front can include its own indices,
+    // whereas the indices beyond the subtree belong to distributed ancestors
+    const Int rangeEnd = rangeStart + newPositions.size();
+    vector<Int> origLowerStruct;
+    origLowerStruct.reserve( info.origLowerStruct.size() );
+    for( const Int i : info.origLowerStruct )
+    {
+        const Int iNew =
+          ( i >= rangeStart && i < rangeEnd ? newPositions[i-rangeStart] : i );
+        if( iNew >= info.off+info.size )
+            origLowerStruct.push_back( iNew );
+    }
+    std::sort( origLowerStruct.begin(), origLowerStruct.end() );
+    info.origLowerStruct = origLowerStruct;
+
+    for( Int t=0; t<info.size; ++t )
+        sep.inds[t] = origInds[sep.inds[t]-rangeStart];
+}
+
+void AddToHistogram( vector<Int>& histogram, Int size )
+{
+    Int bucket = 0;
+    for( Int s=size; s>1; s/=2 )
+        ++bucket;
+    if( bucket >= Int(histogram.size()) )
+        histogram.resize( bucket+1, 0 );
+    ++histogram[bucket];
+}
+
+} // anonymous namespace
+
+void Amalgamate
+( Separator& rootSep, NodeInfo& rootInfo, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    // The lower structures of the fronts determine the explicit zeros
+    Analysis( rootInfo );
+
+    // The subtree occupies a contiguous range of the ordering which begins
+    // with its leftmost leaf
+    const Separator* leftmost = &rootSep;
+    while( !leftmost->children.empty() )
+        leftmost = leftmost->children.front().get();
+    const Int rangeStart = leftmost->off;
+    const Int rangeSize = rootSep.off + rootSep.inds.size() - rangeStart;
+
+    // Temporarily replace the separator indices with their positions
+    vector<Int> origInds( rangeSize );
+    function<void(Separator&)> storePositions =
+      [&]( Separator& sep )
+      {
+        for( auto& child : sep.children )
+            storePositions( *child );
+        const Int numInds = sep.inds.size();
+        for( Int t=0; t<numInds; ++t )
+        {
+            origInds[sep.off+t-rangeStart] = sep.inds[t];
+            sep.inds[t] = sep.off+t;
+        }
+      };
+    storePositions( rootSep );
+
+    AmalgamateSubtree( rootSep, rootInfo, ctrl );
+
+    vector<Int> newPositions( rangeSize );
+    Renumber( rootSep, rootInfo, rangeStart, rangeStart, newPositions );
+    Translate( rootSep, rootInfo, rangeStart, newPositions, origInds );
+}
+
+void Amalgamate
+( DistSeparator& rootSep, DistNodeInfo& rootInfo, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistSeparator* sep = &rootSep;
+    DistNodeInfo* info = &rootInfo;
+    while( sep->child != nullptr )
+    {
+        sep = sep->child.get();
+        info = info->child.get();
+    }
+    Amalgamate( *sep->duplicate, *info->duplicate, ctrl );
+
+    // Pull information up from the duplicates
+    sep->off = sep->duplicate->off;
+    sep->inds = sep->duplicate->inds;
+    info->size = info->duplicate->size;
+    info->off = info->duplicate->off;
+    info->origLowerStruct = info->duplicate->origLowerStruct;
+}
+
+vector<Int> FrontSizeHistogram( const NodeInfo& rootInfo )
+{
+    EL_DEBUG_CSE
+    vector<Int> histogram;
+    function<void(const NodeInfo&)> count =
+      [&]( const NodeInfo& info )
+      {
+        for( const auto& child : info.children )
+            count( *child );
+        AddToHistogram( histogram, info.size );
+      };
+    count( rootInfo );
+    return histogram;
+}
+
+vector<Int> FrontSizeHistogram( const DistNodeInfo& rootInfo )
+{
+    EL_DEBUG_CSE
+    // Each distributed front is counted by the root of its team, and the
+    // top of each sequential subtree is counted along with the subtree
+    const DistNodeInfo* info = &rootInfo;
+    vector<Int> localHistogram;
+    while( info->child != nullptr )
+    {
+        if( info->Grid().Rank() == 0 )
+            AddToHistogram( localHistogram, info->size );
+        info = info->child.get();
+    }
+    const auto subtreeHistogram = FrontSizeHistogram( *info->duplicate );
+    if( subtreeHistogram.size() > localHistogram.size() )
+        localHistogram.resize( subtreeHistogram.size(), 0 );
+    for( size_t k=0; k<subtreeHistogram.size(); ++k )
+        localHistogram[k] += subtreeHistogram[k];
+
+    mpi::Comm comm = rootInfo.Grid().Comm();
+    const Int numBuckets =
+      mpi::AllReduce( Int(localHistogram.size()), mpi::MAX, comm );
+    localHistogram.resize( numBuckets, 0 );
+    vector<Int> histogram( numBuckets );
+    mpi::AllReduce
+    ( localHistogram.data(), histogram.data(), numBuckets, mpi::SUM, comm );
+    return histogram;
+}
+
+} // namespace ldl
+} // namespace El
@@ -396,12 +396,23 @@ void NestedDissection
 {
     EL_DEBUG_CSE
 
-    const Int numSources = graph.NumSources();
-    vector<Int> perm(numSources);
-    for( Int s=0; s<numSources; ++s )
-        perm[s] = s;
+    const bool useCache = !ctrl.cacheDir.empty();
+    string cacheName;
+    if( useCache )
+        cacheName = OrderingCacheName( graph, ctrl );
+    if( !useCache || !LoadOrdering( cacheName, sep, info ) )
+    {
+        const Int numSources = graph.NumSources();
+        vector<Int> perm(numSources);
+        for( Int s=0; s<numSources; ++s )
+            perm[s] = s;
 
-    NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+        NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+        if( useCache )
+            SaveOrdering( cacheName, sep, info );
+    }
+    if( ctrl.amalgamate )
+        Amalgamate( sep, info, ctrl );
 
     // Construct the distributed reordering
     sep.BuildMap( map );
@@ -420,14 +431,26 @@ void NestedDissection
 {
     EL_DEBUG_CSE
 
-    DistMap perm( graph.NumSources(), graph.Grid() );
-    const Int firstLocalSource = perm.FirstLocalSource();
-    const Int numLocalSources = perm.NumLocalSources();
-    for( Int s=0; s<numLocalSources; ++s )
-        perm.SetLocal( s, s+firstLocalSource );
-
     info.SetRootGrid( graph.Grid() );
-    NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+
+    const bool useCache = !ctrl.cacheDir.empty();
+    string cacheName;
+    if( useCache )
+        cacheName = OrderingCacheName( graph, ctrl );
+    if( !useCache || !LoadOrdering( cacheName, sep, info ) )
+    {
+        DistMap perm( graph.NumSources(), graph.Grid() );
+        const Int firstLocalSource = perm.FirstLocalSource();
+        const Int numLocalSources = perm.NumLocalSources();
+        for( Int s=0; s<numLocalSources; ++s )
+            perm.SetLocal( s, s+firstLocalSource );
+
+        NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+        if( useCache )
+            SaveOrdering( cacheName, sep, info );
+    }
+    if( ctrl.amalgamate )
+        Amalgamate( sep, info, ctrl );
 
     // Construct the distributed reordering
     sep.BuildMap( info, map );
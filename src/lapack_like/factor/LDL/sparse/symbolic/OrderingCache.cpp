@@ -0,0 +1,335 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// The files begin with a magic number, a version, and sizeof(Int) so that
+// stale or foreign files are rejected rather than misinterpreted
+const Int orderingCacheMagic = 0x456c4e44; // "ElND"
+const Int orderingCacheVersion = 1;
+
+void HashCtrl( Hasher& hasher, const BisectCtrl& ctrl )
+{
+    hasher.Add( ctrl.sequential );
+    hasher.Add( ctrl.numDistSeps );
+    hasher.Add( ctrl.numSeqSeps );
+    hasher.Add( ctrl.cutoff );
+    hasher.Add( int(ctrl.engine) );
+    hasher.Add( ctrl.coarsestSize );
+    hasher.Add( ctrl.numRefineSweeps );
+    hasher.Add( ctrl.imbalance );
+}
+
+string CacheName( const string& dir, unsigned long long hash )
+{
+    char hashString[17];
+    std::snprintf( hashString, 17, "%016llx", hash );
+    return dir + "/El-nd-" + hashString;
+}
+
+void Put( std::ostream& os, Int value )
+{ os.write( reinterpret_cast<const char*>(&value), sizeof(Int) ); }
+
+void Put( std::ostream& os, const vector<Int>& values )
+{
+    Put( os, Int(values.size()) );
+    os.write
+    ( reinterpret_cast<const char*>(values.data()), values.size()*sizeof(Int) );
+}
+
+bool Get( std::istream& is, Int& value )
+{
+    is.read( reinterpret_cast<char*>(&value), sizeof(Int) );
+    return is.good();
+}
+
+bool Get( std::istream& is, vector<Int>& values )
+{
+    Int size;
+    if( !Get( is, size ) || size < 0 )
+        return false;
+    values.resize( size );
+    is.read( reinterpret_cast<char*>(values.data()), size*sizeof(Int) );
+    return is.good();
+}
+
+void PutHeader( std::ostream& os )
+{
+    Put( os, orderingCacheMagic );
+    Put( os, orderingCacheVersion );
+    Put( os, Int(sizeof(Int)) );
+}
+
+bool GetHeader( std::istream& is )
+{
+    Int magic, version, intSize;
+    return Get( is, magic ) && Get( is, version ) && Get( is, intSize ) &&
+           magic == orderingCacheMagic && version == orderingCacheVersion &&
+           intSize == Int(sizeof(Int));
+}
+
+void PutSubtree( std::ostream& os, const Separator& sep, const NodeInfo& info )
+{
+    Put( os, sep.off );
+    Put( os, sep.inds );
+    Put( os, info.origLowerStruct );
+    Put( os, info.LOffsets );
+    Put( os, info.LParents );
+    const Int numChildren = sep.children.size();
+    Put( os, numChildren );
+    for( Int c=0; c<numChildren; ++c )
+        PutSubtree( os, *sep.children[c], *info.children[c] );
+}
+
+bool GetSubtree( std::istream& is, Separator& sep, NodeInfo& info )
+{
+    Int numChildren;
+    if( !Get( is, sep.off ) || !Get( is, sep.inds ) ||
+        !Get( is, info.origLowerStruct ) ||
+        !Get( is, info.LOffsets ) || !Get( is, info.LParents ) ||
+        !Get( is, numChildren ) || numChildren < 0 )
+        return false;
+    info.size = sep.inds.size();
+    info.off = sep.off;
+
+    SwapClear( sep.children );
+    SwapClear( info.children );
+    sep.children.reserve( numChildren );
+    info.children.reserve( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+    {
+        sep.children.emplace_back( new Separator(&sep) );
+        info.children.emplace_back( new NodeInfo(&info) );
+        if( !GetSubtree( is, *sep.children.back(), *info.children.back() ) )
+            return false;
+    }
+    return true;
+}
+
+// Since the ordering can always be recomputed, a failure to store it is only
+// reported. In particular, throwing on some of the processes of a
+// distributed reordering would leave the others waiting within the
+// collectives which follow it.
+bool WriteFile( const string& filename, const string& contents )
+{
+    // Write to a temporary file and then rename it so that a concurrent (or
+    // interrupted) run never leaves a partially-written ordering behind
+    const string tmpName = filename + ".tmp";
+    bool written = false;
+    {
+        std::ofstream file( tmpName.c_str(), std::ios::binary );
+        if( file.is_open() )
+        {
+            file.write( contents.data(), contents.size() );
+            file.close();
+            written = !file.fail();
+        }
+    }
+    if( written && std::rename( tmpName.c_str(), filename.c_str() ) == 0 )
+        return true;
+    std::remove( tmpName.c_str() );
+    cerr << "Warning: could not store the ordering in " << filename << endl;
+    return false;
+}
+
+} // anonymous namespace
+
+string OrderingCacheName( const Graph& graph, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Hasher hasher;
+    HashCtrl( hasher, ctrl );
+    const Int numSources = graph.NumSources();
+    const Int numEdges = graph.NumEdges();
+    hasher.Add( numSources );
+    hasher.Add( graph.NumTargets() );
+    hasher.Add( graph.LockedOffsetBuffer(), (numSources+1)*sizeof(Int) );
+    hasher.Add( graph.LockedTargetBuffer(), numEdges*sizeof(Int) );
+    return CacheName( ctrl.cacheDir, hasher.Hash() ) + ".bin";
+}
+
+string OrderingCacheName( const DistGraph& graph, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = graph.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Hash the local portion of the graph and then hash the gathered hashes
+    // (which also fixes the distribution of the sources)
+    Hasher localHasher;
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int numLocalEdges = graph.NumLocalEdges();
+    localHasher.Add( graph.FirstLocalSource() );
+    localHasher.Add( numLocalSources );
+    localHasher.Add
+    ( graph.LockedOffsetBuffer(), (numLocalSources+1)*sizeof(Int) );
+    localHasher.Add( graph.LockedTargetBuffer(), numLocalEdges*sizeof(Int) );
+    const unsigned long long localHash = localHasher.Hash();
+    const int localHalves[2] =
+      { int(localHash & 0xffffffffULL), int(localHash >> 32) };
+    vector<int> halves( 2*commSize );
+    mpi::AllGather( localHalves, 2, halves.data(), 2, comm );
+
+    Hasher hasher;
+    HashCtrl( hasher, ctrl );
+    hasher.Add( graph.NumSources() );
+    hasher.Add( graph.NumTargets() );
+    hasher.Add( halves.data(), halves.size()*sizeof(int) );
+
+    ostringstream os;
+    os << CacheName( ctrl.cacheDir, hasher.Hash() )
+       << "-" << commSize << "-" << commRank << ".bin";
+    return os.str();
+}
+
+bool SaveOrdering
+( const string& filename, const Separator& sep, const NodeInfo& info )
+{
+    EL_DEBUG_CSE
+    ostringstream os;
+    PutHeader( os );
+    PutSubtree( os, sep, info );
+    return WriteFile( filename, os.str() );
+}
+
+bool SaveOrdering
+( const string& filename, const DistSeparator& sep, const DistNodeInfo& info )
+{
+    EL_DEBUG_CSE
+    ostringstream os;
+    PutHeader( os );
+    const DistSeparator* sepNode = &sep;
+    const DistNodeInfo* node = &info;
+    while( node->child != nullptr )
+    {
+        Put( os, Int(1) );
+        Put( os, sepNode->off );
+        Put( os, sepNode->inds );
+        Put( os, node->origLowerStruct );
+        Put( os, Int(node->child->onLeft) );
+        sepNode = sepNode->child.get();
+        node = node->child.get();
+    }
+    Put( os, Int(0) );
+    PutSubtree( os, *sepNode->duplicate, *node->duplicate );
+    return WriteFile( filename, os.str() );
+}
+
+bool LoadOrdering( const string& filename, Separator& sep, NodeInfo& info )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        return false;
+    if( !GetHeader( file ) || !GetSubtree( file, sep, info ) )
+    {
+        SwapClear( sep.children );
+        SwapClear( info.children );
+        return false;
+    }
+    return true;
+}
+
+bool LoadOrdering
+( const string& filename, DistSeparator& sep, DistNodeInfo& info )
+{
+    EL_DEBUG_CSE
+    // Parse the file before touching any communicators so that a failure on
+    // one process cannot leave the others waiting within a split
+    vector<bool> childOnLeft;
+    bool loaded = false;
+    {
+        std::ifstream file( filename.c_str(), std::ios::binary );
+        if( file.is_open() && GetHeader( file ) )
+        {
+            DistSeparator* sepNode = &sep;
+            DistNodeInfo* node = &info;
+            while( true )
+            {
+                Int hasChild, onLeft;
+                if( !Get( file, hasChild ) )
+                    break;
+                if( hasChild == 0 )
+                {
+                    sepNode->duplicate.reset( new Separator(sepNode) );
+                    node->duplicate.reset( new NodeInfo(node) );
+                    loaded =
+                      GetSubtree
+                      ( file, *sepNode->duplicate, *node->duplicate );
+                    if( loaded )
+                    {
+                        sepNode->off = sepNode->duplicate->off;
+                        sepNode->inds = sepNode->duplicate->inds;
+                        node->size = node->duplicate->size;
+                        node->off = node->duplicate->off;
+                        node->origLowerStruct =
+                          node->duplicate->origLowerStruct;
+                    }
+                    break;
+                }
+                if( !Get( file, sepNode->off ) ||
+                    !Get( file, sepNode->inds ) ||
+                    !Get( file, node->origLowerStruct ) ||
+                    !Get( file, onLeft ) )
+                    break;
+                node->size = sepNode->inds.size();
+                node->off = sepNode->off;
+                childOnLeft.push_back( onLeft != 0 );
+
+                sepNode->child.reset( new DistSeparator(sepNode) );
+                node->child.reset( new DistNodeInfo(node) );
+                node->child->onLeft = ( onLeft != 0 );
+                sepNode = sepNode->child.get();
+                node = node->child.get();
+            }
+        }
+    }
+
+    // Only use the ordering if every process found its piece of it (and
+    // the sequential subtree begins exactly when the root is not shared)
+    const Int numLevels = childOnLeft.size();
+    const bool consistent =
+      loaded && ( (numLevels == 0) == (info.Grid().Size() == 1) );
+    if( !mpi::AllReduce( int(consistent), mpi::MIN, info.Grid().Comm() ) )
+    {
+        sep.child.reset();
+        sep.duplicate.reset();
+        info.child.reset();
+        info.duplicate.reset();
+        return false;
+    }
+
+    // Rebuild the team grids in the same manner as the bisections did
+    DistNodeInfo* node = &info;
+    for( Int level=0; level<numLevels; ++level )
+    {
+        const El::Grid& grid = node->Grid();
+        mpi::Comm childComm;
+        mpi::Split
+        ( grid.Comm(), childOnLeft[level], grid.Rank(), childComm );
+        unique_ptr<El::Grid> childGrid( new El::Grid(childComm) );
+        node->child->AssignGrid( childGrid );
+        mpi::Free( childComm );
+        node = node->child.get();
+    }
+    if( node->Grid().Size() != 1 )
+        RuntimeError("Cached ordering ",filename," did not reach one process");
+    return true;
+}
+
+} // namespace ldl
+} // namespace El
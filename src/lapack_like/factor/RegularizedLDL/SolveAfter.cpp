@@ -450,6 +450,7 @@ Int LGMRESSolveAfter
   Int maxIts,
   Base<Field> relTolRefine,
   Int maxRefineIts,
+  GMRESOrthAlg orthAlg,
   bool progress )
 {
     EL_DEBUG_CSE
@@ -466,7 +467,8 @@ Int LGMRESSolveAfter
         ( A, reg, sparseLDLFact, W, relTolRefine, maxRefineIts, progress );
       };
 
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return LGMRES
+    ( applyA, precond, B, relTol, restart, maxIts, progress, orthAlg );
 }
 
 template<typename Field>
@@ -481,6 +483,7 @@ Int LGMRESSolveAfter
   Int maxIts,
   Base<Field> relTolRefine,
   Int maxRefineIts,
+  GMRESOrthAlg orthAlg,
   bool progress )
 {
     EL_DEBUG_CSE
@@ -497,7 +500,8 @@ Int LGMRESSolveAfter
         ( A, reg, d, sparseLDLFact, W, relTolRefine, maxRefineIts, progress );
       };
 
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return LGMRES
+    ( applyA, precond, B, relTol, restart, maxIts, progress, orthAlg );
 }
 
 template<typename Field>
@@ -511,6 +515,7 @@ Int LGMRESSolveAfter
   Int maxIts,
   Base<Field> relTolRefine,
   Int maxRefineIts,
+  GMRESOrthAlg orthAlg,
   bool progress )
 {
     EL_DEBUG_CSE
@@ -528,7 +533,8 @@ Int LGMRESSolveAfter
         ( A, reg, sparseLDLFact, W, relTolRefine, maxRefineIts, progress );
       };
 
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return LGMRES
+    ( applyA, precond, B, relTol, restart, maxIts, progress, orthAlg );
 }
 
 template<typename Field>
@@ -543,6 +549,7 @@ Int LGMRESSolveAfter
         Int maxIts,
         Base<Field> relTolRefine,
         Int maxRefineIts,
+        GMRESOrthAlg orthAlg,
         bool progress )
 {
     EL_DEBUG_CSE
@@ -559,7 +566,8 @@ Int LGMRESSolveAfter
         ( A, reg, d, sparseLDLFact, W, relTolRefine, maxRefineIts, progress );
       };
 
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return LGMRES
+    ( applyA, precond, B, relTol, restart, maxIts, progress, orthAlg );
 }
 
 template<typename Field>
@@ -572,7 +580,8 @@ Int FGMRESSolveAfter
         Int restart,
         Int maxIts,
         Base<Field> relTolRefine,
-        Int maxRefineIts, 
+        Int maxRefineIts,
+        GMRESOrthAlg orthAlg,
         bool progress,
         bool time )
 {
@@ -589,7 +598,8 @@ Int FGMRESSolveAfter
         ( A, reg, sparseLDLFact, W, relTolRefine, maxRefineIts, progress );
       };
 
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return FGMRES
+    ( applyA, precond, B, relTol, restart, maxIts, progress, orthAlg );
 }
 
 template<typename Field>
@@ -603,7 +613,8 @@ Int FGMRESSolveAfter
         Int restart,
         Int maxIts,
         Base<Field> relTolRefine,
-        Int maxRefineIts, 
+        Int maxRefineIts,
+        GMRESOrthAlg orthAlg,
         bool progress,
         bool time )
 {
@@ -621,7 +632,8 @@ Int FGMRESSolveAfter
         ( A, reg, d, sparseLDLFact, W, relTolRefine, maxRefineIts, progress );
       };
 
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return FGMRES
+    ( applyA, precond, B, relTol, restart, maxIts, progress, orthAlg );
 }
 
 template<typename Field>
@@ -634,7 +646,8 @@ Int FGMRESSolveAfter
         Int restart,
         Int maxIts,
         Base<Field> relTolRefine,
-        Int maxRefineIts, 
+        Int maxRefineIts,
+        GMRESOrthAlg orthAlg,
         bool progress,
         bool time )
 {
@@ -653,7 +666,8 @@ Int FGMRESSolveAfter
         ( A, reg, sparseLDLFact, W, relTolRefine, maxRefineIts, progress );
       };
 
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return FGMRES
+    ( applyA, precond, B, relTol, restart, maxIts, progress, orthAlg );
 }
 
 template<typename Field>
@@ -667,7 +681,8 @@ Int FGMRESSolveAfter
         Int restart,
         Int maxIts,
         Base<Field> relTolRefine,
-        Int maxRefineIts, 
+        Int maxRefineIts,
+        GMRESOrthAlg orthAlg,
         bool progress,
         bool time )
 {
@@ -686,7 +701,8 @@ Int FGMRESSolveAfter
         ( A, reg, d, sparseLDLFact, W, relTolRefine, maxRefineIts, progress );
       };
 
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return FGMRES
+    ( applyA, precond, B, relTol, restart, maxIts, progress, orthAlg );
 }
 
 // TODO(poulson): Add RGMRES
@@ -709,7 +725,8 @@ Int SolveAfter
           ctrl.restart,
           ctrl.maxIts,
           ctrl.relTolRefine,
-          ctrl.maxRefineIts, 
+          ctrl.maxRefineIts,
+          ctrl.orthAlg,
           ctrl.progress,
           ctrl.time );
     case REG_SOLVE_LGMRES:
@@ -719,7 +736,8 @@ Int SolveAfter
           ctrl.restart,
           ctrl.maxIts,
           ctrl.relTolRefine,
-          ctrl.maxRefineIts, 
+          ctrl.maxRefineIts,
+          ctrl.orthAlg,
           ctrl.progress );
     default:
         LogicError("Invalid refinement algorithm");
@@ -746,7 +764,8 @@ Int SolveAfter
           ctrl.restart,
           ctrl.maxIts,
           ctrl.relTolRefine,
-          ctrl.maxRefineIts, 
+          ctrl.maxRefineIts,
+          ctrl.orthAlg,
           ctrl.progress,
           ctrl.time );
     case REG_SOLVE_LGMRES:
@@ -756,7 +775,8 @@ Int SolveAfter
           ctrl.restart,
           ctrl.maxIts,
           ctrl.relTolRefine,
-          ctrl.maxRefineIts, 
+          ctrl.maxRefineIts,
+          ctrl.orthAlg,
           ctrl.progress );
     default:
         LogicError("Invalid refinement algorithm");
@@ -782,7 +802,8 @@ Int SolveAfter
           ctrl.restart,
           ctrl.maxIts,
           ctrl.relTolRefine,
-          ctrl.maxRefineIts, 
+          ctrl.maxRefineIts,
+          ctrl.orthAlg,
           ctrl.progress,
           ctrl.time );
     case REG_SOLVE_LGMRES:
@@ -792,7 +813,8 @@ Int SolveAfter
           ctrl.restart,
           ctrl.maxIts,
           ctrl.relTolRefine,
-          ctrl.maxRefineIts, 
+          ctrl.maxRefineIts,
+          ctrl.orthAlg,
           ctrl.progress );
     default:
         LogicError("Invalid refinement algorithm");
@@ -819,7 +841,8 @@ Int SolveAfter
           ctrl.restart,
           ctrl.maxIts,
           ctrl.relTolRefine,
-          ctrl.maxRefineIts, 
+          ctrl.maxRefineIts,
+          ctrl.orthAlg,
           ctrl.progress,
           ctrl.time );
     case REG_SOLVE_LGMRES:
@@ -829,7 +852,8 @@ Int SolveAfter
           ctrl.restart,
           ctrl.maxIts,
           ctrl.relTolRefine,
-          ctrl.maxRefineIts, 
+          ctrl.maxRefineIts,
+          ctrl.orthAlg,
           ctrl.progress );
     default:
         LogicError("Invalid refinement algorithm");
@@ -20,6 +20,8 @@ ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl )
     ctrl->tol = 0;
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
+    ctrl->newtonSchulz = true;
+    ctrl->newtonSchulzTol = 0.5;
     ctrl->progress = false;
     return EL_SUCCESS;
 }
@@ -29,6 +31,8 @@ ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl )
     ctrl->tol = 0;
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
+    ctrl->newtonSchulz = true;
+    ctrl->newtonSchulzTol = 0.5;
     ctrl->progress = false;
     return EL_SUCCESS;
 }
@@ -78,49 +78,64 @@ NewtonStep
     Axpy( halfMu, X, XNew );
 }
 
+// Newton-Schulz iteration steps only require matrix-matrix multiplication but
+// are only guaranteed to converge when || X^2 - I ||_2 < 1. If
+// || X^2 - I ||_F > maxResid, false is returned without forming XNew. In
+// either case, || X^2 - I ||_F is returned in 'resid'.
+
 template<typename Field>
-void
+bool
 NewtonSchulzStep
 ( const Matrix<Field>& X,
         Matrix<Field>& XTmp,
-        Matrix<Field>& XNew )
+        Matrix<Field>& XNew,
+  Base<Field> maxResid,
+  Base<Field>& resid )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-    const Int n = X.Height();
 
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    // XTmp := X^2 - I
+    Gemm( NORMAL, NORMAL, Field(1), X, X, XTmp );
+    ShiftDiagonal( XTmp, Field(-1) );
+    resid = FrobeniusNorm( XTmp );
+    if( resid > maxResid )
+        return false;
 
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    // XNew := X - 1/2 X XTmp = 1/2 X (3I - X^2)
+    XNew = X;
+    Gemm( NORMAL, NORMAL, Field(-1)/Field(2), X, XTmp, Field(1), XNew );
+    return true;
 }
 
 template<typename Field>
-void
+bool
 NewtonSchulzStep
 ( const DistMatrix<Field>& X,
         DistMatrix<Field>& XTmp,
-        DistMatrix<Field>& XNew )
+        DistMatrix<Field>& XNew,
+  Base<Field> maxResid,
+  Base<Field>& resid )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-    const Int n = X.Height();
 
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    // XTmp := X^2 - I
+    Gemm( NORMAL, NORMAL, Field(1), X, X, XTmp );
+    ShiftDiagonal( XTmp, Field(-1) );
+    resid = FrobeniusNorm( XTmp );
+    if( resid > maxResid )
+        return false;
 
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    // XNew := X - 1/2 X XTmp = 1/2 X (3I - X^2)
+    XNew = X;
+    Gemm( NORMAL, NORMAL, Field(-1)/Field(2), X, XTmp, Field(1), XNew );
+    return true;
 }
 
 // Please see Chapter 5 of Higham's
 // "Functions of Matrices: Theory and Computation" for motivation behind
 // the different choices of p, which are usually in {0,1,2}
 template<typename Field>
-Int
+SignInfo
 Newton( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
@@ -129,37 +144,74 @@ Newton( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
     if( tol == Real(0) )
         tol = A.Height()*limits::Epsilon<Real>();
 
-    Int numIts=0;
-    Matrix<Field> B;
+    // Newton-Schulz steps are attempted once the relative difference of the
+    // iterates drops below 'trialDiff'. Since || X^2 - I ||_F shrinks at least
+    // as fast as this difference, a rejected trial lowers the threshold by the
+    // factor by which its residual was too large, rather than paying for a
+    // Gemm every iteration until || X^2 - I ||_F finally becomes small enough
+    SignInfo info;
+    bool tryNewtonSchulz=false;
+    Real trialDiff=ctrl.newtonSchulzTol, relDiff=limits::Infinity<Real>();
+    Matrix<Field> B, XTmp;
     Matrix<Field> *X=&A, *XNew=&B;
-    while( numIts < ctrl.maxIts )
+    Timer timer;
+    while( info.numIts < ctrl.maxIts )
     {
-        // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
+        if( ctrl.progress )
+            timer.Start();
+
+        // Overwrite XNew with the new iterate, avoiding the inversion if the
+        // current iterate is close enough to an involution
+        bool newtonSchulz = false;
+        if( tryNewtonSchulz )
+        {
+            Real resid;
+            newtonSchulz =
+              NewtonSchulzStep( *X, XTmp, *XNew, ctrl.newtonSchulzTol, resid );
+            if( newtonSchulz )
+            {
+                ++info.numNewtonSchulzIts;
+            }
+            else
+            {
+                ++info.numNewtonSchulzRejections;
+                tryNewtonSchulz = false;
+                trialDiff = relDiff*(ctrl.newtonSchulzTol/resid);
+            }
+        }
+        if( !newtonSchulz )
+            NewtonStep( *X, *XNew, ctrl.scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
         const Real oneDiff = OneNorm( *X );
         const Real oneNew = OneNorm( *XNew );
+        relDiff = oneDiff/oneNew;
 
         // Ensure that X holds the current iterate and break if possible
-        ++numIts;
+        ++info.numIts;
         std::swap( X, XNew );
         if( ctrl.progress )
-            cout << "after " << numIts << " Newton iter's: "
-                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
-                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
-                 << tol << endl;
-        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        {
+            const double iterTime = timer.Stop();
+            cout << "after " << info.numIts
+                 << ( newtonSchulz ? " Newton-Schulz" : " Newton" )
+                 << " iter's: oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" << tol
+                 << " (" << iterTime << " seconds)" << endl;
+        }
+        if( relDiff <= Pow(oneNew,ctrl.power)*tol )
             break;
+        if( ctrl.newtonSchulz && relDiff <= trialDiff )
+            tryNewtonSchulz = true;
     }
     if( X != &A )
         A = *X;
-    return numIts;
+    return info;
 }
 
 template<typename Field>
-Int
+SignInfo
 Newton( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
@@ -168,69 +220,103 @@ Newton( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
     if( tol == Real(0) )
         tol = A.Height()*limits::Epsilon<Real>();
 
-    Int numIts=0;
-    DistMatrix<Field> B( A.Grid() );
+    SignInfo info;
+    bool tryNewtonSchulz=false;
+    Real trialDiff=ctrl.newtonSchulzTol, relDiff=limits::Infinity<Real>();
+    DistMatrix<Field> B( A.Grid() ), XTmp( A.Grid() );
     DistMatrix<Field> *X=&A, *XNew=&B;
-    while( numIts < ctrl.maxIts )
+    Timer timer;
+    while( info.numIts < ctrl.maxIts )
     {
-        // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
+        if( ctrl.progress )
+            timer.Start();
+
+        // Overwrite XNew with the new iterate, avoiding the inversion if the
+        // current iterate is close enough to an involution
+        bool newtonSchulz = false;
+        if( tryNewtonSchulz )
+        {
+            Real resid;
+            newtonSchulz =
+              NewtonSchulzStep( *X, XTmp, *XNew, ctrl.newtonSchulzTol, resid );
+            if( newtonSchulz )
+            {
+                ++info.numNewtonSchulzIts;
+            }
+            else
+            {
+                ++info.numNewtonSchulzRejections;
+                tryNewtonSchulz = false;
+                trialDiff = relDiff*(ctrl.newtonSchulzTol/resid);
+            }
+        }
+        if( !newtonSchulz )
+            NewtonStep( *X, *XNew, ctrl.scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
         const Real oneDiff = OneNorm( *X );
         const Real oneNew = OneNorm( *XNew );
+        relDiff = oneDiff/oneNew;
 
         // Ensure that X holds the current iterate and break if possible
-        ++numIts;
+        ++info.numIts;
         std::swap( X, XNew );
-        if( ctrl.progress && A.Grid().Rank() == 0 )
-            cout << "after " << numIts << " Newton iter's: "
-                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
-                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
-                 << tol << endl;
-        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        if( ctrl.progress )
+        {
+            const double iterTime = timer.Stop();
+            if( A.Grid().Rank() == 0 )
+                cout << "after " << info.numIts
+                     << ( newtonSchulz ? " Newton-Schulz" : " Newton" )
+                     << " iter's: oneDiff=" << oneDiff << ", oneNew="
+                     << oneNew << ", oneDiff/oneNew=" << oneDiff/oneNew
+                     << ", tol=" << tol << " (" << iterTime << " seconds)"
+                     << endl;
+        }
+        if( relDiff <= Pow(oneNew,ctrl.power)*tol )
             break;
+        if( ctrl.newtonSchulz && relDiff <= trialDiff )
+            tryNewtonSchulz = true;
     }
     if( X != &A )
         A = *X;
-    return numIts;
+    return info;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
-
 } // namespace sign
 
 template<typename Field>
-void Sign( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl )
+SignInfo Sign( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl )
 {
     EL_DEBUG_CSE
-    sign::Newton( A, ctrl );
+    return sign::Newton( A, ctrl );
 }
 
 template<typename Field>
-void Sign
+SignInfo Sign
 ( Matrix<Field>& A, Matrix<Field>& N, const SignCtrl<Base<Field>> ctrl )
 {
     EL_DEBUG_CSE
     Matrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    auto info = sign::Newton( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
+    return info;
 }
 
 template<typename Field>
-void Sign( AbstractDistMatrix<Field>& APre, const SignCtrl<Base<Field>> ctrl )
+SignInfo
+Sign( AbstractDistMatrix<Field>& APre, const SignCtrl<Base<Field>> ctrl )
 {
     EL_DEBUG_CSE
 
     DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    sign::Newton( A, ctrl );
+    return sign::Newton( A, ctrl );
 }
 
 template<typename Field>
-void Sign
+SignInfo Sign
 ( AbstractDistMatrix<Field>& APre,
   AbstractDistMatrix<Field>& NPre,
   const SignCtrl<Base<Field>> ctrl )
@@ -243,8 +329,9 @@ void Sign
     auto& N = NProx.Get();
 
     DistMatrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    auto info = sign::Newton( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
+    return info;
 }
 
 // The Hermitian sign decomposition is equivalent to the Hermitian polar
@@ -407,13 +494,13 @@ void HermitianSign
 }
 
 #define PROTO(Field) \
-  template void Sign \
+  template SignInfo Sign \
   ( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl ); \
-  template void Sign \
+  template SignInfo Sign \
   ( AbstractDistMatrix<Field>& A, const SignCtrl<Base<Field>> ctrl ); \
-  template void Sign \
+  template SignInfo Sign \
   ( Matrix<Field>& A, Matrix<Field>& N, const SignCtrl<Base<Field>> ctrl ); \
-  template void Sign \
+  template SignInfo Sign \
   ( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& N, \
     const SignCtrl<Base<Field>> ctrl ); \
   template void HermitianSign \
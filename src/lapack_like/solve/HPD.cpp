@@ -79,7 +79,7 @@ void HPDSolve
     SparseLDLFactorization<Field> sparseLDLFact;
     const bool hermitian = true;
     sparseLDLFact.Initialize( A, hermitian, ctrl );
-    sparseLDLFact.Factor();
+    sparseLDLFact.Factor( CHOLESKY_2D );
     /*
     sparseLDLFact.SolveWithIterativeRefinement
     ( A, B, relTolRefine, maxRefineIts );
@@ -98,7 +98,7 @@ void HPDSolve
     DistSparseLDLFactorization<Field> sparseLDLFact;
     const bool hermitian = true;
     sparseLDLFact.Initialize( A, hermitian, ctrl );
-    sparseLDLFact.Factor();
+    sparseLDLFact.Factor( CHOLESKY_2D );
     /*
     sparseLDLFact.SolveWithIterativeRefinement
     ( A, B, relTolRefine, maxRefineIts );
@@ -20,328 +20,379 @@
 namespace El {
 namespace mshs {
 
+// Rather than performing the shifted solves one at a time, the following
+// kernels simultaneously advance a chunk of (at most batched::CHUNK_SIZE)
+// shifted solves, with the chunks distributed over the OpenMP threads. The
+// state of the solves is stored in struct-of-arrays form, where entry i of the
+// vector associated with shift t is stored at buf[t+i*ldim], so that the
+// innermost loops run over the shifts of a chunk. Furthermore, the Hessenberg
+// matrix is applied in panels of columns so that each entry of the trailing
+// state is only loaded once per panel (rather than once per column).
+//
+// Only the lower-Hessenberg case is implemented directly, as the
+// upper-Hessenberg case is equivalent to applying the same algorithm to J H J
+// and J X, where J is the exchange matrix. This reversal is implemented by
+// traversing H and X with negative strides.
+
+// Update a row of the working vectors and the solutions, i.e.,
+//
+//   x(i) -= xc x w(i) + xs x eta,
+//   w(i) := -conj(s) w(i) + c eta,
+//
+// where eta is either H(i,k+1) or, if shifts is non-null, H(i,i) - shift.
 template<typename Field>
-void
-LN
-( Field alpha,
-  const Matrix<Field>& H,
-  const Matrix<Field>& shifts,
-        Matrix<Field>& X )
+void UpdateRow
+( Int numShifts,
+  const Field& eta,
+  const Field* shifts,
+  const Base<Field>* c,
+  const Field* s,
+  const Field* xc,
+  const Field* xs,
+        Field* w,
+        Field* x )
 {
-    EL_DEBUG_CSE
-    X *= alpha;
-
-    const Int m = X.Height();
-    const Int n = X.Width();
-    if( m == 0 )
-        return;
-
-    // Initialize storage for Givens rotations
-    typedef Base<Field> Real;
-    Matrix<Real> C(m,n);
-    Matrix<Field> S(m,n);
+    if( shifts == nullptr )
+    {
+        EL_SIMD
+        for( Int t=0; t<numShifts; ++t )
+        {
+            x[t] -= xc[t]*w[t] + xs[t]*eta;
+            w[t] = -Conj(s[t])*w[t] + c[t]*eta;
+        }
+    }
+    else
+    {
+        EL_SIMD
+        for( Int t=0; t<numShifts; ++t )
+        {
+            const Field etaShift = eta - shifts[t];
+            x[t] -= xc[t]*w[t] + xs[t]*etaShift;
+            w[t] = -Conj(s[t])*w[t] + c[t]*etaShift;
+        }
+    }
+}
 
-    // Initialize the workspace for shifted columns of H
-    Matrix<Field> W(m,n);
-    for( Int j=0; j<n; ++j )
+// Initialize the working vectors to the shifted first columns of H and
+// transpose the right-hand sides into struct-of-arrays form, where the first
+// column of H is given by h0[i*h0Stride] and X(i,t) is X[i*XRS+t*XCS]
+template<typename Field>
+void InitializeChunk
+( Int m,
+  Int numShifts,
+  const Field* shifts,
+  const Field* h0, Int h0Stride,
+  const Field* X, Int XRS, Int XCS,
+        Field* WT,
+        Field* XT,
+        Int ldT )
+{
+    for( Int i=0; i<m; ++i )
     {
-        MemCopy( W.Buffer(0,j), H.LockedBuffer(), m );
-        W(0,j) -= shifts(j);
+        const Field eta = h0[i*h0Stride];
+        const Field* xSrc = &X[i*XRS];
+        Field* w = &WT[i*ldT];
+        Field* x = &XT[i*ldT];
+        for( Int t=0; t<numShifts; ++t )
+        {
+            w[t] = eta;
+            x[t] = xSrc[t*XCS];
+        }
     }
+    EL_SIMD
+    for( Int t=0; t<numShifts; ++t )
+        WT[t] -= shifts[t];
+}
 
-    // Simultaneously find the LQ factorization and solve against L
-    for( Int k=0; k<m-1; ++k )
+// Apply the steps [k0,k1) of the simultaneous LQ factorization and solve
+// against L, where H(i,k0+1+l) is given by P[(i-k0)*PRS+l*PCS] for
+// k0 <= i < m and 0 <= l < k1-k0.
+template<typename Field>
+void PanelChunk
+( Int m,
+  Int k0,
+  Int k1,
+  Int numShifts,
+  const Field* shifts,
+  const Field* P, Int PRS, Int PCS,
+        Field* WT,
+        Field* XT,
+        Base<Field>* CT,
+        Field* ST,
+        Field* XCT,
+        Field* XST,
+        Int ldT )
+{
+    const Field* noShifts = nullptr;
+
+    // Perform the steps on the leading rows, [k0,k1], of the panel
+    for( Int k=k0; k<k1; ++k )
     {
-        auto hB = H( IR(k+2,m), IR(k+1) );
-        const Field etakkp1 = H(k,k+1);
-        const Field etakp1kp1 = H(k+1,k+1);
-        for( Int j=0; j<n; ++j )
+        const Int l = k-k0;
+        const Field etakkp1 = P[l*PRS+l*PCS];
+        Field* wk = &WT[k*ldT];
+        Field* xk = &XT[k*ldT];
+        Base<Field>* c = &CT[k*ldT];
+        Field* s = &ST[k*ldT];
+        Field* xc = &XCT[l*ldT];
+        Field* xs = &XST[l*ldT];
+        for( Int t=0; t<numShifts; ++t )
         {
             // Find the Givens rotation needed to zero H(k,k+1),
             //   | c        s | | H(k,k)   | = | gamma |
             //   | -conj(s) c | | H(k,k+1) |   | 0     |
-            Real c; Field s;
-            Givens( W(k,j), etakkp1, c, s );
-            C(k,j) = c;
-            S(k,j) = s;
+            Givens( wk[t], etakkp1, c[t], s[t] );
 
             // The new diagonal value of L
-            const Field lambdakk = c*W(k,j) + s*etakkp1;
+            const Field lambdakk = c[t]*wk[t] + s[t]*etakkp1;
 
             // Divide our current entry of x by the diagonal value of L
-            X(k,j) /= lambdakk;
-
-            // x(k+1:end) -= x(k) * L(k+1:end,k), where
-            // L(k+1:end,k) = c H(k+1:end,k) + s H(k+1:end,k+1). We express this
-            // more concisely as xB -= x(k) * ( c wB + s hB ).
-            // Note that we carefully handle updating the k+1'th entry since
-            // it is shift-dependent.
-            const Field mu = shifts(j);
-            const Field xc = X(k,j)*c;
-            const Field xs  = X(k,j)*s;
-            X(k+1,j) -= xc*W(k+1,j) + xs*(etakp1kp1-mu);
-            blas::Axpy
-            ( m-(k+2), -xc, W.LockedBuffer(k+2,j), 1, X.Buffer(k+2,j), 1 );
-            blas::Axpy
-            ( m-(k+2), -xs, hB.LockedBuffer(),     1, X.Buffer(k+2,j), 1 );
-
-            // Change the working vector, wB, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last
-            // to a fully-updated portion of the k+1'th column of this iteration
-            //
-            // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1)
-            W(k+1,j) = -Conj(s)*W(k+1,j) + c*(etakp1kp1-mu);
-            blas::Scal( m-(k+2), -Conj(s), W.Buffer(k+2,j), 1 );
-            blas::Axpy
-            ( m-(k+2), Field(c), hB.LockedBuffer(), 1, W.Buffer(k+2,j), 1 );
+            xk[t] /= lambdakk;
+            xc[t] = xk[t]*c[t];
+            xs[t] = xk[t]*s[t];
+        }
+
+        // x(k+1:end) -= x(k) * L(k+1:end,k), where
+        // L(k+1:end,k) = c H(k+1:end,k) + s H(k+1:end,k+1), and
+        // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1), where the
+        // shift is carefully subtracted from H(k+1,k+1). Only the rows within
+        // the panel are updated here.
+        const Int iEnd = Min(k1+1,m);
+        for( Int i=k+1; i<iEnd; ++i )
+        {
+            const Field eta = P[(i-k0)*PRS+l*PCS];
+            UpdateRow
+            ( numShifts, eta, (i==k+1 ? shifts : noShifts), c, s, xc, xs,
+              &WT[i*ldT], &XT[i*ldT] );
         }
     }
-    // Divide x(end) by L(end,end)
-    for( Int j=0; j<n; ++j )
-        X(m-1,j) /= W(m-1,j);
 
-    // Solve against Q
-    for( Int j=0; j<n; ++j )
+    // Apply all of the panel's steps to each of the trailing rows
+    for( Int i=k1+1; i<m; ++i )
     {
-        Field* x = X.Buffer(0,j);
-        const Real* c = C.LockedBuffer(0,j);
-        const Field* s = S.LockedBuffer(0,j);
-        Field tau0 = x[m-1];
-        for( Int k=m-2; k>=0; --k )
+        Field* w = &WT[i*ldT];
+        Field* x = &XT[i*ldT];
+        for( Int k=k0; k<k1; ++k )
         {
-            Field tau1 = x[k];
-            x[k+1] =       c[k] *tau0 + s[k]*tau1;
-            tau0   = -Conj(s[k])*tau0 + c[k]*tau1;
+            const Int l = k-k0;
+            UpdateRow
+            ( numShifts, P[(i-k0)*PRS+l*PCS], noShifts,
+              &CT[k*ldT], &ST[k*ldT], &XCT[l*ldT], &XST[l*ldT], w, x );
         }
-        x[0] = tau0;
     }
 }
 
+// Divide x(end) by L(end,end), solve against Q, and transpose the solutions
+// back into X
 template<typename Field>
-void
-UN
-( Field alpha,
-  const Matrix<Field>& H,
-  const Matrix<Field>& shifts,
-        Matrix<Field>& X )
+void FinishChunk
+( Int m,
+  Int numShifts,
+  const Field* WT,
+        Field* XT,
+  const Base<Field>* CT,
+  const Field* ST,
+        Int ldT,
+        Field* X, Int XRS, Int XCS )
 {
-    EL_DEBUG_CSE
-    X *= alpha;
-
-    const Int m = X.Height();
-    const Int n = X.Width();
-    if( m == 0 )
-        return;
-
-    // Initialize storage for Givens rotations
-    typedef Base<Field> Real;
-    Matrix<Real> C(m,n);
-    Matrix<Field> S(m,n);
-
-    // Initialize the workspace for shifted columns of H
-    Matrix<Field> W(m,n);
-    for( Int j=0; j<n; ++j )
+    const Field* wLast = &WT[(m-1)*ldT];
+    Field* xLast = &XT[(m-1)*ldT];
+    vector<Field> tau0( numShifts );
+    EL_SIMD
+    for( Int t=0; t<numShifts; ++t )
     {
-        MemCopy( W.Buffer(0,j), H.LockedBuffer(0,m-1), m );
-        W(m-1,j) -= shifts(j);
+        xLast[t] /= wLast[t];
+        tau0[t] = xLast[t];
     }
 
-    // Simultaneously form the RQ factorization and solve against R
-    for( Int k=m-1; k>0; --k )
+    for( Int k=m-2; k>=0; --k )
     {
-        auto hT = H( IR(0,k-1), IR(k-1) );
-        const Field etakkm1 = H(k,k-1);
-        const Field etakm1km1 = H(k-1,k-1);
-        for( Int j=0; j<n; ++j )
+        Field* xk = &XT[k*ldT];
+        Field* xkp1 = &XT[(k+1)*ldT];
+        const Base<Field>* c = &CT[k*ldT];
+        const Field* s = &ST[k*ldT];
+        EL_SIMD
+        for( Int t=0; t<numShifts; ++t )
         {
-            // Find the Givens rotation needed to zero H(k,k-1),
-            //   | c        s | | H(k,k)   | = | gamma |
-            //   | -conj(s) c | | H(k,k-1) |   | 0     |
-            Real c; Field s;
-            Givens( W(k,j), etakkm1, c, s );
-            C(k,j) = c;
-            S(k,j) = s;
-
-            // The new diagonal value of R
-            const Field rhokk = c*W(k,j) + s*etakkm1;
-
-            // Divide our current entry of x by the diagonal value of R
-            X(k,j) /= rhokk;
-
-            // x(0:k-1) -= x(k) * R(0:k-1,k), where
-            // R(0:k-1,k) = c H(0:k-1,k) + s H(0:k-1,k-1). We express this
-            // more concisely as xT -= x(k) * ( c wT + s hT ).
-            // Note that we carefully handle updating the k-1'th entry since
-            // it is shift-dependent.
-            const Field mu = shifts(j);
-            const Field xc = X(k,j)*c;
-            const Field xs = X(k,j)*s;
-            blas::Axpy( k-1, -xc, W.LockedBuffer(0,j), 1, X.Buffer(0,j), 1 );
-            blas::Axpy( k-1, -xs, hT.LockedBuffer(),   1, X.Buffer(0,j), 1 );
-            X(k-1,j) -= xc*W(k-1,j) + xs*(etakm1km1-mu);
-
-            // Change the working vector, wT, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last
-            // to a fully-updated portion of the k-1'th column of this iteration
-            //
-            // w(0:k-1) := -conj(s) H(0:k-1,k) + c H(0:k-1,k-1)
-            blas::Scal( k-1, -Conj(s), W.Buffer(0,j), 1 );
-            blas::Axpy( k-1, Field(c), hT.LockedBuffer(), 1, W.Buffer(0,j), 1 );
-            W(k-1,j) = -Conj(s)*W(k-1,j) + c*(etakm1km1-mu);
+            const Field tau1 = xk[t];
+            xkp1[t] =        c[t] *tau0[t] + s[t]*tau1;
+            tau0[t] = -Conj(s[t])*tau0[t] + c[t]*tau1;
         }
     }
-    // Divide x(0) by R(0,0)
-    for( Int j=0; j<n; ++j )
-        X(0,j) /= W(0,j);
+    for( Int t=0; t<numShifts; ++t )
+        XT[t] = tau0[t];
 
-    // Solve against Q
-    for( Int j=0; j<n; ++j )
+    for( Int i=0; i<m; ++i )
     {
-        Field* x = X.Buffer(0,j);
-        const Real* c = C.LockedBuffer(0,j);
-        const Field* s = S.LockedBuffer(0,j);
-        Field tau0 = x[0];
-        for( Int k=1; k<m; ++k )
-        {
-            Field tau1 = x[k];
-            x[k-1] =       c[k] *tau0 + s[k]*tau1;
-            tau0   = -Conj(s[k])*tau0 + c[k]*tau1;
-        }
-        x[m-1] = tau0;
+        const Field* x = &XT[i*ldT];
+        Field* xDest = &X[i*XRS];
+        for( Int t=0; t<numShifts; ++t )
+            xDest[t*XCS] = x[t];
     }
 }
 
-// NOTE: A [VC,* ] distribution might be most appropriate for the
-//       Hessenberg matrices since whole columns will need to be formed
-//       on every process and this distribution will keep the communication
-//       balanced.
-
+// The struct-of-arrays state of all of the (local) shifted solves
 template<typename Field>
-void
-LN
-( Field alpha,
-  const AbstractDistMatrix<Field>& H,
-  const AbstractDistMatrix<Field>& shiftsPre,
-        AbstractDistMatrix<Field>& XPre )
+struct SolveState
 {
-    EL_DEBUG_CSE
+    Matrix<Field> WT, XT, ST, XCT, XST;
+    Matrix<Base<Field>> CT;
 
-    DistMatrixReadWriteProxy<Field,Field,STAR,VR> XProx( XPre );
-    auto& X = XProx.Get();
+    SolveState( Int m, Int numShifts, Int panelSize )
+    : WT(numShifts,m), XT(numShifts,m), ST(numShifts,m),
+      XCT(numShifts,panelSize), XST(numShifts,panelSize), CT(numShifts,m)
+    { }
+};
 
-    ElementalProxyCtrl ctrl;
-    ctrl.colConstrain = true;
-    ctrl.colAlign = X.RowAlign();
-
-    DistMatrixReadProxy<Field,Field,VR,STAR> shiftsProx( shiftsPre, ctrl );
-    auto& shifts = shiftsProx.GetLocked();
-    auto& shiftsLoc = shifts.LockedMatrix();
-
-    X *= alpha;
-
-    const Int m = X.Height();
-    const Int nLoc = X.LocalWidth();
-    if( m == 0 )
-        return;
-    auto& XLoc = X.Matrix();
-
-    // Initialize storage for Givens rotations
-    typedef Base<Field> Real;
-    Matrix<Real> C(m,nLoc);
-    Matrix<Field> S(m,nLoc);
-
-    // Initialize the workspace for shifted columns of H
-    Matrix<Field> W(m,nLoc);
+template<typename Field>
+void Initialize
+( const Matrix<Field>& shifts,
+  const Field* h0, Int h0Stride,
+  const Field* X, Int XRS, Int XCS,
+  SolveState<Field>& state )
+{
+    const Int numShifts = state.WT.Height();
+    const Int m = state.WT.Width();
+    const Int ldT = state.WT.LDim();
+    const Int numChunks =
+      (numShifts+batched::CHUNK_SIZE-1) / batched::CHUNK_SIZE;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
     {
-        unique_ptr<AbstractDistMatrix<Field>>
-          h0( H.Construct(H.Grid(),H.Root()) );
-        LockedView( *h0, H, ALL, IR(0) );
-        DistMatrix<Field,STAR,STAR> h0_STAR_STAR( *h0 );
-        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        {
-            MemCopy( W.Buffer(0,jLoc), h0_STAR_STAR.LockedBuffer(), m );
-            W(0,jLoc) -= shiftsLoc(jLoc);
-        }
+        const Int tBeg = chunk*batched::CHUNK_SIZE;
+        const Int numChunkShifts = Min( batched::CHUNK_SIZE, numShifts-tBeg );
+        InitializeChunk
+        ( m, numChunkShifts, shifts.LockedBuffer(tBeg,0),
+          h0, h0Stride, &X[tBeg*XCS], XRS, XCS,
+          state.WT.Buffer(tBeg,0), state.XT.Buffer(tBeg,0), ldT );
     }
+}
 
-    // Simultaneously find the LQ factorization and solve against L
-    unique_ptr<AbstractDistMatrix<Field>> hB( H.Construct(H.Grid(),H.Root()) );
-    DistMatrix<Field,STAR,STAR> hB_STAR_STAR( H.Grid() );
-    for( Int k=0; k<m-1; ++k )
+template<typename Field>
+void ApplyPanel
+( Int k0,
+  Int k1,
+  const Matrix<Field>& shifts,
+  const Field* P, Int PRS, Int PCS,
+  SolveState<Field>& state )
+{
+    const Int numShifts = state.WT.Height();
+    const Int m = state.WT.Width();
+    const Int ldT = state.WT.LDim();
+    const Int numChunks =
+      (numShifts+batched::CHUNK_SIZE-1) / batched::CHUNK_SIZE;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
     {
-        LockedView( *hB, H, IR(k+2,m), IR(k+1) );
-        hB_STAR_STAR = *hB;
-        const Field etakkp1 = H.Get(k,k+1);
-        const Field etakp1kp1 = H.Get(k+1,k+1);
-        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        {
-            // Find the Givens rotation needed to zero H(k,k+1),
-            //   | c        s | | H(k,k)   | = | gamma |
-            //   | -conj(s) c | | H(k,k+1) |   | 0     |
-            Real c; Field s;
-            Givens( W(k,jLoc), etakkp1, c, s );
-            C(k,jLoc) = c;
-            S(k,jLoc) = s;
-
-            // The new diagonal value of L
-            const Field lambdakk = c*W(k,jLoc) + s*etakkp1;
+        const Int tBeg = chunk*batched::CHUNK_SIZE;
+        const Int numChunkShifts = Min( batched::CHUNK_SIZE, numShifts-tBeg );
+        PanelChunk
+        ( m, k0, k1, numChunkShifts, shifts.LockedBuffer(tBeg,0),
+          P, PRS, PCS,
+          state.WT.Buffer(tBeg,0), state.XT.Buffer(tBeg,0),
+          state.CT.Buffer(tBeg,0), state.ST.Buffer(tBeg,0),
+          state.XCT.Buffer(tBeg,0), state.XST.Buffer(tBeg,0), ldT );
+    }
+}
 
-            // Divide our current entry of x by the diagonal value of L
-            XLoc(k,jLoc) /= lambdakk;
-
-            // x(k+1:end) -= x(k) * L(k+1:end,k), where
-            // L(k+1:end,k) = c H(k+1:end,k) + s H(k+1:end,k+1). We express this
-            // more concisely as xB -= x(k) * ( c wB + s hB ).
-            // Note that we carefully handle updating the k+1'th entry since
-            // it is shift-dependent.
-            const Field mu = shiftsLoc(jLoc);
-            const Field xc = XLoc(k,jLoc)*c;
-            const Field xs  = XLoc(k,jLoc)*s;
-            XLoc(k+1,jLoc) -= xc*W(k+1,jLoc) + xs*(etakp1kp1-mu);
-            blas::Axpy
-            ( m-(k+2), -xc, W.LockedBuffer(k+2,jLoc), 1,
-                            X.Buffer(k+2,jLoc),       1 );
-            blas::Axpy
-            ( m-(k+2), -xs, hB_STAR_STAR.LockedBuffer(), 1,
-                            X.Buffer(k+2,jLoc),          1 );
-
-            // Change the working vector, wB, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last
-            // to a fully-updated portion of the k+1'th column of this iteration
-            //
-            // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1)
-            W(k+1,jLoc) = -Conj(s)*W(k+1,jLoc) + c*(etakp1kp1-mu);
-            blas::Scal( m-(k+2), -Conj(s), W.Buffer(k+2,jLoc), 1 );
-            blas::Axpy
-            ( m-(k+2), Field(c), hB_STAR_STAR.LockedBuffer(), 1,
-                             W.Buffer(k+2,jLoc),          1 );
-        }
+template<typename Field>
+void Finish( SolveState<Field>& state, Field* X, Int XRS, Int XCS )
+{
+    const Int numShifts = state.WT.Height();
+    const Int m = state.WT.Width();
+    const Int ldT = state.WT.LDim();
+    const Int numChunks =
+      (numShifts+batched::CHUNK_SIZE-1) / batched::CHUNK_SIZE;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int tBeg = chunk*batched::CHUNK_SIZE;
+        const Int numChunkShifts = Min( batched::CHUNK_SIZE, numShifts-tBeg );
+        FinishChunk
+        ( m, numChunkShifts,
+          state.WT.LockedBuffer(tBeg,0), state.XT.Buffer(tBeg,0),
+          state.CT.LockedBuffer(tBeg,0), state.ST.LockedBuffer(tBeg,0), ldT,
+          &X[tBeg*XCS], XRS, XCS );
     }
-    // Divide x(end) by L(end,end)
-    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        XLoc(m-1,jLoc) /= W(m-1,jLoc);
+}
 
-    // Solve against Q
-    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+// Solve (H - shift_j I) x_j = b_j for each j, where H is upper Hessenberg if
+// 'upper' is true and lower Hessenberg otherwise
+template<typename Field>
+void Solve
+( bool upper,
+  const Matrix<Field>& H,
+  const Matrix<Field>& shifts,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int m = X.Height();
+    const Int n = X.Width();
+    if( m == 0 || n == 0 )
+        return;
+    const Int panelSize = Blocksize();
+    SolveState<Field> state( m, n, panelSize );
+
+    // Entry (i,j) of the (possibly reversed) Hessenberg matrix and entry (i,t)
+    // of the (possibly reversed) right-hand sides
+    const Int ldH = H.LDim();
+    const Int HRS = ( upper ? -1 : 1 );
+    const Int HCS = ( upper ? -ldH : ldH );
+    const Field* HOrig = H.LockedBuffer( upper ? m-1 : 0, upper ? m-1 : 0 );
+    const Int XRS = ( upper ? -1 : 1 );
+    const Int XCS = X.LDim();
+    Field* XOrig = X.Buffer( upper ? m-1 : 0, 0 );
+
+    Initialize( shifts, HOrig, HRS, XOrig, XRS, XCS, state );
+    for( Int k0=0; k0<m-1; k0+=panelSize )
     {
-        Field* x = X.Buffer(0,jLoc);
-        const Real* c = C.LockedBuffer(0,jLoc);
-        const Field* s = S.LockedBuffer(0,jLoc);
-        Field tau0 = x[m-1];
-        for( Int k=m-2; k>=0; --k )
-        {
-            Field tau1 = x[k];
-            x[k+1] =       c[k] *tau0 + s[k]*tau1;
-            tau0   = -Conj(s[k])*tau0 + c[k]*tau1;
-        }
-        x[0] = tau0;
+        const Int k1 = Min( k0+panelSize, m-1 );
+        const Field* P = &HOrig[k0*HRS+(k0+1)*HCS];
+        ApplyPanel( k0, k1, shifts, P, HRS, HCS, state );
     }
+    Finish( state, XOrig, XRS, XCS );
+}
+
+template<typename Field>
+void
+LN
+( Field alpha,
+  const Matrix<Field>& H,
+  const Matrix<Field>& shifts,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    X *= alpha;
+    Solve( false, H, shifts, X );
 }
 
 template<typename Field>
 void
 UN
 ( Field alpha,
+  const Matrix<Field>& H,
+  const Matrix<Field>& shifts,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    X *= alpha;
+    Solve( true, H, shifts, X );
+}
+
+// The shifts (and right-hand sides) are distributed over the processes so
+// that each process solves an independent subset of the shifted systems; the
+// Hessenberg matrix is never redistributed as a whole but is instead
+// broadcast one panel of columns at a time.
+//
+// NOTE: A [VC,* ] distribution might be most appropriate for the
+//       Hessenberg matrices since whole columns will need to be formed
+//       on every process and this distribution will keep the communication
+//       balanced.
+
+template<typename Field>
+void Solve
+( bool upper,
+  Field alpha,
   const AbstractDistMatrix<Field>& H,
   const AbstractDistMatrix<Field>& shiftsPre,
         AbstractDistMatrix<Field>& XPre )
@@ -365,95 +416,75 @@ UN
     const Int nLoc = X.LocalWidth();
     if( m == 0 )
         return;
-    auto& XLoc = X.Matrix();
+    const Grid& grid = H.Grid();
+    const Int panelSize = Blocksize();
+    SolveState<Field> state( m, nLoc, panelSize );
 
-    // Initialize storage for Givens rotations
-    typedef Base<Field> Real;
-    Matrix<Real> C(m,nLoc);
-    Matrix<Field> S(m,nLoc);
+    // Entry (i,t) of the (possibly reversed) local right-hand sides
+    auto& XLoc = X.Matrix();
+    const Int XRS = ( upper ? -1 : 1 );
+    const Int XCS = XLoc.LDim();
+    Field* XOrig = ( nLoc > 0 ? XLoc.Buffer(upper ? m-1 : 0,0) : nullptr );
 
-    // Initialize the workspace for shifted columns of H
-    Matrix<Field> W(m,nLoc);
+    // Initialize the working vectors using the first column of the (possibly
+    // reversed) Hessenberg matrix
     {
         unique_ptr<AbstractDistMatrix<Field>>
-          hLast( H.Construct(H.Grid(),H.Root()) );
-        LockedView( *hLast, H, ALL, IR(m-1) );
-        DistMatrix<Field,STAR,STAR> hLast_STAR_STAR( *hLast );
-        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        {
-            MemCopy( W.Buffer(0,jLoc), hLast_STAR_STAR.LockedBuffer(), m );
-            W(m-1,jLoc) -= shiftsLoc(jLoc);
-        }
+          h0( H.Construct(grid,H.Root()) );
+        LockedView( *h0, H, ALL, IR(upper ? m-1 : 0) );
+        DistMatrix<Field,STAR,STAR> h0_STAR_STAR( *h0 );
+        const Field* h0Orig =
+          h0_STAR_STAR.LockedBuffer( upper ? m-1 : 0, 0 );
+        Initialize( shiftsLoc, h0Orig, XRS, XOrig, XRS, XCS, state );
     }
 
-    // Simultaneously form the RQ factorization and solve against R
-    unique_ptr<AbstractDistMatrix<Field>> hT( H.Construct(H.Grid(),H.Root()) );
-    DistMatrix<Field,STAR,STAR> hT_STAR_STAR( H.Grid() );
-    for( Int k=m-1; k>0; --k )
+    unique_ptr<AbstractDistMatrix<Field>> panel( H.Construct(grid,H.Root()) );
+    DistMatrix<Field,STAR,STAR> panel_STAR_STAR( grid );
+    for( Int k0=0; k0<m-1; k0+=panelSize )
     {
-        LockedView( *hT, H, IR(0,k-1), IR(k-1) );
-        hT_STAR_STAR = *hT;
-        const Field etakkm1 = H.Get(k,k-1);
-        const Field etakm1km1 = H.Get(k-1,k-1);
-        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        {
-            // Find the Givens rotation needed to zero H(k,k-1),
-            //   | c        s | | H(k,k)   | = | gamma |
-            //   | -conj(s) c | | H(k,k-1) |   | 0     |
-            Real c; Field s;
-            Givens( W(k,jLoc), etakkm1, c, s );
-            C(k,jLoc) = c;
-            S(k,jLoc) = s;
-
-            // The new diagonal value of R
-            const Field rhokk = c*W(k,jLoc) + s*etakkm1;
-
-            // Divide our current entry of x by the diagonal value of R
-            XLoc(k,jLoc) /= rhokk;
-
-            // x(0:k-1) -= x(k) * R(0:k-1,k), where
-            // R(0:k-1,k) = c H(0:k-1,k) + s H(0:k-1,k-1). We express this
-            // more concisely as xT -= x(k) * ( c wT + s hT ).
-            // Note that we carefully handle updating the k-1'th entry since
-            // it is shift-dependent.
-            const Field mu = shiftsLoc(jLoc);
-            const Field xc = XLoc(k,jLoc)*c;
-            const Field xs  = XLoc(k,jLoc)*s;
-            blas::Axpy
-            ( k-1, -xc, W.LockedBuffer(0,jLoc),      1, X.Buffer(0,jLoc), 1 );
-            blas::Axpy
-            ( k-1, -xs, hT_STAR_STAR.LockedBuffer(), 1, X.Buffer(0,jLoc), 1 );
-            XLoc(k-1,jLoc) -= xc*W(k-1,jLoc) + xs*(etakm1km1-mu);
-
-            // Change the working vector, wT, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last
-            // to a fully-updated portion of the k-1'th column of this iteration
-            //
-            // w(0:k-1) := -conj(s) H(0:k-1,k) + c H(0:k-1,k-1)
-            blas::Scal( k-1, -Conj(s), W.Buffer(0,jLoc), 1 );
-            blas::Axpy( k-1, Field(c), hT_STAR_STAR.LockedBuffer(), 1,
-                                   W.Buffer(0,jLoc),            1 );
-            W(k-1,jLoc) = -Conj(s)*W(k-1,jLoc) + c*(etakm1km1-mu);
-        }
-    }
-    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        XLoc(0,jLoc) /= W(0,jLoc);
+        const Int k1 = Min( k0+panelSize, m-1 );
 
-    // Solve against Q
-    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-    {
-        Field* x = X.Buffer(0,jLoc);
-        const Real* c = C.LockedBuffer(0,jLoc);
-        const Field* s = S.LockedBuffer(0,jLoc);
-        Field tau0 = x[0];
-        for( Int k=1; k<m; ++k )
-        {
-            Field tau1 = x[k];
-            x[k-1] =       c[k] *tau0 + s[k]*tau1;
-            tau0   = -Conj(s[k])*tau0 + c[k]*tau1;
-        }
-        x[m-1] = tau0;
+        // Broadcast the portion of the (possibly reversed) columns
+        // [k0+1,k1+1) of H from row k0 downward
+        if( upper )
+            LockedView( *panel, H, IR(0,m-k0), IR(m-1-k1,m-1-k0) );
+        else
+            LockedView( *panel, H, IR(k0,m), IR(k0+1,k1+1) );
+        panel_STAR_STAR = *panel;
+
+        const Int ldP = panel_STAR_STAR.LDim();
+        const Int PRS = ( upper ? -1 : 1 );
+        const Int PCS = ( upper ? -ldP : ldP );
+        const Field* P =
+          panel_STAR_STAR.LockedBuffer
+          ( upper ? m-1-k0 : 0, upper ? k1-k0-1 : 0 );
+        ApplyPanel( k0, k1, shiftsLoc, P, PRS, PCS, state );
     }
+    Finish( state, XOrig, XRS, XCS );
+}
+
+template<typename Field>
+void
+LN
+( Field alpha,
+  const AbstractDistMatrix<Field>& H,
+  const AbstractDistMatrix<Field>& shifts,
+        AbstractDistMatrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    Solve( false, alpha, H, shifts, X );
+}
+
+template<typename Field>
+void
+UN
+( Field alpha,
+  const AbstractDistMatrix<Field>& H,
+  const AbstractDistMatrix<Field>& shifts,
+        AbstractDistMatrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    Solve( true, alpha, H, shifts, X );
 }
 
 // TODO: UT and LT
@@ -0,0 +1,233 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// Copy the entries of the given rows of a sparse matrix which lie within the
+// diagonal block, [firstRow,firstRow+numRows)^2, into compressed sparse row
+// format with (sorted) column indices relative to firstRow
+template<typename Field>
+void DiagonalBlock
+( Int firstRow,
+  Int numRows,
+  const Int* offsetBuf,
+  const Int* targetBuf,
+  const Field* valueBuf,
+  vector<Int>& offsets,
+  vector<Int>& targets,
+  vector<Field>& values )
+{
+    EL_DEBUG_CSE
+    offsets.resize( numRows+1 );
+    targets.clear();
+    values.clear();
+    targets.reserve( offsetBuf[numRows]-offsetBuf[0] );
+    values.reserve( offsetBuf[numRows]-offsetBuf[0] );
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        offsets[iLoc] = targets.size();
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+        {
+            const Int jLoc = targetBuf[e] - firstRow;
+            if( jLoc >= 0 && jLoc < numRows )
+            {
+                targets.push_back( jLoc );
+                values.push_back( valueBuf[e] );
+            }
+        }
+    }
+    offsets[numRows] = targets.size();
+}
+
+template<typename Field>
+void InvertDiagonal
+( Int firstRow,
+  Int numRows,
+  const Int* offsetBuf,
+  const Int* targetBuf,
+  const Field* valueBuf,
+  Matrix<Field>& dInv )
+{
+    EL_DEBUG_CSE
+    Zeros( dInv, numRows, 1 );
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        const Int i = firstRow + iLoc;
+        Field diag = 0;
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+            if( targetBuf[e] == i )
+                diag += valueBuf[e];
+        if( diag == Field(0) )
+            RuntimeError("Diagonal entry ",i," was zero");
+        dInv(iLoc) = Field(1) / diag;
+    }
+}
+
+} // anonymous namespace
+
+template<typename Field>
+JacobiPrecond<Field>::JacobiPrecond( const SparseMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Jacobi preconditioners require square matrices");
+    InvertDiagonal
+    ( Int(0), A.Height(), A.LockedOffsetBuffer(), A.LockedTargetBuffer(),
+      A.LockedValueBuffer(), dInv_ );
+}
+
+template<typename Field>
+JacobiPrecond<Field>::JacobiPrecond( const DistSparseMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Jacobi preconditioners require square matrices");
+    InvertDiagonal
+    ( A.FirstLocalRow(), A.LocalHeight(), A.LockedOffsetBuffer(),
+      A.LockedTargetBuffer(), A.LockedValueBuffer(), dInv_ );
+}
+
+template<typename Field>
+void JacobiPrecond<Field>::operator()( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( B.Height() != dInv_.Height() )
+        LogicError("B was ",B.Height()," x ",B.Width()," but ",dInv_.Height(),
+                   " rows were expected");
+    DiagonalScale( LEFT, NORMAL, dInv_, B );
+}
+
+template<typename Field>
+void JacobiPrecond<Field>::operator()( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    operator()( B.Matrix() );
+}
+
+template<typename Field>
+ILU0Precond<Field>::ILU0Precond( const SparseMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("ILU(0) preconditioners require square matrices");
+    DiagonalBlock
+    ( Int(0), A.Height(), A.LockedOffsetBuffer(), A.LockedTargetBuffer(),
+      A.LockedValueBuffer(), offsets_, targets_, values_ );
+    Factor();
+}
+
+template<typename Field>
+ILU0Precond<Field>::ILU0Precond( const DistSparseMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("ILU(0) preconditioners require square matrices");
+    DiagonalBlock
+    ( A.FirstLocalRow(), A.LocalHeight(), A.LockedOffsetBuffer(),
+      A.LockedTargetBuffer(), A.LockedValueBuffer(),
+      offsets_, targets_, values_ );
+    Factor();
+}
+
+// The "IKJ" variant of Gaussian elimination restricted to the sparsity
+// pattern of A, e.g., Algorithm 10.4 of
+//   Yousef Saad, "Iterative Methods for Sparse Linear Systems", 2nd ed., 2003.
+template<typename Field>
+void ILU0Precond<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    const Int n = offsets_.size()-1;
+    diagInds_.resize( n );
+    vector<Int> position( n, -1 );
+    for( Int i=0; i<n; ++i )
+    {
+        const Int rowBeg = offsets_[i];
+        const Int rowEnd = offsets_[i+1];
+        for( Int e=rowBeg; e<rowEnd; ++e )
+            position[targets_[e]] = e;
+
+        Int e = rowBeg;
+        for( ; e<rowEnd && targets_[e]<i; ++e )
+        {
+            // l_ik := a_ik / u_kk and a_ij := a_ij - l_ik u_kj for the
+            // j > k within the pattern of row i
+            const Int k = targets_[e];
+            values_[e] /= values_[diagInds_[k]];
+            const Field lambda = values_[e];
+            for( Int f=diagInds_[k]+1; f<offsets_[k+1]; ++f )
+            {
+                const Int pos = position[targets_[f]];
+                if( pos >= 0 )
+                    values_[pos] -= lambda*values_[f];
+            }
+        }
+        if( e == rowEnd || targets_[e] != i || values_[e] == Field(0) )
+            RuntimeError("ILU(0) encountered a zero pivot in row ",i);
+        diagInds_[i] = e;
+
+        for( Int f=rowBeg; f<rowEnd; ++f )
+            position[targets_[f]] = -1;
+    }
+}
+
+template<typename Field>
+void ILU0Precond<Field>::operator()( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    const Int n = offsets_.size()-1;
+    if( B.Height() != n )
+        LogicError("B was ",B.Height()," x ",B.Width()," but ",n,
+                   " rows were expected");
+    const Int width = B.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        Field* b = B.Buffer(0,j);
+
+        // b := inv(L) b
+        for( Int i=0; i<n; ++i )
+        {
+            Field beta = b[i];
+            for( Int e=offsets_[i]; e<diagInds_[i]; ++e )
+                beta -= values_[e]*b[targets_[e]];
+            b[i] = beta;
+        }
+
+        // b := inv(U) b
+        for( Int i=n-1; i>=0; --i )
+        {
+            Field beta = b[i];
+            for( Int e=diagInds_[i]+1; e<offsets_[i+1]; ++e )
+                beta -= values_[e]*b[targets_[e]];
+            b[i] = beta / values_[diagInds_[i]];
+        }
+    }
+}
+
+template<typename Field>
+void ILU0Precond<Field>::operator()( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    operator()( B.Matrix() );
+}
+
+#define PROTO(Field) \
+  template class JacobiPrecond<Field>; \
+  template class ILU0Precond<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
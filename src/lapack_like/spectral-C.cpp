@@ -426,6 +426,7 @@ ElError ElPseudospecCtrlDefault_s( ElPseudospecCtrl_s* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->shiftGroupSize = 0;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
@@ -451,6 +452,7 @@ ElError ElPseudospecCtrlDefault_d( ElPseudospecCtrl_d* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->shiftGroupSize = 0;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
@@ -0,0 +1,325 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace batched {
+
+// Cyclic Jacobi for a chunk of a batch of Hermitian matrices, where entry
+// (i,j) of member t of A is stored at A[i*ARS+j*ACS+t*ABS]. Each rotation is
+// computed and applied simultaneously for every member of the chunk, so that
+// the innermost loops vectorize across the batch.
+//
+// For the 2x2 Hermitian matrix [alpha, beta; conj(beta), delta], with
+// beta = |beta| upsilon, the rotation
+//
+//   G = [c, s; -s conj(upsilon), c conj(upsilon)]
+//
+// is the product of diag(1,conj(upsilon)), which makes the off-diagonal entry
+// real, and the classical symmetric Jacobi rotation [c, s; -s, c]
+// (cf. Golub and Van Loan's "sym.schur2").
+template<Int N,typename Field>
+void JacobiKernel
+( Int nA, Int numMembers, bool lower,
+  Field* A, Int ARS, Int ACS, Int ABS,
+  Base<Field>* w, Int wRS, Int wBS,
+  Field* Q, Int QRS, Int QCS, Int QBS )
+{
+    typedef Base<Field> Real;
+    const Int n = ( N > 0 ? N : nA );
+    const Real eps = limits::Epsilon<Real>();
+    const Real safeMin = limits::SafeMin<Real>();
+    const Int maxSweeps = 50;
+
+    // Form the full Hermitian matrices from the referenced triangles
+    for( Int j=0; j<n; ++j )
+    {
+        Field* ajj = &A[j*ARS+j*ACS];
+        EL_SIMD
+        for( Int t=0; t<numMembers; ++t )
+            ajj[t*ABS] = RealPart(ajj[t*ABS]);
+        for( Int i=j+1; i<n; ++i )
+        {
+            Field* aij = &A[i*ARS+j*ACS];
+            Field* aji = &A[j*ARS+i*ACS];
+            if( lower )
+            {
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                    aji[t*ABS] = Conj(aij[t*ABS]);
+            }
+            else
+            {
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                    aij[t*ABS] = Conj(aji[t*ABS]);
+            }
+        }
+    }
+    if( Q != nullptr )
+    {
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+            {
+                Field* qij = &Q[i*QRS+j*QCS];
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                    qij[t*QBS] = ( i == j ? Field(1) : Field(0) );
+            }
+    }
+
+    vector<Real> c(numMembers), s(numMembers);
+    vector<Field> upsilon(numMembers);
+    vector<Real> offNormSquared(numMembers), totalNormSquared(numMembers);
+    for( Int sweep=0; sweep<maxSweeps; ++sweep )
+    {
+        // Stop once every member is numerically diagonal
+        for( Int t=0; t<numMembers; ++t )
+            offNormSquared[t] = totalNormSquared[t] = Real(0);
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+            {
+                const Field* aij = &A[i*ARS+j*ACS];
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                {
+                    const Real absSquared = Abs(aij[t*ABS])*Abs(aij[t*ABS]);
+                    totalNormSquared[t] += absSquared;
+                    offNormSquared[t] += ( i == j ? Real(0) : absSquared );
+                }
+            }
+        bool converged = true;
+        for( Int t=0; t<numMembers; ++t )
+            if( offNormSquared[t] > eps*eps*totalNormSquared[t] )
+                converged = false;
+        if( converged )
+            break;
+
+        for( Int p=0; p<n-1; ++p )
+        {
+            for( Int q=p+1; q<n; ++q )
+            {
+                const Field* app = &A[p*ARS+p*ACS];
+                const Field* aqq = &A[q*ARS+q*ACS];
+                const Field* apq = &A[p*ARS+q*ACS];
+                EL_SIMD
+                for( Int t=0; t<numMembers; ++t )
+                {
+                    const Real alpha = RealPart(app[t*ABS]);
+                    const Real delta = RealPart(aqq[t*ABS]);
+                    const Field beta = apq[t*ABS];
+                    const Real betaAbs = Abs(beta);
+                    // Skip (and later zero) entries which are negligible
+                    // relative to the diagonal so that members which have
+                    // already converged are not driven into the subnormal
+                    // range, where upsilon would lose its unit modulus
+                    const Real thresh =
+                      Max( eps*Sqrt(Abs(alpha)*Abs(delta)), safeMin );
+                    const bool rotate = ( betaAbs > thresh );
+                    const Real safeAbs = ( rotate ? betaAbs : Real(1) );
+                    const Real tau = (delta-alpha) / (2*safeAbs);
+                    const Real sgn = ( tau >= Real(0) ? Real(1) : Real(-1) );
+                    const Real tanTheta =
+                      ( rotate ? sgn/(Abs(tau)+Sqrt(1+tau*tau)) : Real(0) );
+                    c[t] = 1/Sqrt(1+tanTheta*tanTheta);
+                    s[t] = tanTheta*c[t];
+                    upsilon[t] = ( rotate ? beta/safeAbs : Field(1) );
+                }
+
+                // A := A G
+                for( Int i=0; i<n; ++i )
+                {
+                    Field* aip = &A[i*ARS+p*ACS];
+                    Field* aiq = &A[i*ARS+q*ACS];
+                    EL_SIMD
+                    for( Int t=0; t<numMembers; ++t )
+                    {
+                        const Field upsConj = Conj(upsilon[t]);
+                        const Field phi = aip[t*ABS];
+                        const Field psi = aiq[t*ABS];
+                        aip[t*ABS] = c[t]*phi - s[t]*upsConj*psi;
+                        aiq[t*ABS] = s[t]*phi + c[t]*upsConj*psi;
+                    }
+                }
+                // A := G^H A
+                for( Int j=0; j<n; ++j )
+                {
+                    Field* apj = &A[p*ARS+j*ACS];
+                    Field* aqj = &A[q*ARS+j*ACS];
+                    EL_SIMD
+                    for( Int t=0; t<numMembers; ++t )
+                    {
+                        const Field phi = apj[t*ABS];
+                        const Field psi = aqj[t*ABS];
+                        apj[t*ABS] = c[t]*phi - s[t]*upsilon[t]*psi;
+                        aqj[t*ABS] = s[t]*phi + c[t]*upsilon[t]*psi;
+                    }
+                }
+                // Clean up the rounding errors in the annihilated entries
+                {
+                    Field* appMod = &A[p*ARS+p*ACS];
+                    Field* aqqMod = &A[q*ARS+q*ACS];
+                    Field* apqMod = &A[p*ARS+q*ACS];
+                    Field* aqpMod = &A[q*ARS+p*ACS];
+                    EL_SIMD
+                    for( Int t=0; t<numMembers; ++t )
+                    {
+                        appMod[t*ABS] = RealPart(appMod[t*ABS]);
+                        aqqMod[t*ABS] = RealPart(aqqMod[t*ABS]);
+                        apqMod[t*ABS] = aqpMod[t*ABS] = Field(0);
+                    }
+                }
+                // Q := Q G
+                if( Q != nullptr )
+                {
+                    for( Int i=0; i<n; ++i )
+                    {
+                        Field* qip = &Q[i*QRS+p*QCS];
+                        Field* qiq = &Q[i*QRS+q*QCS];
+                        EL_SIMD
+                        for( Int t=0; t<numMembers; ++t )
+                        {
+                            const Field upsConj = Conj(upsilon[t]);
+                            const Field phi = qip[t*QBS];
+                            const Field psi = qiq[t*QBS];
+                            qip[t*QBS] = c[t]*phi - s[t]*upsConj*psi;
+                            qiq[t*QBS] = s[t]*phi + c[t]*upsConj*psi;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Extract the eigenvalues and sort them (and the eigenvectors) into
+    // ascending order member-by-member
+    for( Int i=0; i<n; ++i )
+    {
+        const Field* aii = &A[i*ARS+i*ACS];
+        Real* wi = &w[i*wRS];
+        EL_SIMD
+        for( Int t=0; t<numMembers; ++t )
+            wi[t*wBS] = RealPart(aii[t*ABS]);
+    }
+    for( Int t=0; t<numMembers; ++t )
+    {
+        Real* wt = &w[t*wBS];
+        for( Int i=0; i<n-1; ++i )
+        {
+            Int iMin = i;
+            for( Int l=i+1; l<n; ++l )
+                if( wt[l*wRS] < wt[iMin*wRS] )
+                    iMin = l;
+            if( iMin != i )
+            {
+                std::swap( wt[i*wRS], wt[iMin*wRS] );
+                if( Q != nullptr )
+                {
+                    Field* Qt = &Q[t*QBS];
+                    for( Int l=0; l<n; ++l )
+                        std::swap( Qt[l*QRS+i*QCS], Qt[l*QRS+iMin*QCS] );
+                }
+            }
+        }
+    }
+}
+
+template<typename Field>
+void HermitianEigHelper
+( UpperOrLower uplo,
+  BatchMatrix<Field>& A,
+  BatchMatrix<Base<Field>>& w,
+  BatchMatrix<Field>* Q )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Hermitian matrices must be square");
+    )
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Int batchSize = A.BatchSize();
+    w.SetLayout( A.Layout() );
+    w.Resize( n, 1, batchSize );
+    if( Q != nullptr )
+    {
+        Q->SetLayout( A.Layout() );
+        Q->Resize( n, n, batchSize );
+    }
+
+    const Int ARS = A.InnerStride();
+    const Int ACS = A.LDim();
+    const Int ABS = A.BatchStride();
+    const Int wRS = w.InnerStride();
+    const Int wBS = w.BatchStride();
+    const Int QRS = ( Q == nullptr ? 0 : Q->InnerStride() );
+    const Int QCS = ( Q == nullptr ? 0 : Q->LDim() );
+    const Int QBS = ( Q == nullptr ? 0 : Q->BatchStride() );
+    Field* ABuf = A.Buffer();
+    Real* wBuf = w.Buffer();
+    Field* QBuf = ( Q == nullptr ? nullptr : Q->Buffer() );
+    const bool lower = ( uplo == LOWER );
+
+    const Int numChunks = (batchSize+CHUNK_SIZE-1) / CHUNK_SIZE;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int kBeg = chunk*CHUNK_SIZE;
+        const Int numMembers = Min( CHUNK_SIZE, batchSize-kBeg );
+        Field* QChunk = ( QBuf == nullptr ? nullptr : &QBuf[kBeg*QBS] );
+        EL_BATCH_DISPATCH
+        ( n, JacobiKernel,
+          n, numMembers, lower,
+          &ABuf[kBeg*ABS], ARS, ACS, ABS,
+          &wBuf[kBeg*wBS], wRS, wBS,
+          QChunk, QRS, QCS, QBS )
+    }
+}
+
+template<typename Field>
+void HermitianEig
+( UpperOrLower uplo,
+  BatchMatrix<Field>& A,
+  BatchMatrix<Base<Field>>& w )
+{
+    EL_DEBUG_CSE
+    HermitianEigHelper( uplo, A, w, static_cast<BatchMatrix<Field>*>(nullptr) );
+}
+
+template<typename Field>
+void HermitianEig
+( UpperOrLower uplo,
+  BatchMatrix<Field>& A,
+  BatchMatrix<Base<Field>>& w,
+  BatchMatrix<Field>& Q )
+{
+    EL_DEBUG_CSE
+    HermitianEigHelper( uplo, A, w, &Q );
+}
+
+#define PROTO(Field) \
+  template void HermitianEig \
+  ( UpperOrLower uplo, \
+    BatchMatrix<Field>& A, \
+    BatchMatrix<Base<Field>>& w ); \
+  template void HermitianEig \
+  ( UpperOrLower uplo, \
+    BatchMatrix<Field>& A, \
+    BatchMatrix<Base<Field>>& w, \
+    BatchMatrix<Field>& Q );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace batched
+} // namespace El
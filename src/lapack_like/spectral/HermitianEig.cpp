@@ -9,6 +9,7 @@
 #include <El.hpp>
 
 #include "./HermitianEig/SDC.hpp"
+#include "./HermitianEig/QDWH.hpp"
 
 // The targeted number of pieces to break the eigenvectors into during the
 // redistribution from the [* ,VR] distribution after PMRRR to the [MC,MR]
@@ -270,6 +271,13 @@ HermitianEig
         herm_eig::SortAndFilter( w, ctrl.tridiagEigCtrl );
         return info;
     }
+    if( ctrl.useQDWH )
+    {
+        HermitianEigInfo info;
+        herm_eig::QDWHEig( uplo, A, w, ctrl.sdcCtrl );
+        herm_eig::SortAndFilter( w, ctrl.tridiagEigCtrl );
+        return info;
+    }
     return herm_eig::BlackBox( uplo, A, w, ctrl );
 }
 
@@ -528,6 +536,13 @@ HermitianEig
         herm_eig::SortAndFilter( w, ctrl.tridiagEigCtrl );
         return info;
     }
+    if( ctrl.useQDWH )
+    {
+        HermitianEigInfo info;
+        herm_eig::QDWHEig( uplo, APre, w, ctrl.sdcCtrl );
+        herm_eig::SortAndFilter( w, ctrl.tridiagEigCtrl );
+        return info;
+    }
 
     return herm_eig::BlackBox( uplo, APre, w, ctrl );
 }
@@ -680,6 +695,11 @@ HermitianEig
         herm_eig::SDC( uplo, A, w, Q, ctrl.sdcCtrl );
         herm_eig::SortAndFilter( w, Q, ctrl.tridiagEigCtrl );
     }
+    else if( ctrl.useQDWH )
+    {
+        herm_eig::QDWHEig( uplo, A, w, Q, ctrl.sdcCtrl );
+        herm_eig::SortAndFilter( w, Q, ctrl.tridiagEigCtrl );
+    }
     else
     {
         info = herm_eig::BlackBox( uplo, A, w, Q, ctrl );
@@ -1084,6 +1104,11 @@ HermitianEig
         herm_eig::SDC( uplo, A, w, Q, ctrl.sdcCtrl );
         herm_eig::SortAndFilter( w, Q, ctrl.tridiagEigCtrl );
     }
+    else if( ctrl.useQDWH )
+    {
+        herm_eig::QDWHEig( uplo, A, w, Q, ctrl.sdcCtrl );
+        herm_eig::SortAndFilter( w, Q, ctrl.tridiagEigCtrl );
+    }
     else if( ctrl.tridiagEigCtrl.alg == HERM_TRIDIAG_EIG_MRRR )
     {
         info = herm_eig::MRRR( uplo, A, w, Q, ctrl );
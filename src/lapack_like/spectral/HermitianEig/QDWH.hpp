@@ -0,0 +1,456 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANEIG_QDWH_HPP
+#define EL_HERMITIANEIG_QDWH_HPP
+
+#include "../Schur/SDC.hpp"
+
+// The QDWH-based spectral divide and conquer algorithm (QDWH-eig) from
+//
+//   Yuji Nakatsukasa and Nicholas J. Higham,
+//   "Stable and efficient spectral divide and conquer algorithms for the
+//    symmetric eigenvalue decomposition and the SVD",
+//   SIAM J. Sci. Comput., Vol. 35, No. 3, pp. A1325--A1349, 2013.
+//
+// Unlike the randomized SDC, each split is made about the median of the
+// diagonal of A (which lies within the convex hull of the spectrum), the
+// split point is read off from the trace of the spectral projector, and the
+// invariant subspace is extracted with a few steps of subspace iteration.
+// Every step is a level-3 operation.
+
+namespace El {
+namespace herm_eig {
+
+using El::schur::PushSubproblems;
+using El::schur::PullSubproblems;
+
+// Overwrite A with a unitary similarity transformation of itself whose
+// trailing-leading off-diagonal block is (relatively) small, and return its
+// relative size along with the split point. If the spectrum could not be
+// split, the returned index is either zero or the height of A.
+// If returnQ is true, Q is set to the accumulated unitary matrix.
+template<typename F>
+ValueInt<Base<F>>
+QDWHDivide
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& Q,
+  bool returnQ,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    MakeHermitian( uplo, A );
+    const Real frobA = FrobeniusNorm( A );
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = 500*n*limits::Epsilon<Real>();
+    const Real median = Median(GetRealPartOfDiagonal(A)).value;
+    const Real spread = ctrl.spreadFactor*InfinityNorm(A);
+
+    // P := 1/2 ( sgn(A - shift I) + I ), perturbing the shift if it failed
+    // to separate the spectrum
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    ValueInt<Real> part;
+    part.value = 0;
+    part.index = 0;
+    Matrix<F> P;
+    for( Int it=0; it<Max(ctrl.maxOuterIts,Int(1)); ++it )
+    {
+        const Real shift =
+          ( it == 0 ? median : SampleBall<Real>(median,spread) );
+        P = A;
+        ShiftDiagonal( P, F(-shift) );
+        HermitianPolar( uplo, P, polarCtrl );
+        ShiftDiagonal( P, F(1) );
+        P *= F(1)/F(2);
+        part.index = Int(Round(RealPart(Trace(P))));
+        if( part.index > 0 && part.index < n )
+            break;
+    }
+    if( part.index <= 0 || part.index >= n )
+        return part;
+    const Range<Int> ind1( 0, part.index ), ind2( part.index, n );
+
+    // Subspace iteration for the range of P
+    Matrix<F> ACopy( A ), X, Y, t;
+    Matrix<Real> d;
+    Gaussian( X, n, part.index );
+    for( Int it=0; it<Max(ctrl.maxInnerIts,Int(1)); ++it )
+    {
+        if( it != 0 )
+        {
+            A = ACopy;
+            Identity( X, n, part.index );
+            qr::ApplyQ( LEFT, NORMAL, Y, t, d, X );
+        }
+        Gemm( NORMAL, NORMAL, F(1), P, X, Y );
+        El::QR( Y, t, d );
+        qr::ApplyQ( LEFT, ADJOINT, Y, t, d, A );
+        qr::ApplyQ( RIGHT, NORMAL, Y, t, d, A );
+        part.value = FrobeniusNorm( A(ind2,ind1) ) / frobA;
+        if( part.value <= tol )
+            break;
+    }
+    if( part.value > tol )
+        RuntimeError
+        ( "Unable to split spectrum to specified accuracy: part.value=",
+          part.value, ", tol=", tol );
+
+    if( returnQ )
+    {
+        Identity( Q, n, n );
+        qr::ApplyQ( LEFT, NORMAL, Y, t, d, Q );
+    }
+    return part;
+}
+
+template<typename F>
+ValueInt<Base<F>>
+QDWHDivide
+( UpperOrLower uplo,
+  DistMatrix<F>& A,
+  DistMatrix<F>& Q,
+  bool returnQ,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    MakeHermitian( uplo, A );
+    const Real frobA = FrobeniusNorm( A );
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = 500*n*limits::Epsilon<Real>();
+    const Real median = Median(GetRealPartOfDiagonal(A)).value;
+    const Real spread = ctrl.spreadFactor*InfinityNorm(A);
+
+    // P := 1/2 ( sgn(A - shift I) + I ), perturbing the shift if it failed
+    // to separate the spectrum
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    ValueInt<Real> part;
+    part.value = 0;
+    part.index = 0;
+    DistMatrix<F> P(g);
+    for( Int it=0; it<Max(ctrl.maxOuterIts,Int(1)); ++it )
+    {
+        Real shift = median;
+        if( it != 0 )
+        {
+            shift = SampleBall<Real>(median,spread);
+            mpi::Broadcast( shift, 0, g.VCComm() );
+        }
+        P = A;
+        ShiftDiagonal( P, F(-shift) );
+        HermitianPolar( uplo, P, polarCtrl );
+        ShiftDiagonal( P, F(1) );
+        P *= F(1)/F(2);
+        part.index = Int(Round(RealPart(Trace(P))));
+        if( part.index > 0 && part.index < n )
+            break;
+    }
+    if( part.index <= 0 || part.index >= n )
+        return part;
+    const Range<Int> ind1( 0, part.index ), ind2( part.index, n );
+
+    // Subspace iteration for the range of P
+    DistMatrix<F> ACopy( A ), X(g), Y(g);
+    DistMatrix<F,MD,STAR> t(g);
+    DistMatrix<Real,MD,STAR> d(g);
+    Gaussian( X, n, part.index );
+    for( Int it=0; it<Max(ctrl.maxInnerIts,Int(1)); ++it )
+    {
+        if( it != 0 )
+        {
+            A = ACopy;
+            Identity( X, n, part.index );
+            qr::ApplyQ( LEFT, NORMAL, Y, t, d, X );
+        }
+        Gemm( NORMAL, NORMAL, F(1), P, X, Y );
+        El::QR( Y, t, d );
+        qr::ApplyQ( LEFT, ADJOINT, Y, t, d, A );
+        qr::ApplyQ( RIGHT, NORMAL, Y, t, d, A );
+        part.value = FrobeniusNorm( A(ind2,ind1) ) / frobA;
+        if( part.value <= tol )
+            break;
+    }
+    if( part.value > tol )
+        RuntimeError
+        ( "Unable to split spectrum to specified accuracy: part.value=",
+          part.value, ", tol=", tol );
+
+    if( returnQ )
+    {
+        Identity( Q, n, n );
+        qr::ApplyQ( LEFT, NORMAL, Y, t, d, Q );
+    }
+    return part;
+}
+
+template<typename F>
+void QDWHEig
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    w.Resize( n, 1 );
+    if( n <= ctrl.cutoff )
+    {
+        HermitianEig( uplo, A, w );
+        return;
+    }
+
+    // Perform this level's split
+    Matrix<F> Q;
+    const auto part = QDWHDivide( uplo, A, Q, false, ctrl );
+    if( part.index <= 0 || part.index >= n )
+    {
+        HermitianEig( uplo, A, w );
+        return;
+    }
+    auto ind1 = IR(0,part.index);
+    auto ind2 = IR(part.index,n);
+
+    auto ATL = A( ind1, ind1 );
+    auto ATR = A( ind1, ind2 );
+    auto ABL = A( ind2, ind1 );
+    auto ABR = A( ind2, ind2 );
+
+    auto wT = w( ind1, ALL );
+    auto wB = w( ind2, ALL );
+
+    if( uplo == LOWER )
+        Zero( ABL );
+    else
+        Zero( ATR );
+
+    // Recurse on the two subproblems
+    QDWHEig( uplo, ATL, wT, ctrl );
+    QDWHEig( uplo, ABR, wB, ctrl );
+}
+
+template<typename F>
+void QDWHEig
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& Q,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    w.Resize( n, 1 );
+    Q.Resize( n, n );
+    if( n <= ctrl.cutoff )
+    {
+        HermitianEig( uplo, A, w, Q );
+        return;
+    }
+
+    // Perform this level's split
+    const auto part = QDWHDivide( uplo, A, Q, true, ctrl );
+    if( part.index <= 0 || part.index >= n )
+    {
+        HermitianEig( uplo, A, w, Q );
+        return;
+    }
+    auto ind1 = IR(0,part.index);
+    auto ind2 = IR(part.index,n);
+
+    auto ATL = A( ind1, ind1 );
+    auto ATR = A( ind1, ind2 );
+    auto ABL = A( ind2, ind1 );
+    auto ABR = A( ind2, ind2 );
+
+    auto wT = w( ind1, ALL );
+    auto wB = w( ind2, ALL );
+
+    auto QL = Q( ALL, ind1 );
+    auto QR = Q( ALL, ind2 );
+
+    if( uplo == LOWER )
+        Zero( ABL );
+    else
+        Zero( ATR );
+
+    // Recurse on the top-left quadrant and update eigenvectors
+    Matrix<F> Z;
+    QDWHEig( uplo, ATL, wT, Z, ctrl );
+    auto G( QL );
+    Gemm( NORMAL, NORMAL, F(1), G, Z, QL );
+
+    // Recurse on the bottom-right quadrant and update eigenvectors
+    QDWHEig( uplo, ABR, wB, Z, ctrl );
+    G = QR;
+    Gemm( NORMAL, NORMAL, F(1), G, Z, QR );
+}
+
+template<typename F>
+void QDWHEig
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<Base<F>>& wPre,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = APre.Height();
+    wPre.Resize( n, 1 );
+    if( APre.Grid().Size() == 1 )
+    {
+        QDWHEig( uplo, APre.Matrix(), wPre.Matrix(), ctrl );
+        return;
+    }
+    // Subproblems live on subgrids of the original viewing communicator, so
+    // avoid the square-grid tridiagonalization, which would require the
+    // participation of every viewing process
+    HermitianEigCtrl<F> eigCtrl;
+    eigCtrl.tridiagCtrl.approach = HERMITIAN_TRIDIAG_DEFAULT;
+    if( n <= ctrl.cutoff )
+    {
+        HermitianEig( uplo, APre, wPre, eigCtrl );
+        return;
+    }
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Real,Real,VR,STAR> wProx( wPre );
+    auto& A = AProx.Get();
+    auto& w = wProx.Get();
+
+    // Perform this level's split
+    DistMatrix<F> Q(A.Grid());
+    const auto part = QDWHDivide( uplo, A, Q, false, ctrl );
+    if( part.index <= 0 || part.index >= n )
+    {
+        HermitianEig( uplo, A, w, eigCtrl );
+        return;
+    }
+    auto ind1 = IR(0,part.index);
+    auto ind2 = IR(part.index,n);
+
+    auto ATL = A( ind1, ind1 );
+    auto ATR = A( ind1, ind2 );
+    auto ABL = A( ind2, ind1 );
+    auto ABR = A( ind2, ind2 );
+
+    auto wT = w( ind1, ALL );
+    auto wB = w( ind2, ALL );
+
+    if( uplo == LOWER )
+        Zero( ABL );
+    else
+        Zero( ATR );
+
+    // Recurse on the two subproblems
+    DistMatrix<F> ATLSub, ABRSub;
+    DistMatrix<Real,VR,STAR> wTSub, wBSub;
+    PushSubproblems
+    ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, ctrl.progress );
+    if( ATLSub.Participating() )
+        QDWHEig( uplo, ATLSub, wTSub, ctrl );
+    if( ABRSub.Participating() )
+        QDWHEig( uplo, ABRSub, wBSub, ctrl );
+    PullSubproblems( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub );
+}
+
+template<typename F>
+void QDWHEig
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<Base<F>>& wPre,
+  AbstractDistMatrix<F>& QPre,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = APre.Grid();
+    const Int n = APre.Height();
+    wPre.Resize( n, 1 );
+    QPre.Resize( n, n );
+    if( g.Size() == 1 )
+    {
+        QDWHEig( uplo, APre.Matrix(), wPre.Matrix(), QPre.Matrix(), ctrl );
+        return;
+    }
+    // See the note in the eigenvalue-only routine
+    HermitianEigCtrl<F> eigCtrl;
+    eigCtrl.tridiagCtrl.approach = HERMITIAN_TRIDIAG_DEFAULT;
+    if( n <= ctrl.cutoff )
+    {
+        HermitianEig( uplo, APre, wPre, QPre, eigCtrl );
+        return;
+    }
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+    DistMatrixWriteProxy<Real,Real,VR,STAR> wProx( wPre );
+    auto& A = AProx.Get();
+    auto& Q = QProx.Get();
+    auto& w = wProx.Get();
+
+    // Perform this level's split
+    const auto part = QDWHDivide( uplo, A, Q, true, ctrl );
+    if( part.index <= 0 || part.index >= n )
+    {
+        HermitianEig( uplo, A, w, Q, eigCtrl );
+        return;
+    }
+    auto ind1 = IR(0,part.index);
+    auto ind2 = IR(part.index,n);
+
+    auto ATL = A( ind1, ind1 );
+    auto ATR = A( ind1, ind2 );
+    auto ABL = A( ind2, ind1 );
+    auto ABR = A( ind2, ind2 );
+
+    auto wT = w( ind1, ALL );
+    auto wB = w( ind2, ALL );
+
+    auto QL = Q( ALL, ind1 );
+    auto QR = Q( ALL, ind2 );
+
+    if( uplo == LOWER )
+        Zero( ABL );
+    else
+        Zero( ATR );
+
+    // Recurse on the two subproblems
+    DistMatrix<F> ATLSub, ABRSub, ZTSub, ZBSub;
+    DistMatrix<Real,VR,STAR> wTSub, wBSub;
+    PushSubproblems
+    ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, ZTSub, ZBSub,
+      ctrl.progress );
+    if( ATLSub.Participating() )
+        QDWHEig( uplo, ATLSub, wTSub, ZTSub, ctrl );
+    if( ABRSub.Participating() )
+        QDWHEig( uplo, ABRSub, wBSub, ZBSub, ctrl );
+
+    // Pull the results back to this grid
+    DistMatrix<F> ZT(g), ZB(g);
+    PullSubproblems
+    ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, ZT, ZB, ZTSub, ZBSub );
+
+    // Update the eigenvectors
+    auto G( QL );
+    Gemm( NORMAL, NORMAL, F(1), G, ZT, QL );
+    G = QR;
+    Gemm( NORMAL, NORMAL, F(1), G, ZB, QR );
+}
+
+} // namespace herm_eig
+} // namespace El
+
+#endif // ifndef EL_HERMITIANEIG_QDWH_HPP
@@ -12,6 +12,7 @@
 #include "./Simple.hpp"
 #include "./MultiBulge/Sweep.hpp"
 #include "./AED/UpdateDeflationSize.hpp"
+#include "./AED/AdaptDeflationSize.hpp"
 #include "./AED/ModifyShifts.hpp"
 #include "./AED/SpikeDeflation.hpp"
 #include "./AED/Nibble.hpp"
@@ -99,6 +100,7 @@ AED
       Max(30,2*numStaleIterBeforeExceptional) * Max(10,winSize);
 
     Int decreaseLevel = -1;
+    aed::DeflationRate deflationRate;
     Matrix<Field> hSubIter;
     while( winBeg < winEnd )
     {
@@ -127,15 +129,22 @@ AED
 
         auto HIter = H( IR(iterBeg,winEnd), IR(iterBeg,winEnd) );
         GetDiagonal( HIter, hSubIter, -1 );
+        const Int deflationSizeTarget =
+          ctrl.adaptiveAED ?
+          aed::AdaptDeflationSize
+          ( deflationRate, deflationSizeRec, numShiftsRec,
+            ctrl.sufficientDeflation(deflationSizeRec), n, winEnd-iterBeg ) :
+          deflationSizeRec;
         aed::UpdateDeflationSize
-        ( deflationSize, decreaseLevel, deflationSizeRec, numIterSinceDeflation,
-          numStaleIterBeforeExceptional, hSubIter );
+        ( deflationSize, decreaseLevel, deflationSizeTarget,
+          numIterSinceDeflation, numStaleIterBeforeExceptional, hSubIter );
 
         // Run AED on the bottom-right window of size deflationSize
         ctrlSub.winBeg = iterBeg;
         ctrlSub.winEnd = winEnd;
         auto deflateInfo = aed::Nibble( H, deflationSize, w, Z, ctrlSub );
         const Int numDeflated = deflateInfo.numDeflated;
+        aed::UpdateDeflationRate( deflationRate, numDeflated, deflationSize );
         winEnd -= numDeflated;
         Int shiftBeg = winEnd - deflateInfo.numShiftCandidates;
 
@@ -226,7 +235,16 @@ AED
       Max(30,2*numStaleIterBeforeExceptional) * Max(10,winSize);
 
     Int decreaseLevel = -1;
+    aed::DeflationRate deflationRate;
     DistMatrix<Field,STAR,STAR> hMainWin(grid), hSubWin(grid);
+
+    // When AED is overlapped with sweeps, the shifts computed by each AED
+    // are used for the sweep overlapped with the next AED. The packets of such
+    // a sweep are parked above the deflation window until the AED completes.
+    const Int maxShiftsPerSweep = 2*Max( n/6, 1 );
+    const Int minOverlapSize = 4*blockSize;
+    DistMatrix<Complex<Base<Field>>,STAR,STAR> pendingShifts(grid);
+    bool havePendingShifts = false;
     while( winBeg < winEnd )
     {
         if( info.numIterations >= maxIter )
@@ -264,20 +282,55 @@ AED
 
             winEnd = iterBeg;
             numIterSinceDeflation = 0;
+            havePendingShifts = false;
             continue;
         }
 
         auto hSubIter = hSubWin( IR(iterBeg-winBeg,winEnd-1), ALL );
+        const Int deflationSizeTarget =
+          ctrl.adaptiveAED ?
+          aed::AdaptDeflationSize
+          ( deflationRate, deflationSizeRec, numShiftsRec,
+            ctrl.sufficientDeflation(deflationSizeRec), n, winEnd-iterBeg ) :
+          deflationSizeRec;
         aed::UpdateDeflationSize
-        ( deflationSize, decreaseLevel, deflationSizeRec, numIterSinceDeflation,
-          numStaleIterBeforeExceptional, hSubIter.Matrix() );
+        ( deflationSize, decreaseLevel, deflationSizeTarget,
+          numIterSinceDeflation, numStaleIterBeforeExceptional,
+          hSubIter.Matrix() );
 
         // Run AED on the bottom-right window of size deflationSize
         ctrlSub.winBeg = iterBeg;
         ctrlSub.winEnd = winEnd;
-        auto deflateInfo = aed::Nibble( H, deflationSize, w, Z, ctrlSub );
+        const Int deflateBeg = winEnd - Min( deflationSize, winEnd-iterBeg );
+        bool sweptConcurrently = false;
+        AEDInfo deflateInfo;
+        if( havePendingShifts && deflateBeg-iterBeg >= minOverlapSize )
+        {
+            // Sweep the portion of the window above the deflation window with
+            // the shifts from the previous AED while deflating
+            multibulge::DistChaseState state;
+            auto overlap = [&]()
+              { state =
+                  multibulge::StartSweep
+                  ( H, pendingShifts, Z, deflateBeg, ctrlSub ); };
+            deflateInfo =
+              aed::Nibble
+              ( H, deflationSize, w, Z, ctrlSub, function<void()>(overlap) );
+            winEnd -= deflateInfo.numDeflated;
+            multibulge::FinishSweep
+            ( H, pendingShifts, Z, winEnd, state, ctrlSub );
+            sweptConcurrently = true;
+            if( ctrl.progress && grid.Rank() == 0 )
+                Output("  Overlapped AED with a QR sweep");
+        }
+        else
+        {
+            deflateInfo = aed::Nibble( H, deflationSize, w, Z, ctrlSub );
+            winEnd -= deflateInfo.numDeflated;
+        }
+        havePendingShifts = false;
         const Int numDeflated = deflateInfo.numDeflated;
-        winEnd -= numDeflated;
+        aed::UpdateDeflationRate( deflationRate, numDeflated, deflationSize );
         Int shiftBeg = winEnd - deflateInfo.numShiftCandidates;
 
         const Int newIterWinSize = winEnd-iterBeg;
@@ -298,7 +351,20 @@ AED
             auto wSub = w(IR(shiftBeg,winEnd),ALL);
             ctrlSub.winBeg = iterBeg;
             ctrlSub.winEnd = winEnd;
-            multibulge::Sweep( H, wSub, Z, ctrlSub );
+            if( ctrl.concurrentAED && wSub.Height() <= maxShiftsPerSweep )
+            {
+                // Defer the sweep so that it can be overlapped with the next
+                // AED; if this iteration's sweep was not already overlapped,
+                // also sweep now (the shifts will then be reused).
+                pendingShifts = wSub;
+                if( !IsComplex<Field>::value )
+                    multibulge::PairShifts( pendingShifts.Matrix() );
+                havePendingShifts = true;
+                if( !sweptConcurrently )
+                    multibulge::Sweep( H, wSub, Z, ctrlSub );
+            }
+            else
+                multibulge::Sweep( H, wSub, Z, ctrlSub );
         }
         else if( ctrl.progress && grid.Rank() == 0 )
             Output("  Skipping QR sweep");
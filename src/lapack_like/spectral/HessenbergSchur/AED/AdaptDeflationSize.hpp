@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESS_SCHUR_AED_ADAPT_DEFLATION_SIZE_HPP
+#define EL_HESS_SCHUR_AED_ADAPT_DEFLATION_SIZE_HPP
+
+namespace El {
+namespace hess_schur {
+namespace aed {
+
+// Adapt the deflation window size to the measured deflation rate
+// --------------------------------------------------------------
+// Rather than always recommending the fixed size returned by the
+// 'deflationSize' callback, we track a running average of the fraction of
+// each deflation window which was deflated, say rho, and aim for a window
+// which should leave (at least) the recommended number of shift candidates
+// behind, i.e., size numShifts/(1-rho). Further, when the deflation rate is
+// at least the 'sufficient' rate (so that a sweep will often be skipped), the
+// window is grown so that more eigenvalues are peeled off per (relatively
+// expensive) AED. The result is bounded by twice the recommendation and is
+// fed into UpdateDeflationSize, which handles stale iterations as before.
+//
+// Since the rate is computed purely from the deflation counts, every process
+// arrives at the same window size in the distributed case.
+
+struct DeflationRate
+{
+    double rate=0;
+    Int numSamples=0;
+};
+
+inline void UpdateDeflationRate
+( DeflationRate& deflationRate, Int numDeflated, Int deflationSize )
+{
+    if( deflationSize <= 0 )
+        return;
+    const double sample = double(numDeflated) / deflationSize;
+    if( deflationRate.numSamples == 0 )
+        deflationRate.rate = sample;
+    else
+        deflationRate.rate = (deflationRate.rate + sample) / 2;
+    ++deflationRate.numSamples;
+}
+
+inline Int AdaptDeflationSize
+( const DeflationRate& deflationRate,
+  Int deflationSizeRec,
+  Int numShiftsRec,
+  Int sufficientDeflationRec,
+  Int n,
+  Int iterWinSize )
+{
+    if( deflationRate.numSamples == 0 )
+        return deflationSizeRec;
+
+    const double rho = Min( deflationRate.rate, 0.75 );
+    Int deflationSize = Int(Ceil(numShiftsRec/(1-rho)));
+    const double sufficientRate =
+      double(sufficientDeflationRec) / Max(deflationSizeRec,Int(1));
+    if( rho >= sufficientRate )
+        deflationSize =
+          Max( deflationSize, Int(Round(deflationSizeRec*(1+rho))) );
+
+    const Int maxSize = Min( 2*deflationSizeRec, Min(iterWinSize,(n-1)/3) );
+    deflationSize = Min( deflationSize, maxSize );
+    deflationSize = Max( 2, deflationSize-Mod(deflationSize,2) );
+    return deflationSize;
+}
+
+} // namespace aed
+} // namespace hess_schur
+} // namespace El
+
+#endif // ifndef EL_HESS_SCHUR_AED_ADAPT_DEFLATION_SIZE_HPP
@@ -9,6 +9,8 @@
 #ifndef EL_HESS_SCHUR_AED_NIBBLE_HPP
 #define EL_HESS_SCHUR_AED_NIBBLE_HPP
 
+#include <future>
+
 #include "./SpikeDeflation.hpp"
 
 namespace El {
@@ -396,13 +398,19 @@ AEDInfo Nibble
     return info;
 }
 
+// If 'overlap' is nonempty, it is called by every process while the owner of
+// the deflation window concurrently processes it in a helper thread. The
+// overlapping work may be collective but must neither read nor modify the
+// deflation window, its spike, or the rows and columns of H and Z which the
+// deflation window's transformation is later applied to from the same side.
 template<typename Field>
 AEDInfo Nibble
 ( DistMatrix<Field,MC,MR,BLOCK>& H,
   Int deflationSize,
   DistMatrix<Complex<Base<Field>>,STAR,STAR>& w,
   DistMatrix<Field,MC,MR,BLOCK>& Z,
-  const HessenbergSchurCtrl& ctrl )
+  const HessenbergSchurCtrl& ctrl,
+  const function<void()>& overlap=function<void()>() )
 {
     EL_DEBUG_CSE
     const Int n = H.Height();
@@ -430,7 +438,36 @@ AEDInfo Nibble
       ( deflateBeg==winBeg ? Field(0) : H.Get(deflateBeg,deflateBeg-1) );
     Int VSize = 0;
     Matrix<Field> V;
-    if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+    const bool isOwner =
+      HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root();
+    if( overlap )
+    {
+        // The call stack maintained in debug mode is not thread-safe
+#ifdef EL_RELEASE
+        const auto policy = std::launch::async;
+#else
+        const auto policy = std::launch::deferred;
+#endif
+        std::future<AEDInfo> helper;
+        if( isOwner )
+        {
+            auto& HDeflLoc = HDefl_CIRC_CIRC.Matrix();
+            auto& wDeflLoc = wDefl.Matrix();
+            helper =
+              std::async
+              ( policy,
+                [&]() -> AEDInfo
+                { return NibbleHelper
+                         ( HDeflLoc, spikeValue, wDeflLoc, V, ctrl ); } );
+        }
+        overlap();
+        if( isOwner )
+        {
+            info = helper.get();
+            VSize = V.Height();
+        }
+    }
+    else if( isOwner )
     {
         info =
           NibbleHelper
@@ -159,22 +159,20 @@ void SweepHelper
     }
 }
 
+// Chase the packets of a distributed sweep until they have all left the
+// window or until the next step would operate on indices at or beyond
+// 'chaseEnd'
 template<typename Field>
-void SweepHelper
+void ChasePackets
 (       DistMatrix<Field,MC,MR,BLOCK>& H,
   const DistMatrix<Complex<Base<Field>>,STAR,STAR>& shifts,
         DistMatrix<Field,MC,MR,BLOCK>& Z,
+        Int chaseEnd,
+        DistChaseState& state,
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Check that H is upper Hessenberg
-    EL_DEBUG_ONLY(
-      if( H.Height() < 2*H.BlockHeight() )
-          LogicError("H spans less than two full blocks");
-    )
-    auto state = BuildDistChaseState( H, shifts, ctrl );
-
-    while( state.bulgeEnd != 0 )
+    while( state.bulgeEnd != 0 && state.activeEnd <= chaseEnd )
     {
         // Chase packets from the bottom-right corners of the even parity blocks
         // to the top-left corners of the odd parity blocks
@@ -192,6 +190,77 @@ void SweepHelper
     }
 }
 
+template<typename Field>
+void SweepHelper
+(       DistMatrix<Field,MC,MR,BLOCK>& H,
+  const DistMatrix<Complex<Base<Field>>,STAR,STAR>& shifts,
+        DistMatrix<Field,MC,MR,BLOCK>& Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    // TODO(poulson): Check that H is upper Hessenberg
+    EL_DEBUG_ONLY(
+      if( H.Height() < 2*H.BlockHeight() )
+          LogicError("H spans less than two full blocks");
+    )
+    auto state = BuildDistChaseState( H, shifts, ctrl );
+    ChasePackets( H, shifts, Z, state.winEnd, state, ctrl );
+}
+
+// A distributed sweep can be split into two phases so that the bottom-right
+// portion of the window, [parkEnd,winEnd), can be concurrently modified
+// (e.g., by aggressive early deflation) before the packets reach it:
+//
+//   auto state = StartSweep( H, shifts, Z, parkEnd, ctrl );
+//   ... (possibly deflate, which moves winEnd up to newWinEnd >= parkEnd) ...
+//   FinishSweep( H, shifts, Z, newWinEnd, state, ctrl );
+//
+// The shifts must already be paired (in the real case) and must fit within a
+// single sweep, and the shrunken window must span at least two blocks.
+
+template<typename Field>
+DistChaseState StartSweep
+(       DistMatrix<Field,MC,MR,BLOCK>& H,
+  const DistMatrix<Complex<Base<Field>>,STAR,STAR>& shifts,
+        DistMatrix<Field,MC,MR,BLOCK>& Z,
+        Int parkEnd,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( ctrl.wantSchurVecs && Z.DistData() != H.DistData() )
+          LogicError("The distributions of H and Z should match");
+      if( H.Height() < 2*H.BlockHeight() )
+          LogicError("H spans less than two full blocks");
+    )
+    const Int numShifts = shifts.Height();
+    if( numShifts < 2 || numShifts % 2 != 0 )
+        LogicError("Expected a positive, even number of shifts");
+    if( numShifts > 2*Max(H.Height()/6,1) )
+        LogicError("Too many shifts for a single sweep");
+
+    auto state = BuildDistChaseState( H, shifts, ctrl );
+    // Ensure that no packet enters the last two blocks of any window ending
+    // at or after parkEnd
+    const Int chaseEnd = parkEnd - 2*state.blockSize;
+    ChasePackets( H, shifts, Z, chaseEnd, state, ctrl );
+    return state;
+}
+
+template<typename Field>
+void FinishSweep
+(       DistMatrix<Field,MC,MR,BLOCK>& H,
+  const DistMatrix<Complex<Base<Field>>,STAR,STAR>& shifts,
+        DistMatrix<Field,MC,MR,BLOCK>& Z,
+        Int winEnd,
+        DistChaseState& state,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    ShrinkChaseWindow( H, winEnd, ctrl, state );
+    ChasePackets( H, shifts, Z, state.winEnd, state, ctrl );
+}
+
 template<typename Field>
 void Sweep
 (       Matrix<Field>& H,
@@ -255,6 +255,37 @@ void AdvanceChaseState
     }
 }
 
+// Update the chase state after the end of the window was moved up to
+// 'winEnd' (e.g., due to deflation in the bottom-right of the window). This is
+// only valid if every packet operated on so far lived strictly above the last
+// two blocks of the new window, as the last two blocks are treated specially.
+template<typename Field>
+void ShrinkChaseWindow
+( const DistMatrix<Field,MC,MR,BLOCK>& H,
+        Int winEnd,
+  const HessenbergSchurCtrl& ctrl,
+        DistChaseState& state )
+{
+    EL_DEBUG_CSE
+    const Int winSizeAfterFirst = winEnd - state.winBeg - state.firstBlockSize;
+    if( winEnd - state.winBeg < 2*state.blockSize )
+        LogicError("The window size must be at least twice the block size");
+    if( winEnd > state.winEnd )
+        LogicError("The window can only be shrunk");
+
+    state.winEnd = winEnd;
+    state.numWinBlocks = 2 + (winSizeAfterFirst-1)/state.blockSize;
+    const Int winSizeLeftover = Mod(winSizeAfterFirst,state.blockSize);
+    state.lastBlockSize =
+      ( winSizeLeftover==0 ? state.blockSize : winSizeLeftover );
+    if( !ctrl.fullTriangle )
+        state.localTransformColEnd = H.LocalColOffset(state.winEnd);
+    EL_DEBUG_ONLY(
+      if( state.activeEnd > state.winEnd-state.lastBlockSize )
+          LogicError("Packets were already chased too far to shrink window");
+    )
+}
+
 } // namespace multibulge
 } // namespace hess_schur
 } // namespace El
@@ -19,11 +19,156 @@ namespace El {
 //
 // No support for row-sorting yet.
 //
+// The Cholesky-based iterations form I + c A^H A with a single Herk and fuse
+// the first triangular solve into the factorization, and the QR-based
+// iterations switch to TSQR when the stacked iterate is tall enough, so that
+// every step is a short sequence of level-3 operations.
+//
 // The careful calculation of the coefficients is due to a suggestion from
 // Gregorio Quintana Orti.
 
 namespace polar {
 
+// Overwrite the lower triangle of the HPD matrix C with its Cholesky factor,
+// L, and X with X L^{-H}. Each diagonal block and subdiagonal panel of L is
+// used for the corresponding step of the triangular solve as soon as it has
+// been computed, which keeps X in cache for the sequential version and, for
+// the distributed version, reuses the panel redistributions that the
+// factorization performs anyway so that C never leaves [MC,MR].
+//
+// Each Cholesky-based QDWH step forms the lower triangle of C := I + c A^H A
+// with a Herk followed by a diagonal shift (so that no explicit identity is
+// formed), overwrites a copy of A with A L^{-H} using this routine, and then
+// finishes A C^{-1} = A L^{-H} L^{-1} with a single Trsm. The distributed
+// version requires X and C to share their row alignment, and the callers
+// align both with A so that neither is redistributed within the iteration.
+template<typename F>
+void CholeskyTrsm( Matrix<F>& C, Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( C.Height() != C.Width() )
+          LogicError("C must be square");
+      if( X.Width() != C.Height() )
+          LogicError("X and C must conform");
+    )
+    const Int n = C.Height();
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto C11 = C( ind1, ind1 );
+        auto C21 = C( ind2, ind1 );
+        auto C22 = C( ind2, ind2 );
+        auto X1 = X( ALL, ind1 );
+        auto X2 = X( ALL, ind2 );
+
+        Cholesky( LOWER, C11 );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C11, C21 );
+        Herk( LOWER, NORMAL, Base<F>(-1), C21, Base<F>(1), C22 );
+
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C11, X1 );
+        Gemm( NORMAL, ADJOINT, F(-1), X1, C21, F(1), X2 );
+    }
+}
+
+template<typename F>
+void CholeskyTrsm( DistMatrix<F>& C, DistMatrix<F>& X )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( C, X );
+      if( C.Height() != C.Width() )
+          LogicError("C must be square");
+      if( X.Width() != C.Height() )
+          LogicError("X and C must conform");
+      if( X.RowAlign() != C.RowAlign() )
+          LogicError("X and C must have the same row alignment");
+    )
+    const Grid& g = C.Grid();
+    DistMatrix<F,STAR,STAR> C11_STAR_STAR(g);
+    DistMatrix<F,VC,  STAR> C21_VC_STAR(g), X1_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> C21_VR_STAR(g);
+    DistMatrix<F,STAR,MC  > C21Trans_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > C21Adj_STAR_MR(g);
+    DistMatrix<F,MC,  STAR> X1_MC_STAR(g);
+
+    const Int n = C.Height();
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto C11 = C( ind1, ind1 );
+        auto C21 = C( ind2, ind1 );
+        auto C22 = C( ind2, ind2 );
+        auto X1 = X( ALL, ind1 );
+        auto X2 = X( ALL, ind2 );
+
+        C11_STAR_STAR = C11;
+        Cholesky( LOWER, C11_STAR_STAR );
+        C11 = C11_STAR_STAR;
+
+        C21_VC_STAR.AlignWith( C22 );
+        C21_VC_STAR = C21;
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C11_STAR_STAR, C21_VC_STAR );
+
+        C21_VR_STAR.AlignWith( C22 );
+        C21_VR_STAR = C21_VC_STAR;
+        C21Trans_STAR_MC.AlignWith( C22 );
+        C21Adj_STAR_MR.AlignWith( C22 );
+        Transpose( C21_VC_STAR, C21Trans_STAR_MC );
+        Adjoint( C21_VR_STAR, C21Adj_STAR_MR );
+
+        // X1 := X1 L11^{-H}
+        X1_VC_STAR.AlignWith( X2 );
+        X1_VC_STAR = X1;
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C11_STAR_STAR, X1_VC_STAR );
+        X1_MC_STAR.AlignWith( X2 );
+        X1_MC_STAR = X1_VC_STAR;
+        X1 = X1_MC_STAR;
+
+        // X2 := X2 - X1[MC,* ] (L21^H)[* ,MR]
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1), X1_MC_STAR, C21Adj_STAR_MR, F(1), X2 );
+
+        // C22 := C22 - L21[MC,* ] (L21^H)[* ,MR]
+        LocalTrrk
+        ( LOWER, TRANSPOSE,
+          F(-1), C21Trans_STAR_MC, C21Adj_STAR_MR, F(1), C22 );
+
+        Transpose( C21Trans_STAR_MC, C21 );
+    }
+}
+
+// Overwrite the stacked QDWH iterate with the explicit unitary factor from
+// its thin QR decomposition, using TSQR when it is sufficiently tall
+template<typename F>
+void StackedExplicitUnitary( DistMatrix<F>& Q, const QRCtrl<Base<F>>& qrCtrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = Q.Grid();
+    const Int p = g.Size();
+    if( !qrCtrl.colPiv && PowerOfTwo(p) && Q.Height() >= p*Q.Width() )
+    {
+        DistMatrix<F,VC,STAR> QTS( Q );
+        DistMatrix<F,STAR,STAR> R( g );
+        qr::ExplicitTS( QTS, R );
+        Q = QTS;
+    }
+    else
+        qr::ExplicitUnitary( Q, true, qrCtrl );
+}
+
 template<typename F>
 QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
 {
@@ -44,7 +189,9 @@ QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
     const Real eps = limits::Epsilon<Real>();
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
-    Real L = sMinUpper / Sqrt(Real(n));
+    // A (numerically) singular A yields a lower bound of zero, for which the
+    // iteration coefficients are undefined, so use eps as a floor
+    Real L = Max( sMinUpper / Sqrt(Real(n)), eps );
 
     Real frobNormADiff;
     Matrix<F> ALast, ATemp, C;
@@ -95,11 +242,10 @@ QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
             //
             // Use faster Cholesky-based algorithm since A is well-conditioned
             //
-            Identity( C, n, n );
-            Herk( LOWER, ADJOINT, c, A, Real(1), C );
-            Cholesky( LOWER, C );
+            Herk( LOWER, ADJOINT, c, A, C );
+            ShiftDiagonal( C, F(1) );
             ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
+            CholeskyTrsm( C, ATemp );
             Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
             A *= beta;
             Axpy( alpha, ATemp, A );
@@ -188,10 +334,12 @@ QDWHInner
     const Real eps = limits::Epsilon<Real>();
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
-    Real L = sMinUpper / Sqrt(Real(n));
+    Real L = Max( sMinUpper / Sqrt(Real(n)), eps );
 
     const Grid& g = A.Grid();
     DistMatrix<F> ALast(g), ATemp(g), C(g);
+    ATemp.AlignWith( A );
+    C.AlignWith( A );
     DistMatrix<F> Q( m+n, n, g );
     auto QT = Q( IR(0,m  ), ALL );
     auto QB = Q( IR(m,END), ALL );
@@ -232,7 +380,7 @@ QDWHInner
             QT = A;
             QT *= Sqrt(c);
             MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, true, qrCtrl );
+            StackedExplicitUnitary( Q, qrCtrl );
             Gemm( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
             ++info.numQRIts;
         }
@@ -241,11 +389,10 @@ QDWHInner
             //
             // Use faster Cholesky-based algorithm since A is well-conditioned
             //
-            Identity( C, n, n );
-            Herk( LOWER, ADJOINT, c, A, Real(1), C );
-            Cholesky( LOWER, C );
+            Herk( LOWER, ADJOINT, c, A, C );
+            ShiftDiagonal( C, F(1) );
             ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
+            CholeskyTrsm( C, ATemp );
             Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
             A *= beta;
             Axpy( alpha, ATemp, A );
@@ -327,6 +474,9 @@ QDWH
 
 namespace herm_polar {
 
+using polar::CholeskyTrsm;
+using polar::StackedExplicitUnitary;
+
 template<typename F>
 QDWHInfo
 QDWHInner
@@ -352,7 +502,7 @@ QDWHInner
     const Real eps = limits::Epsilon<Real>();
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
-    Real L = sMinUpper / Sqrt(Real(n));
+    Real L = Max( sMinUpper / Sqrt(Real(n)), eps );
 
     Real frobNormADiff;
     Matrix<F> ALast, ATemp, C;
@@ -409,11 +559,10 @@ QDWHInner
             // e.g., by halving the work in the first Herk through
             // a custom routine for forming L^2, where L is strictly lower
             MakeHermitian( uplo, A );
-            Identity( C, n, n );
-            Herk( LOWER, ADJOINT, c, A, Real(1), C );
-            Cholesky( LOWER, C );
+            Herk( LOWER, ADJOINT, c, A, C );
+            ShiftDiagonal( C, F(1) );
             ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
+            CholeskyTrsm( C, ATemp );
             Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
             A *= beta;
             Axpy( alpha, ATemp, A );
@@ -504,10 +653,12 @@ QDWHInner
     const Real eps = limits::Epsilon<Real>();
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
-    Real L = sMinUpper / Sqrt(Real(n));
+    Real L = Max( sMinUpper / Sqrt(Real(n)), eps );
 
     Real frobNormADiff;
     DistMatrix<F> ALast(g), ATemp(g), C(g);
+    ATemp.AlignWith( A );
+    C.AlignWith( A );
     DistMatrix<F> Q( 2*n, n, g );
     auto QT = Q( IR(0,n  ), ALL );
     auto QB = Q( IR(n,END), ALL );
@@ -548,7 +699,7 @@ QDWHInner
             QT = A;
             QT *= Sqrt(c);
             MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, true, qrCtrl );
+            StackedExplicitUnitary( Q, qrCtrl );
             Trrk( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
             ++info.numQRIts;
         }
@@ -561,11 +712,10 @@ QDWHInner
             // e.g., by halving the work in the first Herk through
             // a custom routine for forming L^2, where L is strictly lower
             MakeHermitian( uplo, A );
-            Identity( C, n, n );
-            Herk( LOWER, ADJOINT, c, A, Real(1), C );
-            Cholesky( LOWER, C );
+            Herk( LOWER, ADJOINT, c, A, C );
+            ShiftDiagonal( C, F(1) );
             ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
+            CholeskyTrsm( C, ATemp );
             Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
             A *= beta;
             Axpy( alpha, ATemp, A );
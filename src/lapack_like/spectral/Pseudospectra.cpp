@@ -19,6 +19,8 @@
 // Higham and Tisseur will hopefully be implemented soon.
 #include "./Pseudospectra/HagerHigham.hpp"
 
+#include "./Pseudospectra/Schedule.hpp"
+
 namespace El {
 
 template<typename Field>
@@ -58,19 +60,25 @@ Matrix<Int> TriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_TWO_NORM )
     {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( U, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( U, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( U, shifts, invNorms, psCtrl );
+        auto solve =
+          [&]( const Matrix<C>& groupShifts,
+                     Matrix<Real>& groupInvNorms,
+               const PseudospecCtrl<Real>& groupCtrl )
+          { return pspec::TwoNormCloud
+                   ( U, groupShifts, groupInvNorms, groupCtrl ); };
+        return pspec::ScheduleShifts( shifts, invNorms, psCtrl, solve );
     }
     else
-        return pspec::HagerHigham( U, shifts, invNorms, psCtrl );
+    {
         // Q is assumed to be the identity
+        auto solve =
+          [&]( const Matrix<C>& groupShifts,
+                     Matrix<Real>& groupInvNorms,
+               const PseudospecCtrl<Real>& groupCtrl )
+          { return pspec::HagerHigham
+                   ( U, groupShifts, groupInvNorms, groupCtrl ); };
+        return pspec::ScheduleShifts( shifts, invNorms, psCtrl, solve );
+    }
 }
 
 template<typename Field>
@@ -111,22 +119,26 @@ Matrix<Int> TriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_TWO_NORM )
     {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( U, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( U, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( U, shifts, invNorms, psCtrl );
+        auto solve =
+          [&]( const Matrix<C>& groupShifts,
+                     Matrix<Real>& groupInvNorms,
+               const PseudospecCtrl<Real>& groupCtrl )
+          { return pspec::TwoNormCloud
+                   ( U, groupShifts, groupInvNorms, groupCtrl ); };
+        return pspec::ScheduleShifts( shifts, invNorms, psCtrl, solve );
     }
     else
     {
         // Force Q to be complex as cheaply as possible
         MatrixReadProxy<Field,C> QProx( QPre );
         auto& Q = QProx.GetLocked();
-        return pspec::HagerHigham( U, Q, shifts, invNorms, psCtrl );
+        auto solve =
+          [&]( const Matrix<C>& groupShifts,
+                     Matrix<Real>& groupInvNorms,
+               const PseudospecCtrl<Real>& groupCtrl )
+          { return pspec::HagerHigham
+                   ( U, Q, groupShifts, groupInvNorms, groupCtrl ); };
+        return pspec::ScheduleShifts( shifts, invNorms, psCtrl, solve );
     }
 }
 
@@ -161,7 +173,12 @@ Matrix<Int> QuasiTriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
-    return pspec::IRA( U, shifts, invNorms, psCtrl );
+    auto solve =
+      [&]( const Matrix<Complex<Real>>& groupShifts,
+                 Matrix<Real>& groupInvNorms,
+           const PseudospecCtrl<Real>& groupCtrl )
+      { return pspec::IRA( U, groupShifts, groupInvNorms, groupCtrl ); };
+    return pspec::ScheduleShifts( shifts, invNorms, psCtrl, solve );
 }
 
 template<typename Real>
@@ -196,7 +213,12 @@ Matrix<Int> QuasiTriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
-    return pspec::IRA( U, shifts, invNorms, psCtrl );
+    auto solve =
+      [&]( const Matrix<Complex<Real>>& groupShifts,
+                 Matrix<Real>& groupInvNorms,
+           const PseudospecCtrl<Real>& groupCtrl )
+      { return pspec::IRA( U, groupShifts, groupInvNorms, groupCtrl ); };
+    return pspec::ScheduleShifts( shifts, invNorms, psCtrl, solve );
 }
 
 template<typename Field>
@@ -219,19 +241,25 @@ Matrix<Int> HessenbergSpectralCloud
     psCtrl.schur = false;
     if( psCtrl.norm == PS_TWO_NORM )
     {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( H, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( H, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( H, shifts, invNorms, psCtrl );
+        auto solve =
+          [&]( const Matrix<C>& groupShifts,
+                     Matrix<Real>& groupInvNorms,
+               const PseudospecCtrl<Real>& groupCtrl )
+          { return pspec::TwoNormCloud
+                   ( H, groupShifts, groupInvNorms, groupCtrl ); };
+        return pspec::ScheduleShifts( shifts, invNorms, psCtrl, solve );
     }
     else
-        return pspec::HagerHigham( H, shifts, invNorms, psCtrl );
+    {
         // Q is assumed to be the identity
+        auto solve =
+          [&]( const Matrix<C>& groupShifts,
+                     Matrix<Real>& groupInvNorms,
+               const PseudospecCtrl<Real>& groupCtrl )
+          { return pspec::HagerHigham
+                   ( H, groupShifts, groupInvNorms, groupCtrl ); };
+        return pspec::ScheduleShifts( shifts, invNorms, psCtrl, solve );
+    }
 }
 
 template<typename Field>
@@ -255,22 +283,26 @@ Matrix<Int> HessenbergSpectralCloud
     psCtrl.schur = false;
     if( psCtrl.norm == PS_TWO_NORM )
     {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( H, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( H, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( H, shifts, invNorms, psCtrl );
+        auto solve =
+          [&]( const Matrix<C>& groupShifts,
+                     Matrix<Real>& groupInvNorms,
+               const PseudospecCtrl<Real>& groupCtrl )
+          { return pspec::TwoNormCloud
+                   ( H, groupShifts, groupInvNorms, groupCtrl ); };
+        return pspec::ScheduleShifts( shifts, invNorms, psCtrl, solve );
     }
     else
     {
         // Force Q to be complex as cheaply as possible
         MatrixReadProxy<Field,C> QProx( QPre );
         auto& Q = QProx.GetLocked();
-        return pspec::HagerHigham( H, Q, shifts, invNorms, psCtrl );
+        auto solve =
+          [&]( const Matrix<C>& groupShifts,
+                     Matrix<Real>& groupInvNorms,
+               const PseudospecCtrl<Real>& groupCtrl )
+          { return pspec::HagerHigham
+                   ( H, Q, groupShifts, groupInvNorms, groupCtrl ); };
+        return pspec::ScheduleShifts( shifts, invNorms, psCtrl, solve );
     }
 }
 
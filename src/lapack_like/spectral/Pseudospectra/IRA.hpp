@@ -257,7 +257,7 @@ Matrix<Int> IRA
     vector<Matrix<C>> VList(basisSize+1), activeVList(basisSize+1);
     for( Int j=0; j<basisSize+1; ++j )
         Zeros( VList[j], n, numShifts );
-    Gaussian( VList[0], n, numShifts );
+    GaussianStart( VList[0], n, numShifts );
     vector<Matrix<Complex<Real>>> HList(numShifts);
     Matrix<Complex<Real>> components;
     Matrix<Real> colNorms;
@@ -483,8 +483,8 @@ IRA
         Zeros( VImagList[j], n, numShifts );
     }
     // The variance will be off from that of the usual complex case
-    Gaussian( VRealList[0], n, numShifts );
-    Gaussian( VImagList[0], n, numShifts );
+    GaussianStart( VRealList[0], n, numShifts );
+    GaussianStart( VImagList[0], n, numShifts );
     vector<Matrix<Complex<Real>>> HList(numShifts);
     Matrix<Complex<Real>> components;
     Matrix<Real> colNorms;
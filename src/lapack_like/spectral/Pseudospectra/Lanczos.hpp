@@ -261,7 +261,7 @@ Lanczos
     // Simultaneously run Lanczos for various shifts
     Matrix<C> XOld, X, XNew;
     Zeros( XOld, n, numShifts );
-    Gaussian( X, n, numShifts );
+    GaussianStart( X, n, numShifts );
     FixColumns( X );
     Zeros( XNew, n, numShifts );
     vector<Matrix<Real>> HDiagList( numShifts ),
@@ -245,7 +245,7 @@ Power
     // Simultaneously run inverse iteration for various shifts
     Timer timer;
     Matrix<C> X;
-    Gaussian( X, n, numShifts );
+    GaussianStart( X, n, numShifts );
     FixColumns( X );
     Int numIts=0, numDone=0;
     Matrix<Real> estimates(numShifts,1);
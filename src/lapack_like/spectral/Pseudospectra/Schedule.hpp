@@ -0,0 +1,154 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_SCHEDULE_HPP
+#define EL_PSEUDOSPECTRA_SCHEDULE_HPP
+
+#include "./Util.hpp"
+#include "./Power.hpp"
+#include "./Lanczos.hpp"
+#include "./IRA.hpp"
+
+namespace El {
+namespace pspec {
+
+// Run the requested two-norm iteration for the given shifts of the (complex)
+// triangular or Hessenberg matrix U
+template<typename Real>
+Matrix<Int> TwoNormCloud
+( const Matrix<Complex<Real>>& U,
+  const Matrix<Complex<Real>>& shifts,
+        Matrix<Real>& invNorms,
+  const PseudospecCtrl<Real>& psCtrl )
+{
+    EL_DEBUG_CSE
+    if( psCtrl.arnoldi )
+    {
+        if( psCtrl.basisSize > 1 )
+            return IRA( U, shifts, invNorms, psCtrl );
+        else
+            return Lanczos( U, shifts, invNorms, psCtrl );
+    }
+    else
+        return Power( U, shifts, invNorms, psCtrl );
+}
+
+// Split the shifts into groups of (at most) psCtrl.shiftGroupSize consecutive
+// shifts and call solve( groupShifts, groupInvNorms, groupCtrl ) on each group
+// independently. The groups are handed out one at a time to the loop threads,
+// so that a thread whose group converged (and deflated) quickly moves on to the
+// next group rather than idling while the slowest shifts finish. The BLAS
+// calls within each group are single-threaded.
+//
+// Since the groups complete out of order, snapshots are taken after every
+// group rather than every iteration, and the pixels of the groups which have
+// not yet completed are displayed as one.
+template<typename Real,typename Solver>
+Matrix<Int> ScheduleShifts
+( const Matrix<Complex<Real>>& shifts,
+        Matrix<Real>& invNorms,
+        PseudospecCtrl<Real>& psCtrl,
+        Solver solve )
+{
+    EL_DEBUG_CSE
+    const Int numShifts = shifts.Height();
+    const Int groupSize = psCtrl.shiftGroupSize;
+    if( groupSize <= 0 || groupSize >= numShifts )
+        return solve( shifts, invNorms, psCtrl );
+    const Int numGroups = (numShifts+groupSize-1) / groupSize;
+
+    PseudospecCtrl<Real> groupCtrl( psCtrl );
+    groupCtrl.progress = false;
+    groupCtrl.snapCtrl.realSize = groupCtrl.snapCtrl.imagSize = 0;
+
+    Matrix<Int> itCounts, preimage;
+    Zeros( itCounts, numShifts, 1 );
+    Ones( invNorms, numShifts, 1 );
+    psCtrl.snapCtrl.ResetCounts();
+
+    ThreadingCtrl threadingCtrl;
+    threadingCtrl.numBlasThreads = 1;
+    PushThreadingCtrl( threadingCtrl );
+
+    Timer timer;
+    if( psCtrl.progress )
+        timer.Start();
+    Int numGroupsDone = 0;
+    // Exceptions cannot propagate out of an OpenMP region, so the first one
+    // is captured (and the remaining groups skipped) and rethrown afterwards
+    std::exception_ptr exception;
+    bool failed = false;
+#ifdef EL_HYBRID
+    #pragma omp parallel for schedule(dynamic,1) num_threads(NumLoopThreads())
+#endif
+    for( Int group=0; group<numGroups; ++group )
+    {
+        bool skip;
+#ifdef EL_HYBRID
+        #pragma omp atomic read
+#endif
+        skip = failed;
+        if( skip )
+            continue;
+
+        try
+        {
+            const Int groupOff = group*groupSize;
+            const Int thisSize = Min( groupSize, numShifts-groupOff );
+            const Range<Int> groupInd( groupOff, groupOff+thisSize );
+
+            Matrix<Real> groupInvNorms;
+            auto groupItCounts =
+              solve( shifts(groupInd,ALL), groupInvNorms, groupCtrl );
+
+#ifdef EL_HYBRID
+            #pragma omp critical(El_pspec_ScheduleShifts)
+#endif
+            {
+                auto invNormsGroup = invNorms( groupInd, ALL );
+                auto itCountsGroup = itCounts( groupInd, ALL );
+                invNormsGroup = groupInvNorms;
+                itCountsGroup = groupItCounts;
+
+                ++numGroupsDone;
+                if( psCtrl.progress )
+                    Output
+                    (numGroupsDone," of ",numGroups,
+                     " groups of shifts done after ",timer.Partial(),
+                     " seconds");
+                psCtrl.snapCtrl.Iterate();
+                Snapshot
+                ( preimage, invNorms, itCounts, numGroupsDone, false,
+                  psCtrl.snapCtrl );
+            }
+        }
+        catch( ... )
+        {
+#ifdef EL_HYBRID
+            #pragma omp critical(El_pspec_ScheduleShifts_exception)
+#endif
+            if( !exception )
+                exception = std::current_exception();
+#ifdef EL_HYBRID
+            #pragma omp atomic write
+#endif
+            failed = true;
+        }
+    }
+    PopThreadingCtrl();
+    if( exception )
+        std::rethrow_exception( exception );
+
+    FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+    return itCounts;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_SCHEDULE_HPP
@@ -58,6 +58,18 @@ bool QuasiTriangIsNormal( const AbstractDistMatrix<Field>& U, Base<Field> tol )
 template<typename Field>
 Base<Field> NormCap() { return Base<Field>(1)/limits::Epsilon<Base<Field>>(); }
 
+// The sequential solvers may be run concurrently on separate groups of shifts
+// (see ScheduleShifts), so their random starting vectors are drawn from the
+// shared generator one thread at a time
+template<typename Field>
+void GaussianStart( Matrix<Field>& X, Int n, Int numShifts )
+{
+#ifdef EL_HYBRID
+    #pragma omp critical(El_pspec_GaussianStart)
+#endif
+    Gaussian( X, n, numShifts );
+}
+
 template<typename Field>
 bool HasNan( const Matrix<Field>& H )
 {
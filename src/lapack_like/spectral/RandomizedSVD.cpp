@@ -0,0 +1,242 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace rsvd {
+
+// Y := A X, where A is accessed in column panels if panelWidth is positive
+template<typename Field,class MatType>
+void Apply( const MatType& A, const MatType& X, MatType& Y, Int panelWidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    if( panelWidth <= 0 || panelWidth >= n )
+    {
+        Gemm( NORMAL, NORMAL, Field(1), A, X, Y );
+        return;
+    }
+    Zeros( Y, A.Height(), X.Width() );
+    for( Int j=0; j<n; j+=panelWidth )
+    {
+        const Range<Int> J( j, Min(j+panelWidth,n) );
+        Gemm( NORMAL, NORMAL, Field(1), A(ALL,J), X(J,ALL), Field(1), Y );
+    }
+}
+
+// Z := A^H Y, where A is accessed in column panels if panelWidth is positive
+template<typename Field,class MatType>
+void ApplyAdjoint
+( const MatType& A, const MatType& Y, MatType& Z, Int panelWidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    if( panelWidth <= 0 || panelWidth >= n )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), A, Y, Z );
+        return;
+    }
+    Zeros( Z, n, Y.Width() );
+    for( Int j=0; j<n; j+=panelWidth )
+    {
+        const Range<Int> J( j, Min(j+panelWidth,n) );
+        auto Z1 = Z( J, ALL );
+        Gemm( ADJOINT, NORMAL, Field(1), A(ALL,J), Y, Field(0), Z1 );
+    }
+}
+
+template<typename Field>
+void Orthonormalize( Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    qr::ExplicitUnitary( Y );
+}
+
+template<typename Field>
+void Orthonormalize( DistMatrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = Y.Grid();
+    const Int p = grid.Size();
+    if( PowerOfTwo(p) && Y.Height() >= p*Y.Width() )
+    {
+        DistMatrix<Field,VC,STAR> YTS( Y );
+        DistMatrix<Field,STAR,STAR> R( grid );
+        qr::ExplicitTS( YTS, R );
+        Y = YTS;
+    }
+    else
+        qr::ExplicitUnitary( Y );
+}
+
+// Form Q from Gaussian samples of the range of A, using Z as workspace
+template<typename Field,class MatType>
+void RangeFinder
+( const MatType& A,
+        Int numVecs,
+        MatType& Q,
+        MatType& Z,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( numVecs < 0 || numVecs > Min(A.Height(),A.Width()) )
+        LogicError
+        ("Cannot sample ",numVecs," vectors from the range of a ",
+         A.Height()," x ",A.Width()," matrix");
+    Gaussian( Z, A.Width(), numVecs );
+    Apply<Field>( A, Z, Q, ctrl.panelWidth );
+    Orthonormalize( Q );
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        ApplyAdjoint<Field>( A, Q, Z, ctrl.panelWidth );
+        Orthonormalize( Z );
+        Apply<Field>( A, Z, Q, ctrl.panelWidth );
+        Orthonormalize( Q );
+    }
+}
+
+Int NumSamples( Int m, Int n, Int rank, const RandomizedSVDCtrl& ctrl )
+{
+    const Int minDim = Min(m,n);
+    if( rank < 0 || rank > minDim )
+        LogicError
+        ("Invalid rank of ",rank," for a ",m," x ",n," matrix");
+    return Min( rank+Max(ctrl.oversample,Int(0)), minDim );
+}
+
+} // namespace rsvd
+
+template<typename Field>
+void RangeFinder
+( const Matrix<Field>& A,
+        Int numVecs,
+        Matrix<Field>& Q,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> Z;
+    rsvd::RangeFinder<Field>( A, numVecs, Q, Z, ctrl );
+}
+
+template<typename Field>
+void RangeFinder
+( const AbstractDistMatrix<Field>& APre,
+        Int numVecs,
+        AbstractDistMatrix<Field>& QPre,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> QProx( QPre );
+    auto& A = AProx.GetLocked();
+    auto& Q = QProx.Get();
+    DistMatrix<Field> Z( A.Grid() );
+    rsvd::RangeFinder<Field>( A, numVecs, Q, Z, ctrl );
+}
+
+template<typename Field>
+SVDInfo RandomizedSVD
+( const Matrix<Field>& A,
+        Int rank,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numVecs =
+      rsvd::NumSamples( A.Height(), A.Width(), rank, ctrl );
+    Matrix<Field> Q, W;
+    rsvd::RangeFinder<Field>( A, numVecs, Q, W, ctrl );
+
+    // With B = Q^H A, form B^H = A^H Q = W = WHat S X^H, so that
+    // A ~= Q B = (Q X) S WHat^H
+    rsvd::ApplyAdjoint<Field>( A, Q, W, ctrl.panelWidth );
+    Matrix<Field> WHat, X;
+    Matrix<Base<Field>> sHat;
+    auto info = SVD( W, WHat, sHat, X );
+
+    Gemm( NORMAL, NORMAL, Field(1), Q, X(ALL,IR(0,rank)), U );
+    V = WHat( ALL, IR(0,rank) );
+    s = sHat( IR(0,rank), ALL );
+    return info;
+}
+
+template<typename Field>
+SVDInfo RandomizedSVD
+( const AbstractDistMatrix<Field>& APre,
+        Int rank,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const RandomizedSVDCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& grid = A.Grid();
+    const Int n = A.Width();
+    const Int numVecs = rsvd::NumSamples( A.Height(), n, rank, ctrl );
+    DistMatrix<Field> Q(grid), W(grid);
+    rsvd::RangeFinder<Field>( A, numVecs, Q, W, ctrl );
+
+    // With B = Q^H A, form B^H = A^H Q = W = WHat S X^H, so that
+    // A ~= Q B = (Q X) S WHat^H
+    rsvd::ApplyAdjoint<Field>( A, Q, W, ctrl.panelWidth );
+    DistMatrix<Field,VC,STAR> WHat(grid);
+    DistMatrix<Base<Field>,STAR,STAR> sHat(grid);
+    DistMatrix<Field,STAR,STAR> X(grid);
+    SVDInfo info;
+    const Int p = grid.Size();
+    if( PowerOfTwo(p) && n >= p*numVecs )
+        info = svd::TSQR( W, WHat, sHat, X );
+    else
+        info = SVD( W, WHat, sHat, X );
+
+    Gemm( NORMAL, NORMAL, Field(1), Q, X(ALL,IR(0,rank)), U );
+    Copy( WHat(ALL,IR(0,rank)), V );
+    Copy( sHat(IR(0,rank),ALL), s );
+    return info;
+}
+
+#define PROTO(Field) \
+  template void RangeFinder \
+  ( const Matrix<Field>& A, \
+          Int numVecs, \
+          Matrix<Field>& Q, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void RangeFinder \
+  ( const AbstractDistMatrix<Field>& A, \
+          Int numVecs, \
+          AbstractDistMatrix<Field>& Q, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template SVDInfo RandomizedSVD \
+  ( const Matrix<Field>& A, \
+          Int rank, \
+          Matrix<Field>& U, \
+          Matrix<Base<Field>>& s, \
+          Matrix<Field>& V, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template SVDInfo RandomizedSVD \
+  ( const AbstractDistMatrix<Field>& A, \
+          Int rank, \
+          AbstractDistMatrix<Field>& U, \
+          AbstractDistMatrix<Base<Field>>& s, \
+          AbstractDistMatrix<Field>& V, \
+    const RandomizedSVDCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
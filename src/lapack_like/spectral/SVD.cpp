@@ -10,6 +10,7 @@
 
 #include "./SVD/Chan.hpp"
 #include "./SVD/Product.hpp"
+#include "./SVD/QDWH.hpp"
 
 namespace El {
 
@@ -249,7 +250,11 @@ SVDInfo SVD
 
     SVDInfo info;
     auto approach = ctrl.bidiagSVDCtrl.approach;
-    if( approach == PRODUCT_SVD )
+    if( approach == THIN_SVD && ctrl.useQDWH )
+    {
+        info = svd::QDWH( A, U, s, V, ctrl );
+    }
+    else if( approach == PRODUCT_SVD )
     {
         auto tolType = ctrl.bidiagSVDCtrl.tolType;
         if( tolType == RELATIVE_TO_SELF_SING_VAL_TOL )
@@ -319,7 +324,11 @@ SVDInfo SVD
     }
 
     SVDInfo info;
-    if( approach == PRODUCT_SVD )
+    if( approach == THIN_SVD && ctrl.useQDWH )
+    {
+        info = svd::QDWH( A, U, s, V, ctrl );
+    }
+    else if( approach == PRODUCT_SVD )
     {
         auto tolType = ctrl.bidiagSVDCtrl.tolType;
         if( tolType == RELATIVE_TO_SELF_SING_VAL_TOL )
@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_QDWH_HPP
+#define EL_SVD_QDWH_HPP
+
+namespace El {
+namespace svd {
+
+// QDWH-SVD: compute the polar decomposition A = U_p H with QDWH, then the
+// eigenvalue decomposition H = V diag(s) V^H with QDWH-eig, so that
+// A = (U_p V) diag(s) V^H. Since H is only numerically semi-definite, the
+// sign of any negative eigenvalue is folded into the corresponding column
+// of U, after which the (numerically zero) trailing singular values may need
+// to be re-sorted.
+
+template<typename Field>
+SVDInfo QDWH
+( Matrix<Field>& A,
+  Matrix<Field>& U,
+  Matrix<Base<Field>>& s,
+  Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( A.Height() < A.Width() )
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        return QDWH( AAdj, V, s, U, ctrl );
+    }
+    const Int n = A.Width();
+
+    Matrix<Field> UPolar( A );
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    Polar( UPolar, polarCtrl );
+
+    Matrix<Field> H;
+    Gemm( ADJOINT, NORMAL, Field(1), UPolar, A, H );
+    HermitianEigCtrl<Field> eigCtrl;
+    eigCtrl.useQDWH = true;
+    eigCtrl.sdcCtrl = ctrl.qdwhEigCtrl;
+    eigCtrl.tridiagEigCtrl.sort = DESCENDING;
+    HermitianEig( LOWER, H, s, V, eigCtrl );
+
+    Gemm( NORMAL, NORMAL, Field(1), UPolar, V, U );
+    for( Int j=0; j<n; ++j )
+    {
+        if( s(j) < Real(0) )
+        {
+            s(j) = -s(j);
+            auto u = U( ALL, IR(j) );
+            u *= Field(-1);
+        }
+    }
+    auto sortPairs = TaggedSort( s, DESCENDING );
+    for( Int j=0; j<n; ++j )
+        s(j) = sortPairs[j].value;
+    ApplyTaggedSortToEachRow( sortPairs, U );
+    ApplyTaggedSortToEachRow( sortPairs, V );
+    return SVDInfo();
+}
+
+template<typename Field>
+SVDInfo QDWH
+( AbstractDistMatrix<Field>& APre,
+  AbstractDistMatrix<Field>& UPre,
+  AbstractDistMatrix<Base<Field>>& sPre,
+  AbstractDistMatrix<Field>& VPre,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( APre.Height() < APre.Width() )
+    {
+        DistMatrix<Field> AAdj( APre.Grid() );
+        Adjoint( APre, AAdj );
+        return QDWH( AAdj, VPre, sPre, UPre, ctrl );
+    }
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> UProx( UPre );
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> sProx( sPre );
+    auto& A = AProx.GetLocked();
+    auto& U = UProx.Get();
+    auto& s = sProx.Get();
+    const Grid& g = A.Grid();
+
+    DistMatrix<Field> UPolar( A );
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    Polar( UPolar, polarCtrl );
+
+    DistMatrix<Field> H(g);
+    Gemm( ADJOINT, NORMAL, Field(1), UPolar, A, H );
+    HermitianEigCtrl<Field> eigCtrl;
+    eigCtrl.useQDWH = true;
+    eigCtrl.sdcCtrl = ctrl.qdwhEigCtrl;
+    eigCtrl.tridiagEigCtrl.sort = DESCENDING;
+    HermitianEig( LOWER, H, s, VPre, eigCtrl );
+
+    DistMatrixReadProxy<Field,Field,MC,MR> VProx( VPre );
+    auto& V = VProx.GetLocked();
+    Gemm( NORMAL, NORMAL, Field(1), UPolar, V, U );
+    const Int localWidth = U.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = U.GlobalCol(jLoc);
+        if( s.GetLocal(j,0) < Real(0) )
+        {
+            auto u = U.Matrix()( ALL, IR(jLoc) );
+            u *= Field(-1);
+        }
+    }
+    auto& sLoc = s.Matrix();
+    for( Int j=0; j<sLoc.Height(); ++j )
+        sLoc(j) = Abs(sLoc(j));
+    auto sortPairs = TaggedSort( s, DESCENDING );
+    for( Int j=0; j<sLoc.Height(); ++j )
+        sLoc(j) = sortPairs[j].value;
+    ApplyTaggedSortToEachRow( sortPairs, U );
+    ApplyTaggedSortToEachRow( sortPairs, VPre );
+    return SVDInfo();
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_QDWH_HPP
@@ -12,7 +12,7 @@
 
 #ifdef EL_HAVE_PARMETIS
 # include "parmetis.h"
-#else
+#elif defined(EL_HAVE_METIS)
 # include "metis.h"
 #endif
 
@@ -26,6 +26,8 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.engine == MULTILEVEL_BISECT )
+        return MultilevelBisect( graph, leftChild, rightChild, perm, ctrl );
 #ifdef EL_HAVE_METIS
     // METIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
@@ -104,6 +106,8 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.engine == MULTILEVEL_BISECT )
+        return MultilevelBisect( graph, childGrid, child, perm, onLeft, ctrl );
 #ifdef EL_HAVE_METIS
     const Grid& grid = graph.Grid();
     const int commSize = grid.Size();
@@ -0,0 +1,1272 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <numeric>
+#include <queue>
+#include <random>
+
+// A multilevel vertex-separator engine in the spirit of METIS and PT-Scotch:
+// the graph is coarsened by contracting heavy-edge matchings, a separator of
+// the coarsest graph is found by graph growing, and it is then projected back
+// through the levels, with Fiduccia-Mattheyses (FM) refinement on each.
+//
+// In the distributed case, the matchings and the contractions are computed in
+// parallel until the graph is small enough to be replicated, each process then
+// computes its own initial separators of the replicated graph (the best of
+// which is kept), and the uncoarsening refines each level in parallel with
+// each process only moving the vertices it owns. In order for the concurrent
+// moves to preserve the separator, each refinement pass only moves vertices
+// towards a single side and never moves a vertex whose neighbors on the other
+// side are owned by another process.
+
+namespace El {
+
+namespace {
+
+const Int LEFT_PART = 0;
+const Int RIGHT_PART = 1;
+const Int SEP_PART = 2;
+
+using multilevel::WeightedGraph;
+
+// The local portion of a distributed weighted graph with the non-local
+// neighbors (the 'ghosts') relabeled as [numLocal,numLocal+numGhosts) and the
+// communication pattern for updating data associated with the ghosts
+struct LocalView
+{
+    Int numLocal=0;
+    vector<Int> offsets, targets;
+    vector<Int> ghosts;
+
+    vector<int> sendCounts, sendOffs, recvCounts, recvOffs;
+    vector<Int> sendInds;
+};
+
+// Exchange variable-length buffers and return the number of entries received
+// from each process
+vector<Int> ExchangeInts
+( const vector<Int>& sendBuf,
+  const vector<int>& sendCounts,
+  const vector<int>& sendOffs,
+        vector<int>& recvCounts,
+        vector<int>& recvOffs,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    recvCounts.resize( commSize );
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    vector<Int> recvBuf( Max(totalRecv,1) );
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+    recvBuf.resize( totalRecv );
+    return recvBuf;
+}
+
+int Owner( const vector<Int>& vtxDist, Int i )
+{
+    return int(std::upper_bound(vtxDist.begin(),vtxDist.end(),i) -
+               vtxDist.begin()) - 1;
+}
+
+Int PartWeight
+( const WeightedGraph& graph, const vector<Int>& labels, Int part )
+{
+    Int weight = 0;
+    for( Int v=0; v<graph.numLocal; ++v )
+        if( labels[v] == part )
+            weight += graph.vertexWeights[v];
+    return weight;
+}
+
+// Form the local view of the (sorted) ghosts of a distributed graph along
+// with the send lists for their updates
+void FormLocalView
+( const WeightedGraph& graph,
+  const vector<Int>& vtxDist,
+        LocalView& view,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const Int numLocal = graph.numLocal;
+    const Int firstLocal = graph.firstLocal;
+    const Int numEdges = graph.targets.size();
+    view.numLocal = numLocal;
+    view.offsets = graph.offsets;
+
+    view.ghosts.clear();
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int target = graph.targets[e];
+        if( target < firstLocal || target >= firstLocal+numLocal )
+            view.ghosts.push_back( target );
+    }
+    std::sort( view.ghosts.begin(), view.ghosts.end() );
+    view.ghosts.erase
+    ( std::unique(view.ghosts.begin(),view.ghosts.end()), view.ghosts.end() );
+
+    view.targets.resize( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int target = graph.targets[e];
+        if( target >= firstLocal && target < firstLocal+numLocal )
+            view.targets[e] = target - firstLocal;
+        else
+            view.targets[e] = numLocal +
+              Int(std::lower_bound
+                  (view.ghosts.begin(),view.ghosts.end(),target) -
+                  view.ghosts.begin());
+    }
+
+    // Since the ghosts are sorted, they are grouped by their owners
+    view.recvCounts.assign( commSize, 0 );
+    for( const Int ghost : view.ghosts )
+        ++view.recvCounts[Owner(vtxDist,ghost)];
+    Scan( view.recvCounts, view.recvOffs );
+
+    // Tell the owners which of their vertices we need
+    view.sendInds = ExchangeInts
+    ( view.ghosts, view.recvCounts, view.recvOffs,
+      view.sendCounts, view.sendOffs, comm );
+    for( auto& ind : view.sendInds )
+        ind -= firstLocal;
+}
+
+// Fill the ghost portion of 'data' (of length numLocal+numGhosts)
+void UpdateGhosts
+( const LocalView& view, vector<Int>& data, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int numSends = view.sendInds.size();
+    vector<Int> sendBuf( Max(numSends,Int(1)) );
+    for( Int k=0; k<numSends; ++k )
+        sendBuf[k] = data[view.sendInds[k]];
+    const Int numGhosts = view.ghosts.size();
+    data.resize( view.numLocal+numGhosts );
+    vector<Int> recvBuf( Max(numGhosts,Int(1)) );
+    mpi::AllToAll
+    ( sendBuf.data(), view.sendCounts.data(), view.sendOffs.data(),
+      recvBuf.data(), view.recvCounts.data(), view.recvOffs.data(), comm );
+    for( Int k=0; k<numGhosts; ++k )
+        data[view.numLocal+k] = recvBuf[k];
+}
+
+// Coarsen a sequential graph by contracting a heavy-edge matching
+void Coarsen
+( const WeightedGraph& graph,
+        WeightedGraph& coarse,
+        vector<Int>& coarseMap,
+        std::mt19937& gen )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.numVertices;
+    vector<Int> order( n );
+    std::iota( order.begin(), order.end(), Int(0) );
+    std::shuffle( order.begin(), order.end(), gen );
+
+    vector<Int> match( n, -1 );
+    for( const Int v : order )
+    {
+        if( match[v] >= 0 )
+            continue;
+        Int best = -1, bestWeight = 0;
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            const Int u = graph.targets[e];
+            if( match[u] < 0 && graph.edgeWeights[e] > bestWeight )
+            {
+                best = u;
+                bestWeight = graph.edgeWeights[e];
+            }
+        }
+        if( best >= 0 )
+        {
+            match[v] = best;
+            match[best] = v;
+        }
+        else
+            match[v] = v;
+    }
+
+    Int numCoarse = 0;
+    coarseMap.assign( n, -1 );
+    for( Int v=0; v<n; ++v )
+        if( coarseMap[v] < 0 )
+            coarseMap[v] = coarseMap[match[v]] = numCoarse++;
+    multilevel::Contract( graph, coarseMap, numCoarse, coarse );
+}
+
+// An FM pass which only moves separator vertices to side 'part' (pulling
+// their neighbors from the other side into the separator). Neighbors with
+// indices of at least 'numLocal' are owned by other processes and may not be
+// moved. The (global) weights of the parts are updated with the local changes
+// and the reduction in the separator weight is returned.
+Int FMPass
+( const vector<Int>& offsets,
+  const vector<Int>& targets,
+  const vector<Int>& vertexWeights,
+        Int numLocal,
+        vector<Int>& labels,
+        Int part,
+        Int maxIncrease,
+        Int* weights )
+{
+    EL_DEBUG_CSE
+    const Int other = 1 - part;
+    const Int maxNonImproving = Max( Int(50), numLocal/100 );
+
+    // The reduction in the separator weight from moving vertex v to 'part',
+    // or -1 if a neighbor on the other side may not be moved
+    auto gain = [&]( Int v, bool& feasible )
+      {
+          feasible = true;
+          Int g = vertexWeights[v];
+          for( Int e=offsets[v]; e<offsets[v+1]; ++e )
+          {
+              const Int u = targets[e];
+              if( labels[u] == other )
+              {
+                  if( u >= numLocal )
+                  {
+                      feasible = false;
+                      return Int(0);
+                  }
+                  g -= vertexWeights[u];
+              }
+          }
+          return g;
+      };
+
+    std::priority_queue<std::pair<Int,Int>> heap;
+    bool feasible;
+    for( Int v=0; v<numLocal; ++v )
+    {
+        if( labels[v] != SEP_PART )
+            continue;
+        const Int g = gain( v, feasible );
+        if( feasible )
+            heap.push( std::make_pair(g,v) );
+    }
+
+    vector<std::pair<Int,Int>> changes;
+    Int sepChange=0, increase=0, decrease=0;
+    Int bestSepChange=0, bestNumChanges=0, bestIncrease=0, bestDecrease=0;
+    Int bestImbalance = Abs(weights[part]-weights[other]);
+    Int numNonImproving = 0;
+    while( !heap.empty() && numNonImproving < maxNonImproving )
+    {
+        const Int oldGain = heap.top().first;
+        const Int v = heap.top().second;
+        heap.pop();
+        if( labels[v] != SEP_PART )
+            continue;
+        const Int g = gain( v, feasible );
+        if( !feasible || g != oldGain )
+            continue;
+        if( increase+vertexWeights[v] > maxIncrease )
+            continue;
+
+        changes.push_back( std::make_pair(v,SEP_PART) );
+        labels[v] = part;
+        increase += vertexWeights[v];
+        sepChange -= vertexWeights[v];
+        for( Int e=offsets[v]; e<offsets[v+1]; ++e )
+        {
+            const Int u = targets[e];
+            if( labels[u] != other )
+                continue;
+            changes.push_back( std::make_pair(u,other) );
+            labels[u] = SEP_PART;
+            decrease += vertexWeights[u];
+            sepChange += vertexWeights[u];
+        }
+
+        // Update the gains of the separator vertices which were affected
+        for( Int e=offsets[v]; e<offsets[v+1]; ++e )
+        {
+            const Int u = targets[e];
+            if( u >= numLocal || labels[u] != SEP_PART )
+                continue;
+            const Int gu = gain( u, feasible );
+            if( feasible )
+                heap.push( std::make_pair(gu,u) );
+            for( Int f=offsets[u]; f<offsets[u+1]; ++f )
+            {
+                const Int w = targets[f];
+                if( w >= numLocal || labels[w] != SEP_PART )
+                    continue;
+                const Int gw = gain( w, feasible );
+                if( feasible )
+                    heap.push( std::make_pair(gw,w) );
+            }
+        }
+
+        const Int imbalance =
+          Abs((weights[part]+increase)-(weights[other]-decrease));
+        if( sepChange < bestSepChange ||
+            (sepChange == bestSepChange && imbalance < bestImbalance) )
+        {
+            bestSepChange = sepChange;
+            bestImbalance = imbalance;
+            bestNumChanges = changes.size();
+            bestIncrease = increase;
+            bestDecrease = decrease;
+            numNonImproving = 0;
+        }
+        else
+            ++numNonImproving;
+    }
+
+    // Roll back to the best prefix of the moves
+    for( Int k=changes.size()-1; k>=bestNumChanges; --k )
+        labels[changes[k].first] = changes[k].second;
+    weights[part] += bestIncrease;
+    weights[other] -= bestDecrease;
+    weights[SEP_PART] += bestSepChange;
+    return -bestSepChange;
+}
+
+Int MaxPartWeight( Int totalWeight, const BisectCtrl& ctrl )
+{ return Int(Ceil(ctrl.imbalance*totalWeight/2.)); }
+
+void Refine
+( const WeightedGraph& graph,
+        vector<Int>& labels,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Int weights[3];
+    for( Int part=0; part<3; ++part )
+        weights[part] = PartWeight( graph, labels, part );
+    const Int maxPartWeight =
+      MaxPartWeight( weights[0]+weights[1]+weights[2], ctrl );
+    for( Int sweep=0; sweep<ctrl.numRefineSweeps; ++sweep )
+    {
+        // Start by moving towards the lighter side
+        const Int first = ( weights[LEFT_PART] <= weights[RIGHT_PART] ?
+                            LEFT_PART : RIGHT_PART );
+        Int reduction = 0;
+        for( Int k=0; k<2; ++k )
+        {
+            const Int part = ( k == 0 ? first : 1-first );
+            reduction += FMPass
+            ( graph.offsets, graph.targets, graph.vertexWeights,
+              graph.numVertices, labels, part,
+              Max(maxPartWeight-weights[part],Int(0)), weights );
+        }
+        if( reduction == 0 )
+            break;
+    }
+}
+
+// Grow one side from a pseudo-peripheral vertex until it contains half of the
+// weight and then convert the edge separator into a vertex separator
+void GrowSeparator
+( const WeightedGraph& graph,
+        vector<Int>& labels,
+        std::mt19937& gen )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.numVertices;
+    labels.assign( n, RIGHT_PART );
+    if( n == 0 )
+        return;
+    Int totalWeight = 0;
+    for( Int v=0; v<n; ++v )
+        totalWeight += graph.vertexWeights[v];
+
+    // Find a pseudo-peripheral vertex with a few breadth-first searches
+    vector<Int> level( n );
+    auto bfs = [&]( Int root )
+      {
+          std::fill( level.begin(), level.end(), -1 );
+          std::queue<Int> queue;
+          queue.push( root );
+          level[root] = 0;
+          Int last = root;
+          while( !queue.empty() )
+          {
+              const Int v = queue.front();
+              queue.pop();
+              last = v;
+              for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+              {
+                  const Int u = graph.targets[e];
+                  if( level[u] < 0 )
+                  {
+                      level[u] = level[v] + 1;
+                      queue.push( u );
+                  }
+              }
+          }
+          return last;
+      };
+    std::uniform_int_distribution<Int> dist( 0, n-1 );
+    Int root = dist( gen );
+    for( Int k=0; k<2; ++k )
+        root = bfs( root );
+
+    // Grow the left side (restarting in unreached components if necessary)
+    vector<bool> visited( n, false );
+    std::queue<Int> queue;
+    queue.push( root );
+    visited[root] = true;
+    Int leftWeight = 0;
+    Int nextSeed = 0;
+    while( 2*leftWeight < totalWeight )
+    {
+        if( queue.empty() )
+        {
+            while( visited[nextSeed] )
+                ++nextSeed;
+            queue.push( nextSeed );
+            visited[nextSeed] = true;
+        }
+        const Int v = queue.front();
+        queue.pop();
+        labels[v] = LEFT_PART;
+        leftWeight += graph.vertexWeights[v];
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            const Int u = graph.targets[e];
+            if( !visited[u] )
+            {
+                visited[u] = true;
+                queue.push( u );
+            }
+        }
+    }
+
+    // Use the lighter of the two boundaries as the separator
+    Int boundaryWeights[2] = { 0, 0 };
+    vector<bool> boundary( n, false );
+    for( Int v=0; v<n; ++v )
+    {
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            if( labels[graph.targets[e]] != labels[v] )
+            {
+                boundary[v] = true;
+                boundaryWeights[labels[v]] += graph.vertexWeights[v];
+                break;
+            }
+        }
+    }
+    const Int sepSide =
+      ( boundaryWeights[LEFT_PART] <= boundaryWeights[RIGHT_PART] ?
+        LEFT_PART : RIGHT_PART );
+    for( Int v=0; v<n; ++v )
+        if( boundary[v] && labels[v] == sepSide )
+            labels[v] = SEP_PART;
+}
+
+// Compare two separators by their weight and then by their balance
+struct SeparatorCost
+{
+    Int sepWeight;
+    Int imbalance;
+
+    bool operator<( const SeparatorCost& other ) const
+    {
+        return sepWeight < other.sepWeight ||
+          (sepWeight == other.sepWeight && imbalance < other.imbalance);
+    }
+};
+
+SeparatorCost Cost( const WeightedGraph& graph, const vector<Int>& labels )
+{
+    SeparatorCost cost;
+    cost.sepWeight = PartWeight( graph, labels, SEP_PART );
+    cost.imbalance = Abs( PartWeight(graph,labels,LEFT_PART) -
+                          PartWeight(graph,labels,RIGHT_PART) );
+    return cost;
+}
+
+// Compute a vertex separator of a sequential graph with a multilevel scheme
+SeparatorCost MultilevelSeparator
+( const WeightedGraph& graph,
+        vector<Int>& labels,
+  const BisectCtrl& ctrl,
+        std::mt19937& gen )
+{
+    EL_DEBUG_CSE
+    vector<WeightedGraph> coarseGraphs;
+    vector<vector<Int>> coarseMaps;
+    const WeightedGraph* current = &graph;
+    while( current->numVertices > ctrl.coarsestSize )
+    {
+        WeightedGraph coarse;
+        vector<Int> coarseMap;
+        Coarsen( *current, coarse, coarseMap, gen );
+        if( 20*coarse.numVertices > 19*current->numVertices )
+            break;
+        coarseGraphs.emplace_back( std::move(coarse) );
+        coarseMaps.emplace_back( std::move(coarseMap) );
+        current = &coarseGraphs.back();
+    }
+
+    // Keep the best of several initial separators of the coarsest graph
+    SeparatorCost bestCost;
+    vector<Int> trialLabels;
+    for( Int trial=0; trial<Max(ctrl.numSeqSeps,Int(1)); ++trial )
+    {
+        GrowSeparator( *current, trialLabels, gen );
+        Refine( *current, trialLabels, ctrl );
+        const SeparatorCost cost = Cost( *current, trialLabels );
+        if( trial == 0 || cost < bestCost )
+        {
+            bestCost = cost;
+            labels = trialLabels;
+        }
+    }
+
+    // Project the separator back to the original graph
+    const Int numLevels = coarseGraphs.size();
+    for( Int level=numLevels-1; level>=0; --level )
+    {
+        const WeightedGraph& fine =
+          ( level == 0 ? graph : coarseGraphs[level-1] );
+        const vector<Int>& coarseMap = coarseMaps[level];
+        vector<Int> fineLabels( fine.numVertices );
+        for( Int v=0; v<fine.numVertices; ++v )
+            fineLabels[v] = labels[coarseMap[v]];
+        labels.swap( fineLabels );
+        Refine( fine, labels, ctrl );
+    }
+    return Cost( graph, labels );
+}
+
+// Coarsen a distributed graph by contracting a heavy-edge matching which may
+// pair vertices owned by different processes
+void Coarsen
+( const WeightedGraph& graph,
+  const vector<Int>& vtxDist,
+        WeightedGraph& coarse,
+        vector<Int>& coarseVtxDist,
+        vector<Int>& coarseMap,
+        std::mt19937& gen,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int numLocal = graph.numLocal;
+    const Int firstLocal = graph.firstLocal;
+    LocalView view;
+    FormLocalView( graph, vtxDist, view, comm );
+
+    // The partner of each local vertex (as a global index), with -1 denoting
+    // an unmatched vertex and -2 a vertex with a pending remote request
+    const Int UNMATCHED = -1;
+    const Int PENDING = -2;
+    vector<Int> match( numLocal, UNMATCHED ), request( numLocal, -1 );
+    vector<Int> order( numLocal );
+    std::iota( order.begin(), order.end(), Int(0) );
+    std::shuffle( order.begin(), order.end(), gen );
+    auto matchLocally = [&]( Int v, bool allowRemote )
+      {
+          Int best = -1, bestWeight = 0;
+          for( Int e=view.offsets[v]; e<view.offsets[v+1]; ++e )
+          {
+              const Int u = view.targets[e];
+              const bool available =
+                ( u >= numLocal ? allowRemote : match[u] == UNMATCHED );
+              if( available && graph.edgeWeights[e] > bestWeight )
+              {
+                  best = u;
+                  bestWeight = graph.edgeWeights[e];
+              }
+          }
+          if( best < 0 )
+          {
+              match[v] = firstLocal + v;
+          }
+          else if( best < numLocal )
+          {
+              match[v] = firstLocal + best;
+              match[best] = firstLocal + v;
+          }
+          else
+          {
+              // In order to avoid conflicting requests, only request partners
+              // with larger indices (and otherwise wait to be requested)
+              const Int partner = view.ghosts[best-numLocal];
+              if( firstLocal+v < partner )
+              {
+                  match[v] = PENDING;
+                  request[v] = partner;
+              }
+          }
+      };
+    for( const Int v : order )
+        if( match[v] == UNMATCHED )
+            matchLocally( v, true );
+
+    // Send the requests for remote partners, as (requester,target) pairs
+    vector<int> sendCounts( commSize, 0 ), sendOffs;
+    for( Int v=0; v<numLocal; ++v )
+        if( match[v] == PENDING )
+            sendCounts[Owner(vtxDist,request[v])] += 2;
+    Scan( sendCounts, sendOffs );
+    vector<Int> sendBuf( Max(sendOffs.back()+sendCounts.back(),1) );
+    {
+        auto offs = sendOffs;
+        for( Int v=0; v<numLocal; ++v )
+        {
+            if( match[v] != PENDING )
+                continue;
+            const int q = Owner(vtxDist,request[v]);
+            sendBuf[offs[q]++] = firstLocal + v;
+            sendBuf[offs[q]++] = request[v];
+        }
+    }
+    vector<int> recvCounts, recvOffs;
+    auto recvBuf =
+      ExchangeInts( sendBuf, sendCounts, sendOffs, recvCounts, recvOffs, comm );
+
+    // Grant at most one request per (unmatched) vertex
+    const Int numRequests = recvBuf.size() / 2;
+    vector<Int> granted( numLocal, -1 );
+    for( Int k=0; k<numRequests; ++k )
+    {
+        const Int requester = recvBuf[2*k];
+        const Int v = recvBuf[2*k+1] - firstLocal;
+        if( match[v] == UNMATCHED && granted[v] < 0 )
+            granted[v] = requester;
+    }
+    vector<Int> replies( Max(numRequests,Int(1)) );
+    for( Int k=0; k<numRequests; ++k )
+    {
+        const Int requester = recvBuf[2*k];
+        const Int v = recvBuf[2*k+1] - firstLocal;
+        replies[k] = ( granted[v] == requester ? 1 : 0 );
+    }
+    for( Int v=0; v<numLocal; ++v )
+        if( granted[v] >= 0 )
+            match[v] = granted[v];
+
+    // Return the replies to the requesters
+    vector<int> halfRecvCounts( commSize ), halfRecvOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        halfRecvCounts[q] = recvCounts[q] / 2;
+        halfRecvOffs[q] = recvOffs[q] / 2;
+    }
+    vector<int> replyCounts, replyOffs;
+    auto replyBuf = ExchangeInts
+    ( replies, halfRecvCounts, halfRecvOffs, replyCounts, replyOffs, comm );
+    {
+        vector<int> offs( commSize );
+        for( int q=0; q<commSize; ++q )
+            offs[q] = sendOffs[q] / 2;
+        for( Int v=0; v<numLocal; ++v )
+        {
+            if( match[v] != PENDING )
+                continue;
+            const int q = Owner(vtxDist,request[v]);
+            if( replyBuf[offs[q]++] )
+                match[v] = request[v];
+            else
+                match[v] = UNMATCHED;
+        }
+    }
+    // Fall back to local partners for the rejected and unrequested vertices
+    for( const Int v : order )
+        if( match[v] == UNMATCHED )
+            matchLocally( v, false );
+
+    // Each coarse vertex is owned by the owner of its smallest member
+    Int numLocalCoarse = 0;
+    for( Int v=0; v<numLocal; ++v )
+        if( match[v] >= firstLocal + v )
+            ++numLocalCoarse;
+    vector<Int> coarseSizes( commSize );
+    mpi::AllGather( &numLocalCoarse, 1, coarseSizes.data(), 1, comm );
+    coarseVtxDist.resize( commSize+1 );
+    coarseVtxDist[0] = 0;
+    for( int q=0; q<commSize; ++q )
+        coarseVtxDist[q+1] = coarseVtxDist[q] + coarseSizes[q];
+    const Int firstLocalCoarse = coarseVtxDist[commRank];
+
+    coarseMap.assign( numLocal, -1 );
+    Int coarseCounter = firstLocalCoarse;
+    for( Int v=0; v<numLocal; ++v )
+    {
+        if( match[v] < firstLocal + v )
+            continue;
+        coarseMap[v] = coarseCounter++;
+        const Int partner = match[v] - firstLocal;
+        if( partner < numLocal )
+            coarseMap[partner] = coarseMap[v];
+    }
+
+    // Send the coarse indices to the remote partners which do not own them
+    sendCounts.assign( commSize, 0 );
+    for( Int v=0; v<numLocal; ++v )
+        if( match[v] >= firstLocal+numLocal )
+            sendCounts[Owner(vtxDist,match[v])] += 2;
+    Scan( sendCounts, sendOffs );
+    sendBuf.resize( Max(sendOffs.back()+sendCounts.back(),1) );
+    {
+        auto offs = sendOffs;
+        for( Int v=0; v<numLocal; ++v )
+        {
+            if( match[v] < firstLocal+numLocal )
+                continue;
+            const int q = Owner(vtxDist,match[v]);
+            sendBuf[offs[q]++] = match[v];
+            sendBuf[offs[q]++] = coarseMap[v];
+        }
+    }
+    recvBuf =
+      ExchangeInts( sendBuf, sendCounts, sendOffs, recvCounts, recvOffs, comm );
+    for( size_t k=0; k<recvBuf.size(); k+=2 )
+        coarseMap[recvBuf[k]-firstLocal] = recvBuf[k+1];
+
+    // Form the coarse indices of the ghosts
+    vector<Int> fullMap( coarseMap );
+    UpdateGhosts( view, fullMap, comm );
+
+    // Send the summed weights of the local members of each coarse vertex, as
+    // (coarse vertex, weight) pairs, to the owner of the coarse vertex
+    sendCounts.assign( commSize, 0 );
+    for( Int v=0; v<numLocal; ++v )
+    {
+        const Int partner = match[v] - firstLocal;
+        if( match[v] >= firstLocal+v || partner < 0 || partner >= numLocal )
+            sendCounts[Owner(coarseVtxDist,coarseMap[v])] += 2;
+    }
+    Scan( sendCounts, sendOffs );
+    sendBuf.resize( Max(sendOffs.back()+sendCounts.back(),1) );
+    {
+        auto offs = sendOffs;
+        for( Int v=0; v<numLocal; ++v )
+        {
+            const Int partner = match[v] - firstLocal;
+            const bool localPartner = ( partner >= 0 && partner < numLocal );
+            if( match[v] < firstLocal+v && localPartner )
+                continue;
+            Int weight = graph.vertexWeights[v];
+            if( localPartner && partner != v )
+                weight += graph.vertexWeights[partner];
+            const int q = Owner(coarseVtxDist,coarseMap[v]);
+            sendBuf[offs[q]++] = coarseMap[v];
+            sendBuf[offs[q]++] = weight;
+        }
+    }
+    recvBuf =
+      ExchangeInts( sendBuf, sendCounts, sendOffs, recvCounts, recvOffs, comm );
+    coarse.numVertices = coarseVtxDist[commSize];
+    coarse.firstLocal = firstLocalCoarse;
+    coarse.numLocal = numLocalCoarse;
+    coarse.vertexWeights.assign( numLocalCoarse, 0 );
+    for( size_t k=0; k<recvBuf.size(); k+=2 )
+        coarse.vertexWeights[recvBuf[k]-firstLocalCoarse] += recvBuf[k+1];
+
+    // Send each (coarse source, coarse target, weight) triplet to the owner
+    // of the coarse source, dropping the edges within a coarse vertex
+    sendCounts.assign( commSize, 0 );
+    for( Int v=0; v<numLocal; ++v )
+    {
+        const Int source = coarseMap[v];
+        const int q = Owner(coarseVtxDist,source);
+        for( Int e=view.offsets[v]; e<view.offsets[v+1]; ++e )
+            if( fullMap[view.targets[e]] != source )
+                sendCounts[q] += 3;
+    }
+    Scan( sendCounts, sendOffs );
+    sendBuf.resize( Max(sendOffs.back()+sendCounts.back(),1) );
+    {
+        auto offs = sendOffs;
+        for( Int v=0; v<numLocal; ++v )
+        {
+            const Int source = coarseMap[v];
+            const int q = Owner(coarseVtxDist,source);
+            for( Int e=view.offsets[v]; e<view.offsets[v+1]; ++e )
+            {
+                const Int target = fullMap[view.targets[e]];
+                if( target == source )
+                    continue;
+                sendBuf[offs[q]++] = source;
+                sendBuf[offs[q]++] = target;
+                sendBuf[offs[q]++] = graph.edgeWeights[e];
+            }
+        }
+    }
+    SwapClear( fullMap );
+    recvBuf =
+      ExchangeInts( sendBuf, sendCounts, sendOffs, recvCounts, recvOffs, comm );
+    SwapClear( sendBuf );
+
+    const Int numTriplets = recvBuf.size() / 3;
+    vector<std::pair<Int,Int>> edges( numTriplets );
+    for( Int k=0; k<numTriplets; ++k )
+        edges[k] = std::make_pair( recvBuf[3*k]-firstLocalCoarse, k );
+    std::sort
+    ( edges.begin(), edges.end(),
+      [&]( const std::pair<Int,Int>& a, const std::pair<Int,Int>& b )
+      { return a.first < b.first ||
+               (a.first == b.first &&
+                recvBuf[3*a.second+1] < recvBuf[3*b.second+1]); } );
+    coarse.offsets.assign( numLocalCoarse+1, 0 );
+    coarse.targets.clear();
+    coarse.edgeWeights.clear();
+    Int lastSource=-1, lastTarget=-1;
+    for( const auto& edge : edges )
+    {
+        const Int source = edge.first;
+        const Int target = recvBuf[3*edge.second+1];
+        const Int weight = recvBuf[3*edge.second+2];
+        if( source == lastSource && target == lastTarget )
+        {
+            coarse.edgeWeights.back() += weight;
+            continue;
+        }
+        coarse.targets.push_back( target );
+        coarse.edgeWeights.push_back( weight );
+        ++coarse.offsets[source+1];
+        lastSource = source;
+        lastTarget = target;
+    }
+    for( Int v=0; v<numLocalCoarse; ++v )
+        coarse.offsets[v+1] += coarse.offsets[v];
+}
+
+// Replicate a distributed graph on every process
+void Replicate
+( const WeightedGraph& graph,
+  const vector<Int>& vtxDist,
+        WeightedGraph& seqGraph,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const Int n = graph.numVertices;
+    const Int numLocal = graph.numLocal;
+    const Int numLocalEdges = graph.targets.size();
+
+    vector<int> vertexCounts( commSize ), vertexOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        vertexCounts[q] = vtxDist[q+1] - vtxDist[q];
+        vertexOffs[q] = vtxDist[q];
+    }
+    vector<Int> edgeCountsInt( commSize );
+    mpi::AllGather( &numLocalEdges, 1, edgeCountsInt.data(), 1, comm );
+    vector<int> edgeCounts( commSize ), edgeOffs;
+    for( int q=0; q<commSize; ++q )
+        edgeCounts[q] = edgeCountsInt[q];
+    const Int numEdges = Scan( edgeCounts, edgeOffs );
+
+    vector<Int> degrees( Max(numLocal,Int(1)) );
+    for( Int v=0; v<numLocal; ++v )
+        degrees[v] = graph.offsets[v+1] - graph.offsets[v];
+    vector<Int> allDegrees( Max(n,Int(1)) );
+    mpi::AllGather
+    ( degrees.data(), int(numLocal),
+      allDegrees.data(), vertexCounts.data(), vertexOffs.data(), comm );
+
+    seqGraph.numVertices = n;
+    seqGraph.firstLocal = 0;
+    seqGraph.numLocal = n;
+    seqGraph.offsets.resize( n+1 );
+    seqGraph.offsets[0] = 0;
+    for( Int v=0; v<n; ++v )
+        seqGraph.offsets[v+1] = seqGraph.offsets[v] + allDegrees[v];
+
+    seqGraph.vertexWeights.resize( Max(n,Int(1)) );
+    mpi::AllGather
+    ( graph.vertexWeights.data(), int(numLocal),
+      seqGraph.vertexWeights.data(), vertexCounts.data(), vertexOffs.data(),
+      comm );
+    seqGraph.vertexWeights.resize( n );
+
+    seqGraph.targets.resize( Max(numEdges,Int(1)) );
+    seqGraph.edgeWeights.resize( Max(numEdges,Int(1)) );
+    mpi::AllGather
+    ( graph.targets.data(), int(numLocalEdges),
+      seqGraph.targets.data(), edgeCounts.data(), edgeOffs.data(), comm );
+    mpi::AllGather
+    ( graph.edgeWeights.data(), int(numLocalEdges),
+      seqGraph.edgeWeights.data(), edgeCounts.data(), edgeOffs.data(), comm );
+    seqGraph.targets.resize( numEdges );
+    seqGraph.edgeWeights.resize( numEdges );
+}
+
+// Project the labels of a coarse distributed graph to the finer graph
+void Project
+( const vector<Int>& coarseVtxDist,
+  const vector<Int>& coarseLabels,
+  const vector<Int>& coarseMap,
+        vector<Int>& labels,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int numLocal = coarseMap.size();
+    const Int firstLocalCoarse = coarseVtxDist[commRank];
+
+    vector<int> sendCounts( commSize, 0 ), sendOffs;
+    for( Int v=0; v<numLocal; ++v )
+        ++sendCounts[Owner(coarseVtxDist,coarseMap[v])];
+    Scan( sendCounts, sendOffs );
+    vector<Int> sendBuf( Max(numLocal,Int(1)) );
+    {
+        auto offs = sendOffs;
+        for( Int v=0; v<numLocal; ++v )
+            sendBuf[offs[Owner(coarseVtxDist,coarseMap[v])]++] = coarseMap[v];
+    }
+    vector<int> recvCounts, recvOffs;
+    auto recvBuf =
+      ExchangeInts( sendBuf, sendCounts, sendOffs, recvCounts, recvOffs, comm );
+    for( auto& entry : recvBuf )
+        entry = coarseLabels[entry-firstLocalCoarse];
+    vector<int> replyCounts, replyOffs;
+    auto replyBuf =
+      ExchangeInts( recvBuf, recvCounts, recvOffs, replyCounts, replyOffs, comm );
+
+    labels.resize( numLocal );
+    auto offs = sendOffs;
+    for( Int v=0; v<numLocal; ++v )
+        labels[v] = replyBuf[offs[Owner(coarseVtxDist,coarseMap[v])]++];
+}
+
+// Refine a separator of a distributed graph with parallel, one-sided FM passes
+void Refine
+( const WeightedGraph& graph,
+  const vector<Int>& vtxDist,
+        vector<Int>& labels,
+  const BisectCtrl& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    LocalView view;
+    FormLocalView( graph, vtxDist, view, comm );
+
+    Int weights[3];
+    for( Int part=0; part<3; ++part )
+        weights[part] = PartWeight( graph, labels, part );
+    mpi::AllReduce( weights, 3, comm );
+    const Int maxPartWeight =
+      MaxPartWeight( weights[0]+weights[1]+weights[2], ctrl );
+    for( Int sweep=0; sweep<ctrl.numRefineSweeps; ++sweep )
+    {
+        const Int first = ( weights[LEFT_PART] <= weights[RIGHT_PART] ?
+                            LEFT_PART : RIGHT_PART );
+        Int reduction = 0;
+        for( Int k=0; k<2; ++k )
+        {
+            const Int part = ( k == 0 ? first : 1-first );
+            UpdateGhosts( view, labels, comm );
+
+            // Split the allowed growth of the side evenly between processes
+            const Int maxIncrease =
+              Max(maxPartWeight-weights[part],Int(0)) / commSize;
+            Int localWeights[3] = { weights[0], weights[1], weights[2] };
+            reduction += FMPass
+            ( view.offsets, view.targets, graph.vertexWeights, view.numLocal,
+              labels, part, maxIncrease, localWeights );
+            for( Int j=0; j<3; ++j )
+                localWeights[j] -= weights[j];
+            mpi::AllReduce( localWeights, 3, comm );
+            for( Int j=0; j<3; ++j )
+                weights[j] += localWeights[j];
+        }
+        reduction = mpi::AllReduce( reduction, comm );
+        if( reduction == 0 )
+            break;
+    }
+    labels.resize( view.numLocal );
+}
+
+} // anonymous namespace
+
+namespace multilevel {
+
+void Contract
+( const WeightedGraph& graph,
+  const vector<Int>& coarseMap,
+        Int numCoarse,
+        WeightedGraph& coarse )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.numVertices;
+
+    // Group the vertices by their coarse vertex
+    vector<Int> memberOffs( numCoarse+1, 0 ), members( n );
+    for( Int v=0; v<n; ++v )
+        ++memberOffs[coarseMap[v]+1];
+    for( Int c=0; c<numCoarse; ++c )
+        memberOffs[c+1] += memberOffs[c];
+    {
+        auto offs = memberOffs;
+        for( Int v=0; v<n; ++v )
+            members[offs[coarseMap[v]]++] = v;
+    }
+
+    coarse.numVertices = numCoarse;
+    coarse.firstLocal = 0;
+    coarse.numLocal = numCoarse;
+    coarse.offsets.resize( numCoarse+1 );
+    coarse.vertexWeights.assign( numCoarse, 0 );
+    coarse.targets.clear();
+    coarse.edgeWeights.clear();
+    vector<Int> position( numCoarse, -1 );
+    for( Int c=0; c<numCoarse; ++c )
+    {
+        const Int start = coarse.targets.size();
+        coarse.offsets[c] = start;
+        for( Int k=memberOffs[c]; k<memberOffs[c+1]; ++k )
+        {
+            const Int w = members[k];
+            coarse.vertexWeights[c] += graph.vertexWeights[w];
+            for( Int e=graph.offsets[w]; e<graph.offsets[w+1]; ++e )
+            {
+                const Int target = coarseMap[graph.targets[e]];
+                if( target == c )
+                    continue;
+                if( position[target] >= start )
+                {
+                    coarse.edgeWeights[position[target]] +=
+                      graph.edgeWeights[e];
+                }
+                else
+                {
+                    position[target] = coarse.targets.size();
+                    coarse.targets.push_back( target );
+                    coarse.edgeWeights.push_back( graph.edgeWeights[e] );
+                }
+            }
+        }
+    }
+    coarse.offsets[numCoarse] = coarse.targets.size();
+}
+
+void Coarsen
+( const WeightedGraph& graph,
+  const vector<Int>& vtxDist,
+        WeightedGraph& coarse,
+        vector<Int>& coarseVtxDist,
+        vector<Int>& coarseMap,
+        Int seed,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    std::mt19937 gen( seed );
+    El::Coarsen( graph, vtxDist, coarse, coarseVtxDist, coarseMap, gen, comm );
+}
+
+} // namespace multilevel
+
+Int MultilevelBisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& perm,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    // Form the unit-weight graph without self and too-large connections
+    const Int numSources = graph.NumSources();
+    const Int numEdges = graph.NumEdges();
+    const Int* sourceBuf = graph.LockedSourceBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+    WeightedGraph wGraph;
+    wGraph.numVertices = numSources;
+    wGraph.numLocal = numSources;
+    wGraph.offsets.assign( numSources+1, 0 );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int source = sourceBuf[e];
+        const Int target = targetBuf[e];
+        if( source != target && target < numSources )
+        {
+            ++wGraph.offsets[source+1];
+            wGraph.targets.push_back( target );
+        }
+    }
+    for( Int s=0; s<numSources; ++s )
+        wGraph.offsets[s+1] += wGraph.offsets[s];
+    wGraph.edgeWeights.assign( wGraph.targets.size(), 1 );
+    wGraph.vertexWeights.assign( numSources, 1 );
+
+    std::mt19937 gen( numSources );
+    vector<Int> labels;
+    MultilevelSeparator( wGraph, labels, ctrl, gen );
+
+    Int sizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numSources; ++s )
+        ++sizes[labels[s]];
+    Int offsets[3];
+    offsets[0] = 0;
+    offsets[1] = sizes[0];
+    offsets[2] = sizes[1] + offsets[1];
+    perm.resize( numSources );
+    for( Int s=0; s<numSources; ++s )
+        perm[s] = offsets[labels[s]]++;
+
+    EL_DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildrenFromPerm
+    ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
+    return sizes[2];
+}
+
+Int MultilevelBisect
+( const DistGraph& graph,
+        unique_ptr<Grid>& childGrid,
+        DistGraph& child,
+        DistMap& perm,
+        bool& onLeft,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = graph.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+    const int commRank = grid.Rank();
+    if( commSize == 1 )
+        LogicError
+        ("This routine assumes at least two processes are used, "
+         "otherwise one child will be lost");
+
+    // Form the local portion of the unit-weight graph without self and
+    // too-large connections
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int numLocalEdges = graph.NumLocalEdges();
+    const Int* sourceBuf = graph.LockedSourceBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+    WeightedGraph wGraph;
+    wGraph.numVertices = numSources;
+    wGraph.firstLocal = firstLocalSource;
+    wGraph.numLocal = numLocalSources;
+    wGraph.offsets.assign( numLocalSources+1, 0 );
+    for( Int e=0; e<numLocalEdges; ++e )
+    {
+        const Int source = sourceBuf[e];
+        const Int target = targetBuf[e];
+        if( source != target && target < numSources )
+        {
+            ++wGraph.offsets[source-firstLocalSource+1];
+            wGraph.targets.push_back( target );
+        }
+    }
+    for( Int s=0; s<numLocalSources; ++s )
+        wGraph.offsets[s+1] += wGraph.offsets[s];
+    wGraph.edgeWeights.assign( wGraph.targets.size(), 1 );
+    wGraph.vertexWeights.assign( numLocalSources, 1 );
+    vector<Int> vtxDist( commSize+1 );
+    mpi::AllGather( &firstLocalSource, 1, vtxDist.data(), 1, comm );
+    vtxDist[commSize] = numSources;
+
+    // Coarsen in parallel until the graph is small enough to replicate
+    std::mt19937 gen( commRank + numSources );
+    vector<WeightedGraph> coarseGraphs;
+    vector<vector<Int>> coarseVtxDists, coarseMaps;
+    const WeightedGraph* current = &wGraph;
+    const vector<Int>* currentVtxDist = &vtxDist;
+    while( current->numVertices > ctrl.coarsestSize*commSize )
+    {
+        WeightedGraph coarse;
+        vector<Int> coarseVtxDist, coarseMap;
+        Coarsen
+        ( *current, *currentVtxDist, coarse, coarseVtxDist, coarseMap,
+          gen, comm );
+        if( 20*coarse.numVertices > 19*current->numVertices )
+            break;
+        coarseGraphs.emplace_back( std::move(coarse) );
+        coarseVtxDists.emplace_back( std::move(coarseVtxDist) );
+        coarseMaps.emplace_back( std::move(coarseMap) );
+        current = &coarseGraphs.back();
+        currentVtxDist = &coarseVtxDists.back();
+    }
+
+    // Compute independent separators of the replicated coarse graph on each
+    // process and keep the best one
+    vector<Int> labels;
+    {
+        WeightedGraph seqGraph;
+        Replicate( *current, *currentVtxDist, seqGraph, comm );
+        vector<Int> seqLabels;
+        const SeparatorCost cost =
+          MultilevelSeparator( seqGraph, seqLabels, ctrl, gen );
+        vector<Int> costs( 2*commSize );
+        const Int localCost[2] = { cost.sepWeight, cost.imbalance };
+        mpi::AllGather( localCost, 2, costs.data(), 2, comm );
+        int root = 0;
+        for( int q=1; q<commSize; ++q )
+        {
+            const SeparatorCost qCost{ costs[2*q], costs[2*q+1] };
+            const SeparatorCost rootCost{ costs[2*root], costs[2*root+1] };
+            if( qCost < rootCost )
+                root = q;
+        }
+        if( seqGraph.numVertices > 0 )
+            mpi::Broadcast
+            ( seqLabels.data(), int(seqGraph.numVertices), root, comm );
+        labels.assign
+        ( seqLabels.begin()+current->firstLocal,
+          seqLabels.begin()+current->firstLocal+current->numLocal );
+    }
+    Refine( *current, *currentVtxDist, labels, ctrl, comm );
+
+    // Project and refine in parallel
+    const Int numLevels = coarseGraphs.size();
+    for( Int level=numLevels-1; level>=0; --level )
+    {
+        const WeightedGraph& fine =
+          ( level == 0 ? wGraph : coarseGraphs[level-1] );
+        const vector<Int>& fineVtxDist =
+          ( level == 0 ? vtxDist : coarseVtxDists[level-1] );
+        vector<Int> fineLabels;
+        Project
+        ( coarseVtxDists[level], labels, coarseMaps[level], fineLabels, comm );
+        labels.swap( fineLabels );
+        coarseGraphs.pop_back();
+        Refine( fine, fineVtxDist, labels, ctrl, comm );
+    }
+
+    // Order the left side, then the right side, then the separator
+    Int localSizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numLocalSources; ++s )
+        ++localSizes[labels[s]];
+    vector<Int> allSizes( 3*commSize );
+    mpi::AllGather( localSizes, 3, allSizes.data(), 3, comm );
+    Int sizes[3] = { 0, 0, 0 };
+    Int offsets[3] = { 0, 0, 0 };
+    for( int q=0; q<commSize; ++q )
+    {
+        for( Int part=0; part<3; ++part )
+        {
+            if( q < commRank )
+                offsets[part] += allSizes[3*q+part];
+            sizes[part] += allSizes[3*q+part];
+        }
+    }
+    offsets[1] += sizes[0];
+    offsets[2] += sizes[0] + sizes[1];
+    perm.SetGrid( grid );
+    perm.Resize( numSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, offsets[labels[s]]++ );
+
+    EL_DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildFromPerm
+    ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child );
+    return sizes[2];
+}
+
+} // namespace El
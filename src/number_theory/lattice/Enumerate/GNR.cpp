@@ -230,6 +230,312 @@ Base<F> TransposedHelper
     }
 }
 
+// Parallel enumeration
+// ====================
+// The enumeration tree is split into the subtrees rooted at the nodes of
+// depth 'parallelDepth' (counted from the top of each window of coordinates
+// described below), and the subtrees are searched by the loop threads.
+//
+// Since the top-most nonzero coordinate of a lattice member is restricted
+// to be positive, the tree is partitioned into the windows of coordinates
+// [lo,hi) = [n-depth,n), [n-2 depth,n-depth), ..., where each root in window
+// [lo,hi) has v(hi:n-1) = 0 and a nonzero v(lo:hi-1). All of the subtrees of
+// a root are then unconstrained.
+
+template<typename F>
+struct SubtreeRoot
+{
+    Int lo, hi;
+    Base<F> partialNorm;
+    Matrix<F> v;
+};
+
+// The best lattice member found so far (by any thread), as well as the scaling
+// of the original upper bounds that any improvement must satisfy
+template<typename F>
+struct SharedRadius
+{
+    Base<F> scale=Base<F>(1);
+    Base<F> norm;
+    Matrix<F> v;
+    bool found=false;
+
+    Base<F> Scale()
+    {
+        Base<F> scaleCopy;
+#ifdef EL_HYBRID
+        #pragma omp critical(El_svp_gnr_enum_radius)
+#endif
+        scaleCopy = scale;
+        return scaleCopy;
+    }
+
+    // Returns the (possibly updated) scaling of the upper bounds
+    Base<F> Offer
+    ( const Base<F>& candNorm, const Matrix<F>& candV,
+      const Base<F>& normUpperBound )
+    {
+        Base<F> scaleCopy;
+#ifdef EL_HYBRID
+        #pragma omp critical(El_svp_gnr_enum_radius)
+#endif
+        {
+            if( !found || candNorm < norm )
+            {
+                found = true;
+                norm = candNorm;
+                v = candV;
+                scale = Min( scale, candNorm/normUpperBound );
+            }
+            scaleCopy = scale;
+        }
+        return scaleCopy;
+    }
+};
+
+// Collect the roots of window [lo,hi) by running the (sequential) GNR
+// enumeration over levels lo,...,hi-1 with v(hi:n-1) = 0, but recording each
+// success at level 'lo' rather than returning
+template<typename F>
+void CollectRoots
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Int lo,
+        Int hi,
+        vector<SubtreeRoot<F>>& roots )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+
+    Matrix<F> partialSums;
+    Zeros( partialSums, n+1, n );
+    Matrix<Int> sumIndices;
+    Zeros( sumIndices, n+1, 1 );
+    for( Int j=0; j<=n; ++j )
+        sumIndices(j) = j-1;
+    Matrix<Real> partialNorms;
+    Zeros( partialNorms, n+1, 1 );
+    Matrix<F> centers;
+    Zeros( centers, n, 1 );
+    vector<SpiralState<F>> spiralStates(n);
+
+    Matrix<F> v;
+    Zeros( v, n, 1 );
+    F* vBuf = &v(0);
+    spiralStates[lo].Initialize( true );
+    vBuf[lo] = spiralStates[lo].Step();
+    Int lastNonzero = lo;
+
+    Int k=lo;
+    while( true )
+    {
+        const F entry = d(k)*(vBuf[k] - centers(k));
+        const Real partialNorm = SafeNorm( partialNorms(k+1), entry );
+        partialNorms(k) = partialNorm;
+        if( partialNorm < upperBounds((n-1)-k) )
+        {
+            if( k == lo )
+            {
+                SubtreeRoot<F> root;
+                root.lo = lo;
+                root.hi = hi;
+                root.partialNorm = partialNorm;
+                root.v = v;
+                roots.push_back( root );
+
+                // Move on to the next sibling
+                vBuf[k] = spiralStates[k].Step();
+            }
+            else
+            {
+                // Move down the tree
+                --k;
+                sumIndices(k) = Max(sumIndices(k),sumIndices(k+1));
+
+                      F* s = &partialSums(0,k);
+                const F* nBuf = &NTrans(0,k);
+                for( Int i=sumIndices(k+1); i>=k+1; --i )
+                    s[i] = s[i+1] + nBuf[i]*vBuf[i];
+
+                centers(k) = -partialSums(k+1,k);
+                vBuf[k] = Round(centers(k));
+                spiralStates[k].Initialize( centers(k) );
+            }
+        }
+        else
+        {
+            // Move up the tree
+            ++k;
+            if( k == hi )
+                return;
+            sumIndices(k) = k;
+            if( k > lastNonzero )
+            {
+                // Seed a constrained spiral out from zero
+                spiralStates[k].Initialize( true );
+                vBuf[k] = spiralStates[k].Step();
+                lastNonzero = k;
+            }
+            else
+            {
+                vBuf[k] = spiralStates[k].Step();
+            }
+        }
+    }
+}
+
+// Search the subtree beneath a root for lattice members whose norm profile
+// lies beneath the (shrinking) scaled upper bounds
+template<typename F>
+void SearchSubtree
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+  const SubtreeRoot<F>& root,
+        SharedRadius<F>& radius )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    const Int kRoot = root.lo;
+    const Real normUpperBound = upperBounds(n-1);
+    // How many nodes to visit before checking for improvements from the
+    // other threads
+    const Int refreshInterval = 4096;
+
+    Real scale = radius.Scale();
+    Matrix<F> v( root.v );
+    F* vBuf = &v(0);
+    if( kRoot == 0 )
+    {
+        if( root.partialNorm < scale*normUpperBound )
+            radius.Offer( root.partialNorm, v, normUpperBound );
+        return;
+    }
+
+    // Every row of partial sums is initially out of date from index hi-1
+    // downward, since v(hi:n-1) = 0
+    Matrix<F> partialSums;
+    Zeros( partialSums, n+1, n );
+    Matrix<Int> sumIndices;
+    Zeros( sumIndices, n+1, 1 );
+    for( Int j=0; j<=kRoot; ++j )
+        sumIndices(j) = root.hi-1;
+    Matrix<Real> partialNorms;
+    Zeros( partialNorms, n+1, 1 );
+    partialNorms(kRoot) = root.partialNorm;
+    Matrix<F> centers;
+    Zeros( centers, n, 1 );
+    vector<SpiralState<F>> spiralStates(n);
+
+    Int numNodes = 0;
+    Int k = kRoot;
+    bool descend = true;
+    while( true )
+    {
+        if( descend )
+        {
+            --k;
+            sumIndices(k) = Max(sumIndices(k),sumIndices(k+1));
+
+                  F* s = &partialSums(0,k);
+            const F* nBuf = &NTrans(0,k);
+            for( Int i=sumIndices(k+1); i>=k+1; --i )
+                s[i] = s[i+1] + nBuf[i]*vBuf[i];
+
+            centers(k) = -partialSums(k+1,k);
+            vBuf[k] = Round(centers(k));
+            spiralStates[k].Initialize( centers(k) );
+        }
+
+        if( ++numNodes % refreshInterval == 0 )
+            scale = radius.Scale();
+
+        const F entry = d(k)*(vBuf[k] - centers(k));
+        const Real partialNorm = SafeNorm( partialNorms(k+1), entry );
+        partialNorms(k) = partialNorm;
+        if( partialNorm < scale*upperBounds((n-1)-k) )
+        {
+            if( k == 0 )
+            {
+                scale = radius.Offer( partialNorm, v, normUpperBound );
+                vBuf[k] = spiralStates[k].Step();
+                descend = false;
+            }
+            else
+                descend = true;
+        }
+        else
+        {
+            // Move up the tree
+            ++k;
+            if( k == kRoot )
+                return;
+            sumIndices(k) = k;
+            vBuf[k] = spiralStates[k].Step();
+            descend = false;
+        }
+    }
+}
+
+template<typename F>
+Base<F> ParallelHelper
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = NTrans.Width();
+    const Int n = NTrans.Height();
+    if( n > m )
+        LogicError("Expected height(N) >= width(N)");
+    Zeros( v, n, 1 );
+    if( n == 0 )
+        return Real(0);
+    const Int depth = Max( ctrl.parallelDepth, Int(1) );
+
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    vector<SubtreeRoot<F>> roots;
+    for( Int hi=n; hi>0; hi-=depth )
+        CollectRoots( d, NTrans, upperBounds, Max(hi-depth,Int(0)), hi, roots );
+    // Search the most promising subtrees first so that the radius shrinks
+    // early. The sort is stable so that the schedule is reproducible.
+    std::stable_sort
+    ( roots.begin(), roots.end(),
+      []( const SubtreeRoot<F>& a, const SubtreeRoot<F>& b )
+      { return a.partialNorm < b.partialNorm; } );
+    if( ctrl.time )
+        Output("  Collected ",roots.size()," roots in ",timer.Stop()," seconds");
+
+    if( ctrl.time )
+        timer.Start();
+    SharedRadius<F> radius;
+    const Int numRoots = roots.size();
+#ifdef EL_HYBRID
+    #pragma omp parallel for schedule(dynamic,1) num_threads(NumLoopThreads())
+#endif
+    for( Int rootIndex=0; rootIndex<numRoots; ++rootIndex )
+        SearchSubtree( d, NTrans, upperBounds, roots[rootIndex], radius );
+    if( ctrl.time )
+        Output("  Searched ",numRoots," subtrees in ",timer.Stop()," seconds");
+
+    if( !radius.found )
+    {
+        // Return an arbitrary value greater than upperBounds(n-1)
+        v(0) = F(1);
+        return 2*upperBounds(n-1)+1;
+    }
+    v = radius.v;
+    return radius.norm;
+}
+
 } // namespace gnr_enum
 
 template<typename F>
@@ -241,7 +547,13 @@ Base<F> GNREnumeration
   const EnumCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.explicitTranspose )
+    if( ctrl.parallelDepth > 0 )
+    {
+        Matrix<F> NTrans;
+        Transpose( N, NTrans );
+        return gnr_enum::ParallelHelper( d, NTrans, upperBounds, v, ctrl );
+    }
+    else if( ctrl.explicitTranspose )
     {
         Matrix<F> NTrans;
         Transpose( N, NTrans );
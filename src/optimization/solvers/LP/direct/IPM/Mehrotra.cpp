@@ -1444,6 +1444,7 @@ void EquilibratedMehrotra
     Real muOld = 0.1;
     Real relError = 1;
     SparseMatrix<Real> J, JOrig;
+    KKTPlan<Real> kktPlan;
     Matrix<Real> d, w;
     Matrix<Real> dInner;
 
@@ -1549,7 +1550,7 @@ void EquilibratedMehrotra
             {
                 KKT
                 ( problem.A, gammaPerm, deltaPerm, betaPerm,
-                  solution.x, solution.z, JOrig, false );
+                  solution.x, solution.z, JOrig, kktPlan, false );
                 KKTRHS
                 ( residual.dualEquality, residual.primalEquality,
                   residual.dualConic, solution.z, d );
@@ -2043,6 +2044,7 @@ void EquilibratedMehrotra
 
     DistGraphMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
+    KKTPlan<Real> kktPlan;
     DistMultiVec<Real> d(grid), w(grid);
     DistMultiVec<Real> dInner(grid);
 
@@ -2149,7 +2151,7 @@ void EquilibratedMehrotra
             {
                 KKT
                 ( problem.A, gammaPerm, deltaPerm, betaPerm,
-                  solution.x, solution.z, JOrig, false );
+                  solution.x, solution.z, JOrig, kktPlan, false );
                 KKTRHS
                 ( residual.dualEquality, residual.primalEquality,
                   residual.dualConic, solution.z, d );
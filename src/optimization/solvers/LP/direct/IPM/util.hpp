@@ -77,6 +77,31 @@ void KKT
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
 
+using qp::direct::KKTPlan;
+
+template<typename Real>
+void KKT
+( const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        Real beta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J,
+        KKTPlan<Real>& plan,
+  bool onlyLower=true );
+template<typename Real>
+void KKT
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        Real beta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+        KKTPlan<Real>& plan,
+  bool onlyLower=true );
+
 using qp::direct::KKTRHS;
 using qp::direct::ExpandSolution;
 
@@ -161,6 +161,44 @@ void KKT
     qp::direct::KKT( Q, A, gamma, delta, beta, x, z, J, onlyLower );
 }
 
+template<typename Real>
+void KKT
+( const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        Real beta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J,
+        KKTPlan<Real>& plan,
+  bool onlyLower )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    SparseMatrix<Real> Q;
+    Q.Resize( n, n );
+    qp::direct::KKT( Q, A, gamma, delta, beta, x, z, J, plan, onlyLower );
+}
+
+template<typename Real>
+void KKT
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        Real beta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+        KKTPlan<Real>& plan,
+  bool onlyLower )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    DistSparseMatrix<Real> Q(A.Grid());
+    Q.Resize( n, n );
+    qp::direct::KKT( Q, A, gamma, delta, beta, x, z, J, plan, onlyLower );
+}
+
 #define PROTO(Real) \
   template void KKT \
   ( const Matrix<Real>& A, \
@@ -187,7 +225,27 @@ void KKT
           Real beta, \
     const DistMultiVec<Real>& x, \
     const DistMultiVec<Real>& z, \
-          DistSparseMatrix<Real>& J, bool onlyLower );
+          DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void KKT \
+  ( const SparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          Real beta, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          SparseMatrix<Real>& J, \
+          KKTPlan<Real>& plan, \
+    bool onlyLower ); \
+  template void KKT \
+  ( const DistSparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          Real beta, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J, \
+          KKTPlan<Real>& plan, \
+    bool onlyLower );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -858,6 +858,7 @@ void Mehrotra
     regTmp *= origTwoNormEst;
 
     SparseMatrix<Real> J, JOrig;
+    KKTPlan<Real> kktPlan;
     Matrix<Real> d,
                  w,
                  rc,    rb,    rmu,
@@ -957,7 +958,7 @@ void Mehrotra
             {
                 KKT
                 ( Q, A, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm, x, z,
-                  JOrig, false );
+                  JOrig, kktPlan, false );
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
@@ -1314,6 +1315,7 @@ void Mehrotra
 
     DistGraphMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
+    KKTPlan<Real> kktPlan;
     DistMultiVec<Real> d(grid), w(grid),
                        rc(grid),    rb(grid),    rmu(grid),
                        dxAff(grid), dyAff(grid), dzAff(grid),
@@ -1411,7 +1413,7 @@ void Mehrotra
             {
                 KKT
                 ( Q, A, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm, x, z,
-                  JOrig, false );
+                  JOrig, kktPlan, false );
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
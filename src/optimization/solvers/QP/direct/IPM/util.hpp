@@ -100,6 +100,66 @@ void KKT
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
 
+// Since the sparsity pattern of the full KKT system does not change between
+// iterations, and only its diagonal blocks depend upon the iterates and the
+// regularization, the first assembly can record the value-buffer offsets of
+// these diagonal entries so that later assemblies only overwrite them. The
+// plan is keyed on the sparsity patterns alone: the values of Q and A are
+// assumed to be fixed for the lifetime of a plan, as they are within an IPM
+// solve, so a fresh plan is required whenever they change. The plan is reset
+// if the dimensions or numbers of (local) entries change, or if the patterns
+// of Q and A no longer match the hash recorded when the plan was formed.
+template<typename Real>
+struct KKTPlan
+{
+    bool ready=false;
+    Int m=0, n=0;
+    bool onlyLower=true;
+    Int numEntriesQ=0, numEntriesA=0, numEntriesJ=0;
+    unsigned long long patternHash=0;
+    // Whether the patterns of Q and A have been checked against patternHash
+    bool validated=false;
+
+    // The value-buffer offsets of the (local) diagonal entries of the x and y
+    // blocks, along with the diagonal of Q that the former must include
+    vector<Int> xOffsets, yOffsets;
+    vector<Real> QDiag;
+
+    // The value-buffer offsets of the diagonal entries of the z block
+    // (in the distributed case, ordered as they are received)
+    vector<Int> zOffsets;
+
+    // The distributed case routes the locally-computed entries of
+    // -(z <> x) - beta^2 to the owners of the corresponding rows of J
+    vector<Int> sendInds;
+    vector<int> sendSizes, sendOffs, recvSizes, recvOffs;
+};
+
+template<typename Real>
+void KKT
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        Real beta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J,
+        KKTPlan<Real>& plan,
+  bool onlyLower=true );
+template<typename Real>
+void KKT
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        Real beta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+        KKTPlan<Real>& plan,
+  bool onlyLower=true );
+
 template<typename Real>
 void KKTRHS
 ( const Matrix<Real>& rc,
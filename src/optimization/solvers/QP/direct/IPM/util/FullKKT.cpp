@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "../../../affine/IPM/util.hpp"
+#include "../util.hpp"
 
 namespace El {
 namespace qp {
@@ -321,12 +322,256 @@ void KKT
     {
         const Int i = m+n + x.GlobalRow(iLoc);
         const Real value = -x.GetLocal(iLoc,0)/z.GetLocal(iLoc,0)-beta*beta;
-        J.QueueUpdate( i+(n+m), i+(n+m), value );
+        J.QueueUpdate( i, i, value );
     }
     J.ProcessQueues();
     J.FreezeSparsity();
 }
 
+namespace {
+
+template<typename Real>
+void HashPattern( Hasher& hasher, const SparseMatrix<Real>& A )
+{
+    const Int numEntries = A.NumEntries();
+    hasher.Add( A.Height() );
+    hasher.Add( A.Width() );
+    hasher.Add( numEntries );
+    hasher.Add( A.LockedSourceBuffer(), numEntries*sizeof(Int) );
+    hasher.Add( A.LockedTargetBuffer(), numEntries*sizeof(Int) );
+}
+
+template<typename Real>
+void HashPattern( Hasher& hasher, const DistSparseMatrix<Real>& A )
+{
+    const Int numLocalEntries = A.NumLocalEntries();
+    hasher.Add( A.Height() );
+    hasher.Add( A.Width() );
+    hasher.Add( A.FirstLocalRow() );
+    hasher.Add( numLocalEntries );
+    hasher.Add( A.LockedSourceBuffer(), numLocalEntries*sizeof(Int) );
+    hasher.Add( A.LockedTargetBuffer(), numLocalEntries*sizeof(Int) );
+}
+
+template<typename SparseMatrixType>
+unsigned long long KKTPatternHash
+( const SparseMatrixType& Q, const SparseMatrixType& A )
+{
+    Hasher hasher;
+    HashPattern( hasher, Q );
+    HashPattern( hasher, A );
+    return hasher.Hash();
+}
+
+// Hashing the (local) patterns of Q and A requires a pass over all of their
+// entries, so it is only done on the first reuse of a plan (and on every
+// reuse in debug builds)
+template<typename SparseMatrixType,typename Real>
+bool SamePattern
+( const SparseMatrixType& Q, const SparseMatrixType& A, KKTPlan<Real>& plan )
+{
+    bool checkPattern = !plan.validated;
+    EL_DEBUG_ONLY(checkPattern = true;)
+    if( checkPattern )
+    {
+        if( KKTPatternHash( Q, A ) != plan.patternHash )
+            return false;
+        plan.validated = true;
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void KKT
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        Real beta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J,
+        KKTPlan<Real>& plan,
+  bool onlyLower )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const bool reuse =
+      plan.ready && plan.m == m && plan.n == n &&
+      plan.onlyLower == onlyLower &&
+      plan.numEntriesQ == Q.NumEntries() &&
+      plan.numEntriesA == A.NumEntries() &&
+      J.Height() == m+2*n && plan.numEntriesJ == J.NumEntries() &&
+      SamePattern( Q, A, plan );
+    if( !reuse )
+    {
+        // Assemble without regularization so that the diagonal of the x block
+        // holds exactly that of Q
+        KKT( Q, A, Real(0), Real(0), Real(0), x, z, J, onlyLower );
+
+        plan.m = m;
+        plan.n = n;
+        plan.onlyLower = onlyLower;
+        plan.numEntriesQ = Q.NumEntries();
+        plan.numEntriesA = A.NumEntries();
+        plan.numEntriesJ = J.NumEntries();
+        plan.patternHash = KKTPatternHash( Q, A );
+        plan.validated = false;
+        const Real* JValBuf = J.LockedValueBuffer();
+        plan.xOffsets.resize( n );
+        plan.QDiag.resize( n );
+        plan.yOffsets.resize( m );
+        plan.zOffsets.resize( n );
+        for( Int i=0; i<n; ++i )
+        {
+            plan.xOffsets[i] = J.Offset( i, i );
+            plan.QDiag[i] = JValBuf[plan.xOffsets[i]];
+            plan.zOffsets[i] = J.Offset( n+m+i, n+m+i );
+        }
+        for( Int i=0; i<m; ++i )
+            plan.yOffsets[i] = J.Offset( n+i, n+i );
+        plan.ready = true;
+    }
+
+    // Overwrite the diagonals of the x, y and z blocks
+    // ================================================
+    Real* JValBuf = J.ValueBuffer();
+    const Real* xBuf = x.LockedBuffer();
+    const Real* zBuf = z.LockedBuffer();
+    for( Int i=0; i<n; ++i )
+        JValBuf[plan.xOffsets[i]] = plan.QDiag[i] + gamma*gamma;
+    for( Int i=0; i<m; ++i )
+        JValBuf[plan.yOffsets[i]] = -delta*delta;
+    for( Int i=0; i<n; ++i )
+        JValBuf[plan.zOffsets[i]] = -xBuf[i]/zBuf[i]-beta*beta;
+}
+
+template<typename Real>
+void KKT
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        Real beta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+        KKTPlan<Real>& plan,
+  bool onlyLower )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int xLocalHeight = x.LocalHeight();
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = A.Grid().Size();
+
+    // Each process must agree on whether or not the plan is reused
+    const bool localReuse =
+      plan.ready && plan.m == m && plan.n == n &&
+      plan.onlyLower == onlyLower &&
+      plan.numEntriesQ == Q.NumLocalEntries() &&
+      plan.numEntriesA == A.NumLocalEntries() &&
+      J.Height() == m+2*n && plan.numEntriesJ == J.NumLocalEntries() &&
+      SamePattern( Q, A, plan );
+    const bool reuse = mpi::AllReduce( Int(localReuse), mpi::MIN, comm );
+    if( !reuse )
+    {
+        // Assemble without regularization so that the diagonal of the x block
+        // holds exactly that of Q
+        KKT( Q, A, Real(0), Real(0), Real(0), x, z, J, onlyLower );
+
+        plan.m = m;
+        plan.n = n;
+        plan.onlyLower = onlyLower;
+        plan.numEntriesQ = Q.NumLocalEntries();
+        plan.numEntriesA = A.NumLocalEntries();
+        plan.numEntriesJ = J.NumLocalEntries();
+        plan.patternHash = KKTPatternHash( Q, A );
+        plan.validated = false;
+
+        // Record the locally-owned diagonal entries of the x and y blocks
+        // ---------------------------------------------------------------
+        const Real* JValBuf = J.LockedValueBuffer();
+        plan.xOffsets.clear();
+        plan.QDiag.clear();
+        plan.yOffsets.clear();
+        for( Int iLoc=0; iLoc<J.LocalHeight(); ++iLoc )
+        {
+            const Int i = J.GlobalRow(iLoc);
+            if( i < n )
+            {
+                const Int offset = J.Offset( iLoc, i );
+                plan.xOffsets.push_back( offset );
+                plan.QDiag.push_back( JValBuf[offset] );
+            }
+            else if( i < n+m )
+                plan.yOffsets.push_back( J.Offset( iLoc, i ) );
+        }
+
+        // Determine the owners of the z-block diagonal entries of J
+        // ---------------------------------------------------------
+        plan.sendSizes.assign( commSize, 0 );
+        for( Int iLoc=0; iLoc<xLocalHeight; ++iLoc )
+            ++plan.sendSizes[J.RowOwner(n+m+x.GlobalRow(iLoc))];
+        const int totalSend = Scan( plan.sendSizes, plan.sendOffs );
+        auto offs = plan.sendOffs;
+        plan.sendInds.resize( xLocalHeight );
+        vector<Int> sendRows( totalSend );
+        for( Int iLoc=0; iLoc<xLocalHeight; ++iLoc )
+        {
+            const Int i = n+m + x.GlobalRow(iLoc);
+            const int owner = J.RowOwner(i);
+            plan.sendInds[iLoc] = offs[owner];
+            sendRows[offs[owner]++] = i;
+        }
+
+        // Exchange the row indices once and store the corresponding offsets
+        // -----------------------------------------------------------------
+        plan.recvSizes.resize( commSize );
+        mpi::AllToAll
+        ( plan.sendSizes.data(), 1, plan.recvSizes.data(), 1, comm );
+        const int totalRecv = Scan( plan.recvSizes, plan.recvOffs );
+        vector<Int> recvRows( totalRecv );
+        mpi::AllToAll
+        ( sendRows.data(), plan.sendSizes.data(), plan.sendOffs.data(),
+          recvRows.data(), plan.recvSizes.data(), plan.recvOffs.data(), comm );
+        plan.zOffsets.resize( totalRecv );
+        for( Int k=0; k<totalRecv; ++k )
+        {
+            const Int i = recvRows[k];
+            plan.zOffsets[k] = J.Offset( J.LocalRow(i), i );
+        }
+        plan.ready = true;
+    }
+
+    // Send the new values of the z-block diagonal to their owners
+    // ===========================================================
+    const Int totalSend = plan.sendInds.size();
+    const Int totalRecv = plan.zOffsets.size();
+    vector<Real> sendVals( totalSend ), recvVals( totalRecv );
+    for( Int iLoc=0; iLoc<xLocalHeight; ++iLoc )
+        sendVals[plan.sendInds[iLoc]] =
+          -x.GetLocal(iLoc,0)/z.GetLocal(iLoc,0)-beta*beta;
+    mpi::AllToAll
+    ( sendVals.data(), plan.sendSizes.data(), plan.sendOffs.data(),
+      recvVals.data(), plan.recvSizes.data(), plan.recvOffs.data(), comm );
+
+    // Overwrite the diagonals of the x, y and z blocks in place
+    // =========================================================
+    Real* JValBuf = J.ValueBuffer();
+    const Int numLocalX = plan.xOffsets.size();
+    for( Int k=0; k<numLocalX; ++k )
+        JValBuf[plan.xOffsets[k]] = plan.QDiag[k] + gamma*gamma;
+    for( const Int offset : plan.yOffsets )
+        JValBuf[offset] = -delta*delta;
+    for( Int k=0; k<totalRecv; ++k )
+        JValBuf[plan.zOffsets[k]] = recvVals[k];
+}
+
 template<typename Real>
 void KKTRHS
 ( const Matrix<Real>& rc,
@@ -488,6 +733,28 @@ void ExpandSolution
     const DistMultiVec<Real>& x, \
     const DistMultiVec<Real>& z, \
           DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void KKT \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          Real beta, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          SparseMatrix<Real>& J, \
+          KKTPlan<Real>& plan, \
+    bool onlyLower ); \
+  template void KKT \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          Real beta, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J, \
+          KKTPlan<Real>& plan, \
+    bool onlyLower ); \
   template void KKTRHS \
   ( const Matrix<Real>& rc, \
     const Matrix<Real>& rb, \
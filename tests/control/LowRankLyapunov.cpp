@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Explicitly form the residual R = A Z Z^H + Z Z^H A - B B^H, where A is the
+// (positive-definite) negative of the 2D Laplacian, and return
+// || R ||_F / || B B^H ||_F
+template<typename Field>
+Base<Field> LyapunovResidual
+( Int nx, Int ny,
+  const DistMultiVec<Field>& B,
+  const DistMultiVec<Field>& Z )
+{
+    const Grid& g = B.Grid();
+    DistMatrix<Field> A(g), BDense(g), ZDense(g), Y(g), R(g);
+    Laplacian( A, nx, ny );
+    A *= -1;
+    Copy( B, BDense );
+    Copy( Z, ZDense );
+
+    Gemm( NORMAL, ADJOINT, Field(1), BDense, BDense, R );
+    const Base<Field> BBFrob = FrobeniusNorm( R );
+    Gemm( NORMAL, NORMAL, Field(1), A, ZDense, Y );
+    Gemm( NORMAL, ADJOINT, Field(1), Y, ZDense, Field(-1), R );
+    Gemm( NORMAL, ADJOINT, Field(1), ZDense, Y, Field(1), R );
+    return FrobeniusNorm( R ) / BBFrob;
+}
+
+// Approximately solve A X + X A = B B^H for the negative of the 2D Laplacian
+// (which, unlike the Laplacian itself, is positive-definite) with the
+// low-rank ADI iteration, using both estimated and analytically-supplied
+// shifts, and check the explicitly-formed residual of X = Z Z^H
+template<typename Field>
+void TestLowRankLyapunov
+( Int nx, Int ny, Int width, bool progress, const Grid& g )
+{
+    typedef Base<Field> Real;
+    const Int n = nx*ny;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistSparseMatrix<Field> A(g);
+    Laplacian( A, nx, ny );
+    A *= -1;
+    DistMultiVec<Field> B(g), Z(g);
+    Uniform( B, n, width );
+
+    LowRankLyapunovCtrl<Real> ctrl;
+    ctrl.progress = progress;
+    // Since || R ||_2 <= relTol || B B^H ||_2 at convergence and R has rank
+    // at most 'width', the Frobenius-norm ratio is at most sqrt(width) relTol
+    const Real tol = 10*Sqrt(Real(width))*ctrl.relTol;
+
+    // The eigenvalues of A are known analytically
+    const Real pi = Pi<Real>();
+    const Real hxInv = nx+1;
+    const Real hyInv = ny+1;
+    const Real lambdaMin =
+      4*hxInv*hxInv*Pow(Sin(pi/(2*hxInv)),Real(2)) +
+      4*hyInv*hyInv*Pow(Sin(pi/(2*hyInv)),Real(2));
+    const Real lambdaMax =
+      4*hxInv*hxInv*Pow(Cos(pi/(2*hxInv)),Real(2)) +
+      4*hyInv*hyInv*Pow(Cos(pi/(2*hyInv)),Real(2));
+    Matrix<Real> suppliedShifts;
+    Zeros( suppliedShifts, ctrl.numShifts, 1 );
+    for( Int j=0; j<ctrl.numShifts; ++j )
+        suppliedShifts(j) = lambdaMin*
+          Pow( lambdaMax/lambdaMin, Real(2*j+1)/Real(2*ctrl.numShifts) );
+
+    for( const bool supplyShifts : { false, true } )
+    {
+        OutputFromRoot
+        (g.Comm(),supplyShifts ? "Supplied shifts" : "Estimated shifts");
+        PushIndent();
+        if( supplyShifts )
+            ctrl.shifts = suppliedShifts;
+        else
+            ctrl.shifts.Empty();
+        Timer timer;
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        LowRankLyapunov( A, B, Z, ctrl );
+        mpi::Barrier( g.Comm() );
+        const double runTime = timer.Stop();
+        OutputFromRoot
+        (g.Comm(),"LowRankLyapunov: ",runTime," seconds, rank ",Z.Width());
+        const Real relResid = LyapunovResidual( nx, ny, B, Z );
+        OutputFromRoot
+        (g.Comm(),"|| A Z Z^H + Z Z^H A - B B^H ||_F / || B B^H ||_F = ",
+         relResid);
+        if( relResid > tol )
+            LogicError("Residual was unacceptably large");
+        PopIndent();
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nx = Input("--nx","size of x dimension",20);
+        const Int ny = Input("--ny","size of y dimension",20);
+        const Int width = Input("--width","width of B",2);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestLowRankLyapunov<double>( nx, ny, width, progress, g );
+        TestLowRankLyapunov<Complex<double>>( nx, ny, width, progress, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
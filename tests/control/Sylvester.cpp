@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A uniform matrix shifted so that, with high probability, all of its
+// eigenvalues lie in the open right-half plane
+template<typename Field>
+void StableMatrix( Matrix<Field>& A, Int n )
+{
+    Uniform( A, n, n );
+    ShiftDiagonal( A, Field(2*Sqrt(Base<Field>(n))) );
+}
+
+template<typename Field>
+void StableMatrix( DistMatrix<Field>& A, Int n )
+{
+    Uniform( A, n, n );
+    ShiftDiagonal( A, Field(2*Sqrt(Base<Field>(n))) );
+}
+
+// Check || A X + X B - C ||_F / ((|| A ||_F + || B ||_F) || X ||_F + || C ||_F)
+template<typename Field>
+void CheckSylvester
+( const string& label,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Field>& C,
+  const Matrix<Field>& X,
+  Base<Field> tol )
+{
+    typedef Base<Field> Real;
+    Matrix<Field> R( C );
+    Gemm( NORMAL, NORMAL, Field(1), A, X, Field(-1), R );
+    Gemm( NORMAL, NORMAL, Field(1), X, B, Field(1), R );
+    const Real scale =
+      (FrobeniusNorm(A)+FrobeniusNorm(B))*FrobeniusNorm(X) + FrobeniusNorm(C);
+    const Real relResid = FrobeniusNorm( R ) / scale;
+    Output(label," relative residual: ",relResid);
+    if( relResid > tol )
+        LogicError(label," residual was unacceptably large");
+}
+
+template<typename Field>
+void CheckSylvester
+( const string& label,
+  const DistMatrix<Field>& A,
+  const DistMatrix<Field>& B,
+  const DistMatrix<Field>& C,
+  const DistMatrix<Field>& X,
+  Base<Field> tol )
+{
+    typedef Base<Field> Real;
+    DistMatrix<Field> R( C );
+    Gemm( NORMAL, NORMAL, Field(1), A, X, Field(-1), R );
+    Gemm( NORMAL, NORMAL, Field(1), X, B, Field(1), R );
+    const Real scale =
+      (FrobeniusNorm(A)+FrobeniusNorm(B))*FrobeniusNorm(X) + FrobeniusNorm(C);
+    const Real relResid = FrobeniusNorm( R ) / scale;
+    OutputFromRoot(A.Grid().Comm(),label," relative residual: ",relResid);
+    if( relResid > tol )
+        LogicError(label," residual was unacceptably large");
+}
+
+// A rejected Newton-Schulz trial should only be retried once the iterates have
+// converged enough for it to likely be accepted
+void CheckInfo( const Grid& g, const SignInfo& info )
+{
+    OutputFromRoot
+    (g.Comm(),info.numIts," iterations, ",info.numNewtonSchulzIts,
+     " Newton-Schulz, ",info.numNewtonSchulzRejections," rejected");
+    if( info.numNewtonSchulzRejections > 1 )
+        LogicError("Rejected Newton-Schulz steps were retried");
+}
+
+// Solve random stable Sylvester (A X + X B = C) and Lyapunov
+// (A X + X A^H = C) equations both sequentially and distributed, with and
+// without the switch to Newton-Schulz iterations, and check their residuals
+template<typename Field>
+void TestSylvester
+( Int m, Int n, const SignCtrl<double>& ctrlDbl, const Grid& g )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 10*(m+n)*eps;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    SignCtrl<Real> ctrl;
+    ctrl.maxIts = ctrlDbl.maxIts;
+    ctrl.scaling = ctrlDbl.scaling;
+    ctrl.newtonSchulzTol = Real(ctrlDbl.newtonSchulzTol);
+    ctrl.progress = ctrlDbl.progress;
+
+    for( const bool newtonSchulz : { false, true } )
+    {
+        ctrl.newtonSchulz = newtonSchulz;
+        const string iteration =
+          ( newtonSchulz ? "Newton/Newton-Schulz" : "Newton" );
+        if( g.Rank() == 0 )
+        {
+            Output("Sequential ",iteration," iteration");
+            PushIndent();
+            Matrix<Field> A, B, C, X;
+            StableMatrix( A, m );
+            StableMatrix( B, n );
+            Uniform( C, m, n );
+            CheckInfo( g, Sylvester( A, B, C, X, ctrl ) );
+            CheckSylvester( "Sylvester", A, B, C, X, tol );
+
+            Matrix<Field> AAdj;
+            Uniform( C, m, m );
+            CheckInfo( g, Lyapunov( A, C, X, ctrl ) );
+            Adjoint( A, AAdj );
+            CheckSylvester( "Lyapunov", A, AAdj, C, X, tol );
+            PopIndent();
+        }
+
+        OutputFromRoot(g.Comm(),"Distributed ",iteration," iteration");
+        PushIndent();
+        DistMatrix<Field> A(g), B(g), C(g), X(g);
+        StableMatrix( A, m );
+        StableMatrix( B, n );
+        Uniform( C, m, n );
+        CheckInfo( g, Sylvester( A, B, C, X, ctrl ) );
+        CheckSylvester( "Sylvester", A, B, C, X, tol );
+
+        DistMatrix<Field> AAdj(g);
+        Uniform( C, m, m );
+        CheckInfo( g, Lyapunov( A, C, X, ctrl ) );
+        Adjoint( A, AAdj );
+        CheckSylvester( "Lyapunov", A, AAdj, C, X, tol );
+        PopIndent();
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of X",100);
+        const Int n = Input("--n","width of X",80);
+        const Int maxIts = Input("--maxIts","max number of iter's",100);
+        const Int scaleInt = Input("--scaling","scaling strategy",2);
+        const double newtonSchulzTol =
+          Input("--newtonSchulzTol","Newton-Schulz switch tolerance",0.5);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SignCtrl<double> ctrl;
+        ctrl.maxIts = maxIts;
+        ctrl.scaling = static_cast<SignScaling>(scaleInt);
+        ctrl.newtonSchulzTol = newtonSchulzTol;
+        ctrl.progress = progress;
+
+        const Grid g( comm );
+        TestSylvester<float>( m, n, ctrl, g );
+        TestSylvester<double>( m, n, ctrl, g );
+        TestSylvester<Complex<double>>( m, n, ctrl, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// An (integer-valued, so that sums are exact in any order) entry which
+// depends upon both of its arguments
+template<typename T>
+T TestEntry( Int a, Int b )
+{
+    T alpha = T(a);
+    if( IsComplex<T>::value )
+        SetImagPart( alpha, Base<T>(b) );
+    return alpha;
+}
+
+template<typename T>
+void CheckEqual
+( const string& name, const vector<T>& x, const vector<T>& xExpected )
+{
+    for( size_t i=0; i<x.size(); ++i )
+        if( x[i] != xExpected[i] )
+            LogicError
+            (name," result ",i," was ",x[i]," rather than ",xExpected[i]);
+}
+
+// Run AllGather, AllToAll, and AllReduce (out-of-place and in-place) with
+// 'n' entries per process and check the results against their definitions
+template<typename T>
+void RunCollectives( Int n, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    vector<T> sendBuf( n ), recvBuf( commSize*n ), expected( commSize*n );
+    for( Int i=0; i<n; ++i )
+        sendBuf[i] = TestEntry<T>( commRank*n+i, i );
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<n; ++i )
+            expected[q*n+i] = TestEntry<T>( q*n+i, i );
+    mpi::AllGather( sendBuf.data(), n, recvBuf.data(), n, comm );
+    CheckEqual( "AllGather", recvBuf, expected );
+
+    // Process q sends entry (q,p,i) to process p
+    vector<T> sendBlocks( commSize*n );
+    for( int p=0; p<commSize; ++p )
+        for( Int i=0; i<n; ++i )
+        {
+            sendBlocks[p*n+i] =
+              TestEntry<T>( (commRank*commSize+p)*n+i, p );
+            expected[p*n+i] =
+              TestEntry<T>( (p*commSize+commRank)*n+i, commRank );
+        }
+    mpi::AllToAll( sendBlocks.data(), n, recvBuf.data(), n, comm );
+    CheckEqual( "AllToAll", recvBuf, expected );
+
+    vector<T> sum( n );
+    expected.resize( n );
+    const Int rankSum = (commSize*(commSize-1))/2;
+    for( Int i=0; i<n; ++i )
+    {
+        sendBuf[i] = TestEntry<T>( commRank+i, commRank );
+        expected[i] = TestEntry<T>( commSize*i+rankSum, rankSum );
+    }
+    mpi::AllReduce( sendBuf.data(), sum.data(), n, mpi::SUM, comm );
+    CheckEqual( "AllReduce", sum, expected );
+    mpi::AllReduce( sendBuf.data(), n, mpi::SUM, comm );
+    CheckEqual( "In-place AllReduce", sendBuf, expected );
+}
+
+// Ensure that the node-aware collectives agree with the flat ones over the
+// given communicator for a range of message sizes, where the sizes first
+// grow (so that the shared window is reallocated) and then shrink (so that
+// it is reused)
+template<typename T>
+void TestCollectives( mpi::Comm comm, const string& commName )
+{
+    int numNodes, maxNodeSize;
+    mpi::NodeComposition( comm, numNodes, maxNodeSize );
+    OutputFromRoot
+    (comm,"Testing with ",TypeName<T>()," over ",commName,", which spans ",
+     numNodes," nodes of at most ",maxNodeSize," processes");
+    for( const bool nodeAware : { false, true } )
+    {
+        mpi::SetNodeAwareCollectives( nodeAware );
+        for( const Int n : { 1, 7, 1000, 7, 1 } )
+            RunCollectives<T>( n, comm );
+    }
+    mpi::SetNodeAwareCollectives( false );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        // Reversing the ranks reorders the processes relative to their nodes
+        const int commRank = mpi::Rank( comm );
+        const int commSize = mpi::Size( comm );
+        mpi::Comm reversedComm;
+        mpi::Split( comm, 0, commSize-1-commRank, reversedComm );
+
+        TestCollectives<Int>( comm, "COMM_WORLD" );
+        TestCollectives<double>( comm, "COMM_WORLD" );
+        TestCollectives<Complex<double>>( comm, "COMM_WORLD" );
+        TestCollectives<Int>( reversedComm, "the reversed COMM_WORLD" );
+        TestCollectives<double>( reversedComm, "the reversed COMM_WORLD" );
+        TestCollectives<Complex<double>>
+        ( reversedComm, "the reversed COMM_WORLD" );
+
+        mpi::Free( reversedComm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void CheckNodeHeight
+( int gridSize, int nodeSize, GridOrder order, int expectedHeight )
+{
+    const int height = Grid::NodeHeight( gridSize, nodeSize, order );
+    if( height != expectedHeight )
+        LogicError
+        ("NodeHeight(",gridSize,",",nodeSize,",",
+         order==COLUMN_MAJOR ? "COLUMN_MAJOR" : "ROW_MAJOR",") was ",height,
+         " rather than ",expectedHeight);
+}
+
+// Check NodeHeight against hand-computed heights and ensure that, for every
+// node size dividing each grid size, the resulting grid is valid and keeps
+// each process column (row) of a COLUMN_MAJOR (ROW_MAJOR) grid on one node
+void TestNodeHeight()
+{
+    OutputFromRoot(mpi::COMM_WORLD,"Testing NodeHeight");
+    // The default 4 x 4 grid already fits within nodes of four processes
+    CheckNodeHeight( 16, 4, COLUMN_MAJOR, 4 );
+    CheckNodeHeight( 16, 4, ROW_MAJOR, 4 );
+    // The default 8 x 4 grid with the columns of 8 (rows of 4) processes
+    CheckNodeHeight( 32, 8, COLUMN_MAJOR, 8 );
+    CheckNodeHeight( 32, 8, ROW_MAJOR, 8 );
+    // Columns of the default height of four cannot fit within nodes of six
+    // processes, and three is the closest height which does
+    CheckNodeHeight( 24, 6, COLUMN_MAJOR, 3 );
+    CheckNodeHeight( 24, 6, ROW_MAJOR, 4 );
+    // With one process per node, each column (row) must be a single process
+    CheckNodeHeight( 12, 1, COLUMN_MAJOR, 1 );
+    CheckNodeHeight( 12, 1, ROW_MAJOR, 12 );
+
+    for( int gridSize=1; gridSize<=64; ++gridSize )
+        for( int nodeSize=1; nodeSize<=gridSize; ++nodeSize )
+        {
+            if( gridSize % nodeSize != 0 )
+                continue;
+            for( const auto order : { COLUMN_MAJOR, ROW_MAJOR } )
+            {
+                const int height =
+                  Grid::NodeHeight( gridSize, nodeSize, order );
+                if( height < 1 || gridSize % height != 0 )
+                    LogicError
+                    ("NodeHeight(",gridSize,",",nodeSize,") = ",height,
+                     " does not divide the grid size");
+                const int localDim =
+                  ( order==COLUMN_MAJOR ? height : gridSize/height );
+                if( nodeSize % localDim != 0 )
+                    LogicError
+                    ("NodeHeight(",gridSize,",",nodeSize,") = ",height,
+                     " splits a process ",
+                     order==COLUMN_MAJOR ? "column" : "row",
+                     " across nodes");
+            }
+        }
+}
+
+// Form a node-mapped grid and ensure that it has the height chosen by
+// NodeHeight, that (for equal node sizes) each process column (row) lies
+// within one node, and that Gemm over the grid is correct
+template<typename T>
+void TestNodeMappedGemm
+( mpi::Comm comm, GridOrder order, Int m, Int n, Int k )
+{
+    const Grid grid( comm, order, NODE_MAPPING );
+    const int commSize = mpi::Size( comm );
+    int numNodes, maxNodeSize;
+    mpi::NodeComposition( comm, numNodes, maxNodeSize );
+    OutputFromRoot
+    (comm,"Testing ",TypeName<T>()," Gemm over a ",grid.Height()," x ",
+     grid.Width()," ",order==COLUMN_MAJOR ? "column-major" : "row-major",
+     " node-mapped grid of ",numNodes," nodes with at most ",maxNodeSize,
+     " processes each");
+    PushIndent();
+    if( grid.Mapping() != NODE_MAPPING )
+        LogicError("The grid did not keep its mapping");
+    if( numNodes*maxNodeSize == commSize )
+    {
+        const int expectedHeight =
+          Grid::NodeHeight( commSize, maxNodeSize, order );
+        if( grid.Height() != expectedHeight )
+            LogicError
+            ("The grid height was ",grid.Height()," rather than ",
+             expectedHeight);
+        int localNumNodes, localMaxNodeSize;
+        mpi::NodeComposition
+        ( order==COLUMN_MAJOR ? grid.ColComm() : grid.RowComm(),
+          localNumNodes, localMaxNodeSize );
+        if( localNumNodes != 1 )
+            LogicError
+            ("A process ",order==COLUMN_MAJOR ? "column" : "row",
+             " spanned ",localNumNodes," nodes");
+    }
+
+    DistMatrix<T> A(grid), B(grid), C(grid);
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Uniform( C, m, n );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B ),
+                            C_STAR_STAR( C );
+    Gemm( NORMAL, NORMAL, T(3), A, B, T(4), C );
+
+    // Compare against a redundant computation on each process
+    Gemm
+    ( NORMAL, NORMAL,
+      T(3), A_STAR_STAR.LockedMatrix(), B_STAR_STAR.LockedMatrix(),
+      T(4), C_STAR_STAR.Matrix() );
+    const Base<T> CFrob = FrobeniusNorm( C_STAR_STAR );
+    DistMatrix<T,STAR,STAR> E( C );
+    E -= C_STAR_STAR;
+    const Base<T> relError = FrobeniusNorm( E ) / CFrob;
+    OutputFromRoot(comm,"|| C - C_ref ||_F / || C_ref ||_F = ",relError);
+    if( relError > 10*k*limits::Epsilon<Base<T>>() )
+        LogicError("Gemm error was unacceptably large");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of result",100);
+        const Int n = Input("--n","width of result",100);
+        const Int k = Input("--k","inner dimension",100);
+        ProcessInput();
+        PrintInputReport();
+
+        TestNodeHeight();
+        for( const auto order : { COLUMN_MAJOR, ROW_MAJOR } )
+        {
+            TestNodeMappedGemm<double>( comm, order, m, n, k );
+            TestNodeMappedGemm<Complex<double>>( comm, order, m, n, k );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void AssertSamePolicy
+( const ThreadingCtrl& expected, const ThreadingCtrl& actual, string msg )
+{
+    if( expected.numBlasThreads != actual.numBlasThreads ||
+        expected.numLoopThreads != actual.numLoopThreads )
+        LogicError
+        (msg,": expected (",expected.numBlasThreads,",",
+         expected.numLoopThreads,") BLAS/loop threads but found (",
+         actual.numBlasThreads,",",actual.numLoopThreads,")");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int numThreads = Input("--numThreads","threads to push",2);
+        ProcessInput();
+
+        const ThreadingCtrl original = CurrentThreadingCtrl();
+        const Int originalLoopThreads = NumLoopThreads();
+
+        // Push an explicit policy and ensure that popping it restores the
+        // original (possibly default) policy rather than a resolved one
+        ThreadingCtrl ctrl;
+        ctrl.numBlasThreads = numThreads;
+        ctrl.numLoopThreads = numThreads;
+        PushThreadingCtrl( ctrl );
+        if( NumLoopThreads() != Min(numThreads,MaxThreads()) )
+            LogicError
+            ("Pushed ",numThreads," loop threads but found ",NumLoopThreads());
+
+        // A nested push of a nonpositive policy should leave it untouched
+        const ThreadingCtrl pushed = CurrentThreadingCtrl();
+        PushThreadingCtrl( ThreadingCtrl() );
+        AssertSamePolicy( pushed, CurrentThreadingCtrl(), "Nested push" );
+        PopThreadingCtrl();
+        AssertSamePolicy( pushed, CurrentThreadingCtrl(), "Nested pop" );
+
+        PopThreadingCtrl();
+        AssertSamePolicy( original, CurrentThreadingCtrl(), "Pop" );
+        if( NumLoopThreads() != originalLoopThreads )
+            LogicError
+            ("Popping changed the number of loop threads from ",
+             originalLoopThreads," to ",NumLoopThreads());
+
+        // Pushing the current policy should be a no-op
+        PushThreadingCtrl( CurrentThreadingCtrl() );
+        AssertSamePolicy( original, CurrentThreadingCtrl(), "Push current" );
+        EmptyThreadingCtrlStack();
+        AssertSamePolicy( original, CurrentThreadingCtrl(), "Empty stack" );
+
+        OutputFromRoot
+        (mpi::COMM_WORLD,"Threading policy push/pop tests passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
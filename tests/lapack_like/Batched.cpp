@@ -0,0 +1,188 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestBatched
+( Int n,
+  Int batchSize,
+  BatchLayout layout,
+  bool print )
+{
+    typedef Base<Field> Real;
+    Output("Testing with ",TypeName<Field>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+
+    // Form a batch of Hermitian positive-definite matrices, A_k = G_k G_k^H,
+    // and a batch of right-hand sides
+    BatchMatrix<Field> G(n,n,batchSize,layout), A(n,n,batchSize,layout),
+                       B(n,1,batchSize,layout);
+    Matrix<Field> GMember, BMember;
+    for( Int k=0; k<batchSize; ++k )
+    {
+        Uniform( GMember, n, n );
+        ShiftDiagonal( GMember, Field(n) );
+        G.SetMatrix( k, GMember );
+        Uniform( BMember, n, 1 );
+        B.SetMatrix( k, BMember );
+    }
+    batched::Gemm( NORMAL, ADJOINT, Field(1), G, G, Field(0), A );
+
+    Output("Starting batched Cholesky solves...");
+    Timer timer;
+    timer.Start();
+    auto L( A );
+    auto X( B );
+    batched::Cholesky( LOWER, L );
+    batched::Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), L, X );
+    batched::Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Field(1), L, X );
+    Output(timer.Stop()," seconds");
+
+    Real maxCholError = 0;
+    Matrix<Field> AMember, XMember;
+    for( Int k=0; k<batchSize; ++k )
+    {
+        A.GetMatrix( k, AMember );
+        X.GetMatrix( k, XMember );
+        B.GetMatrix( k, BMember );
+        const Real frobA = FrobeniusNorm( AMember );
+        const Real frobX = FrobeniusNorm( XMember );
+        Gemm( NORMAL, NORMAL, Field(-1), AMember, XMember, Field(1), BMember );
+        maxCholError =
+          Max( maxCholError, FrobeniusNorm(BMember)/(eps*n*frobA*frobX) );
+    }
+    Output("max || B - A X ||_F / (eps n ||A||_F ||X||_F) = ",maxCholError);
+    if( maxCholError > Real(100) )
+        LogicError("Batched Cholesky solves were unacceptably inaccurate");
+
+    Output("Starting batched LU...");
+    auto LU( G );
+    Matrix<Int> pivots;
+    timer.Start();
+    batched::LU( LU, pivots );
+    Output(timer.Stop()," seconds");
+    if( print )
+        Print( pivots, "pivots" );
+
+    // Apply the recorded row swaps to each member and compare against L U
+    Real maxLUError = 0;
+    Matrix<Field> LUMember, LMember, UMember;
+    for( Int k=0; k<batchSize; ++k )
+    {
+        G.GetMatrix( k, GMember );
+        LU.GetMatrix( k, LUMember );
+        const Real frobA = FrobeniusNorm( GMember );
+        for( Int j=0; j<n; ++j )
+        {
+            const Int iPiv = pivots(j,k);
+            if( iPiv != j )
+                RowSwap( GMember, j, iPiv );
+        }
+        LMember = LUMember;
+        MakeTrapezoidal( LOWER, LMember );
+        FillDiagonal( LMember, Field(1) );
+        UMember = LUMember;
+        MakeTrapezoidal( UPPER, UMember );
+        Gemm( NORMAL, NORMAL, Field(-1), LMember, UMember, Field(1), GMember );
+        maxLUError = Max( maxLUError, FrobeniusNorm(GMember)/(eps*n*frobA) );
+    }
+    Output("max || P A - L U ||_F / (eps n ||A||_F) = ",maxLUError);
+    if( maxLUError > Real(100) )
+        LogicError("Batched LU was unacceptably inaccurate");
+
+    // Solve X U = C with the upper-triangular factors from the right
+    BatchMatrix<Field> C(n,n,batchSize,layout);
+    Matrix<Field> CMember;
+    for( Int k=0; k<batchSize; ++k )
+    {
+        Uniform( CMember, n, n );
+        C.SetMatrix( k, CMember );
+    }
+    auto Y( C );
+    batched::Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), LU, Y );
+    Real maxTrsmError = 0;
+    Matrix<Field> YMember;
+    for( Int k=0; k<batchSize; ++k )
+    {
+        LU.GetMatrix( k, UMember );
+        MakeTrapezoidal( UPPER, UMember );
+        Y.GetMatrix( k, YMember );
+        C.GetMatrix( k, CMember );
+        const Real frobU = FrobeniusNorm( UMember );
+        const Real frobY = FrobeniusNorm( YMember );
+        Gemm( NORMAL, NORMAL, Field(-1), YMember, UMember, Field(1), CMember );
+        maxTrsmError =
+          Max( maxTrsmError, FrobeniusNorm(CMember)/(eps*n*frobU*frobY) );
+    }
+    Output("max || C - X U ||_F / (eps n ||U||_F ||X||_F) = ",maxTrsmError);
+    if( maxTrsmError > Real(100) )
+        LogicError("Batched right upper Trsm was unacceptably inaccurate");
+
+    Output("Starting batched Hermitian eigensolves...");
+    auto T( A );
+    BatchMatrix<Real> w;
+    BatchMatrix<Field> Q;
+    timer.Start();
+    batched::HermitianEig( LOWER, T, w, Q );
+    Output(timer.Stop()," seconds");
+
+    Real maxEigError = 0;
+    Matrix<Field> QMember, QW;
+    Matrix<Real> wMember;
+    for( Int k=0; k<batchSize; ++k )
+    {
+        A.GetMatrix( k, AMember );
+        Q.GetMatrix( k, QMember );
+        w.GetMatrix( k, wMember );
+        const Real frobA = FrobeniusNorm( AMember );
+        QW = QMember;
+        DiagonalScale( RIGHT, NORMAL, wMember, QW );
+        Gemm( NORMAL, ADJOINT, Field(-1), QW, QMember, Field(1), AMember );
+        maxEigError = Max( maxEigError, FrobeniusNorm(AMember)/(eps*n*frobA) );
+        if( print && k == 0 )
+            Print( wMember, "w_0" );
+    }
+    Output("max || A - Q Lambda Q^H ||_F / (eps n ||A||_F) = ",maxEigError);
+    if( maxEigError > Real(100) )
+        LogicError("Batched Hermitian eigensolves were unacceptably inaccurate");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","size of each matrix",8);
+        const Int batchSize = Input("--batchSize","number of matrices",1000);
+        const bool interleaved =
+          Input("--interleaved","interleave the batch?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const BatchLayout layout =
+          ( interleaved ? BATCH_INTERLEAVED : BATCH_STRIDED );
+        if( mpi::Rank() == 0 )
+        {
+            TestBatched<float>( n, batchSize, layout, print );
+            TestBatched<Complex<float>>( n, batchSize, layout, print );
+            TestBatched<double>( n, batchSize, layout, print );
+            TestBatched<Complex<double>>( n, batchSize, layout, print );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -196,6 +196,7 @@ void TestSuite
   bool sequential,
   bool distributed,
   bool correctness,
+  bool testQDWH,
   bool print,
   const Grid& g,
   const HermitianEigCtrl<double>& ctrlDbl )
@@ -216,6 +217,7 @@ void TestSuite
     HermitianEigCtrl<F> ctrl;
     ctrl.timeStages = ctrlDbl.timeStages;
     ctrl.useScaLAPACK = ctrlDbl.useScaLAPACK;
+    ctrl.useQDWH = ctrlDbl.useQDWH;
     ctrl.tridiagCtrl.symvCtrl.bsize =
       ctrlDbl.tridiagCtrl.symvCtrl.bsize;
     ctrl.tridiagCtrl.symvCtrl.avoidTrmvBasedLocalSymv =
@@ -255,6 +257,22 @@ void TestSuite
         ( m, uplo, onlyEigvals, clustered, correctness, print, g, ctrl );
     }
 
+    if( testQDWH && !ctrl.useQDWH )
+    {
+        OutputFromRoot(g.Comm(),"QDWH-eig:");
+        ctrl.useQDWH = true;
+        if( sequential && g.Rank() == 0 )
+        {
+            TestHermitianEigSequential<F>
+            ( m, uplo, onlyEigvals, clustered, correctness, print, ctrl );
+        }
+        if( distributed )
+        {
+            TestHermitianEig<F>
+            ( m, uplo, onlyEigvals, clustered, correctness, print, g, ctrl );
+        }
+    }
+
     PopIndent();
 }
 
@@ -289,6 +307,9 @@ main( int argc, char* argv[] )
           Input("--avoidTrmv","avoid Trmv based Symv",true);
         const bool useScaLAPACK =
           Input("--useScaLAPACK","test ScaLAPACK?",false);
+        const bool useQDWH = Input("--useQDWH","use QDWH-eig?",false);
+        const bool testQDWH =
+          Input("--testQDWH","also test QDWH-eig?",true);
         const Int algInt = Input("--algInt","0: QR, 1: D&C, 2: MRRR",1);
         const bool sequential =
           Input("--sequential","test sequential?",true);
@@ -338,6 +359,7 @@ main( int argc, char* argv[] )
         HermitianEigCtrl<double> ctrl;
         ctrl.timeStages = timeStages;
         ctrl.useScaLAPACK = useScaLAPACK;
+        ctrl.useQDWH = useQDWH;
         ctrl.tridiagCtrl.symvCtrl.bsize = nbLocal;
         ctrl.tridiagCtrl.symvCtrl.avoidTrmvBasedLocalSymv = avoidTrmv;
         ctrl.tridiagEigCtrl.sort = sort;
@@ -349,63 +371,63 @@ main( int argc, char* argv[] )
         {
             TestSuite<float>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 
             TestSuite<double>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 
 #ifdef EL_HAVE_QD
             TestSuite<DoubleDouble>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 
             TestSuite<QuadDouble>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestSuite<Quad>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 #endif
 #ifdef EL_HAVE_MPC
             TestSuite<BigFloat>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 #endif
          }
          if( testCpx )
          {
             TestSuite<Complex<float>>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 
             TestSuite<Complex<double>>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 
 #ifdef EL_HAVE_QD
             TestSuite<Complex<DoubleDouble>>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 
             TestSuite<Complex<QuadDouble>>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestSuite<Complex<Quad>>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestSuite<Complex<BigFloat>>
             ( m, uplo, onlyEigvals, clustered,
-              sequential, distributed, correctness, print, g, ctrl );
+              sequential, distributed, correctness, testQDWH, print, g, ctrl );
 #endif
          }
     }
@@ -293,6 +293,48 @@ void TestRandom
     TestRandomHelper( H, ctrl, print );
 }
 
+// Run the distributed AED with an adaptive deflation window and/or with each
+// sweep overlapped with the following AED. The matrix should be large enough
+// that the portion of the window above the deflation window spans several
+// blocks for a number of iterations.
+template<typename Field>
+void TestAED
+( Int n, const Grid& grid, const HessenbergSchurCtrl& ctrl, bool print )
+{
+    EL_DEBUG_CSE
+    if( grid.Rank() == 0 )
+        Output
+        ("Testing AED options on a ",grid.Height()," x ",grid.Width(),
+         " grid with ",TypeName<Field>());
+
+    DistMatrix<Field,MC,MR,BLOCK> H(grid);
+    Uniform( H, n, n );
+    MakeTrapezoidal( UPPER, H, -1 );
+    if( print )
+        Print( H, "H" );
+
+    auto ctrlAED( ctrl );
+    ctrlAED.alg = HESSENBERG_SCHUR_AED;
+    // Stay distributed for windows down to a quarter of the matrix size so
+    // that more of the iterations exercise the options
+    ctrlAED.minDistMultiBulgeSize =
+      Min( ctrlAED.minDistMultiBulgeSize, n/4 );
+    for( const bool adaptiveAED : { false, true } )
+    {
+        for( const bool concurrentAED : { false, true } )
+        {
+            if( !adaptiveAED && !concurrentAED )
+                continue;
+            if( grid.Rank() == 0 )
+                Output
+                ("adaptiveAED=",adaptiveAED,", concurrentAED=",concurrentAED);
+            ctrlAED.adaptiveAED = adaptiveAED;
+            ctrlAED.concurrentAED = concurrentAED;
+            TestRandomHelper( H, ctrlAED, print );
+        }
+    }
+}
+
 int main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
@@ -309,8 +351,16 @@ int main( int argc, char* argv[] )
           Input("--accumulate","accumulate reflections?",true);
         const bool sortShifts =
           Input("--sortShifts","sort shifts for AED?",true);
+        const bool adaptiveAED =
+          Input("--adaptiveAED","adapt AED window to deflation rate?",false);
+        const bool concurrentAED =
+          Input("--concurrentAED","overlap distributed AED and sweeps?",false);
         const bool testSweep =
           Input("--testSweep","test pure-shift sweep?",false);
+        const bool testAED =
+          Input("--testAED","test the distributed AED options?",true);
+        const Int nAED =
+          Input("--nAED","matrix size for testing the AED options",500);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool distributed =
           Input("--distributed","test distributed?",true);
@@ -324,6 +374,8 @@ int main( int argc, char* argv[] )
         ctrl.minMultiBulgeSize = minMultiBulgeSize;
         ctrl.accumulateReflections = accumulate;
         ctrl.sortShifts = sortShifts;
+        ctrl.adaptiveAED = adaptiveAED;
+        ctrl.concurrentAED = concurrentAED;
         ctrl.progress = progress;
 
         // TODO(poulson): Allow the grid dimensions to be selected
@@ -390,6 +442,18 @@ int main( int argc, char* argv[] )
             TestRandom<Complex<BigFloat>>( n, grid, ctrl, print );
 #endif
         }
+        if( distributed && testAED )
+        {
+            if( grid.Height() >= 2 && grid.Width() >= 2 )
+            {
+                TestAED<double>( nAED, grid, ctrl, print );
+                TestAED<Complex<double>>( nAED, grid, ctrl, print );
+            }
+            else if( grid.Rank() == 0 )
+                Output
+                ("Skipping the AED option tests, which require a grid of at "
+                 "least 2 x 2");
+        }
     }
     catch( std::exception& e ) { ReportException(e); }
 
@@ -0,0 +1,209 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field,class SolverType>
+void TestSolver
+( const string& name,
+  const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& X,
+  const SolverType& solver,
+  Base<Field> tol )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = A.Grid();
+    const Int n = A.Height();
+    const Int numRHS = X.Width();
+
+    DistMultiVec<Field> B(grid), Y(grid);
+    Zeros( B, n, numRHS );
+    Multiply( NORMAL, Field(1), A, X, Field(0), B );
+    Y = B;
+
+    Timer timer;
+    timer.Start();
+    const Int numIts = solver( Y );
+    timer.Stop();
+
+    Multiply( NORMAL, Field(-1), A, Y, Field(1), B );
+    DistMultiVec<Field> AX(grid);
+    Zeros( AX, n, numRHS );
+    Multiply( NORMAL, Field(1), A, X, Field(0), AX );
+    const Real relResid = FrobeniusNorm( B ) / FrobeniusNorm( AX );
+    OutputFromRoot
+    (grid.Comm(),name,": ",numIts," iterations in ",timer.Partial(),
+     " seconds, || B - A X ||_F / || B ||_F = ",relResid);
+    if( relResid > tol )
+        LogicError(name," relative residual was unacceptably large");
+}
+
+template<typename Field>
+void TestKrylov
+( Int n1,
+  Int n2,
+  Int n3,
+  Int numRHS,
+  bool progress,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    const Int N = n1*n2*n3;
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+
+    DistMultiVec<Field> X( N, numRHS, grid );
+    MakeUniform( X );
+
+    const JacobiPrecond<Field> jacobi( A );
+    const ILU0Precond<Field> ilu( A );
+    DistSparseLDLFactorization<Field> factorization;
+    factorization.Initialize( A );
+    factorization.Factor();
+    auto ldl =
+      [&]( DistMultiVec<Field>& B ) { factorization.Solve( B ); };
+    auto identity = []( DistMultiVec<Field>& B ) { };
+
+    KrylovCtrl<Real> ctrl;
+    ctrl.progress = progress;
+    // The pipelined recurrences can drift slightly past the requested
+    // tolerance from their updated (rather than recomputed) residuals
+    const Real tol = 10*ctrl.relTol;
+    for( const bool pipelined : { false, true } )
+    {
+        ctrl.pipelined = pipelined;
+        const string suffix = pipelined ? " (pipelined)" : "";
+        TestSolver
+        ( "CG"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return CG( A, identity, B, ctrl ); }, tol );
+        TestSolver
+        ( "Jacobi CG"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return CG( A, jacobi, B, ctrl ); }, tol );
+        TestSolver
+        ( "ILU(0) CG"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return CG( A, ilu, B, ctrl ); }, tol );
+        TestSolver
+        ( "LDL CG"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return CG( A, ldl, B, ctrl ); }, tol );
+        TestSolver
+        ( "MINRES"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return MINRES( A, identity, B, ctrl ); }, tol );
+        TestSolver
+        ( "Jacobi MINRES"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return MINRES( A, jacobi, B, ctrl ); }, tol );
+        TestSolver
+        ( "BiCGStab"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return BiCGStab( A, identity, B, ctrl ); }, tol );
+        TestSolver
+        ( "ILU(0) BiCGStab"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return BiCGStab( A, ilu, B, ctrl ); }, tol );
+    }
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& x,
+           Field beta, DistMultiVec<Field>& y )
+      { Multiply( NORMAL, alpha, A, x, beta, y ); };
+    const Int restart = 30;
+    for( const auto orthAlg : { GMRES_MGS, GMRES_CGS2, GMRES_PIPELINED } )
+    {
+        const string suffix =
+          orthAlg == GMRES_MGS ? " (MGS)" :
+          orthAlg == GMRES_CGS2 ? " (CGS2)" : " (pipelined)";
+        TestSolver
+        ( "FGMRES"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return FGMRES
+            ( applyA, identity, B, ctrl.relTol, restart, ctrl.maxIts,
+              progress, orthAlg ); }, tol );
+        TestSolver
+        ( "ILU(0) FGMRES"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return FGMRES
+            ( applyA, ilu, B, ctrl.relTol, restart, ctrl.maxIts,
+              progress, orthAlg ); }, tol );
+        TestSolver
+        ( "LDL FGMRES"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return FGMRES
+            ( applyA, ldl, B, ctrl.relTol, restart, ctrl.maxIts,
+              progress, orthAlg ); }, tol );
+        TestSolver
+        ( "LGMRES"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return LGMRES
+            ( applyA, identity, B, ctrl.relTol, restart, ctrl.maxIts,
+              progress, orthAlg ); }, tol );
+        TestSolver
+        ( "ILU(0) LGMRES"+suffix, A, X,
+          [&]( DistMultiVec<Field>& B )
+          { return LGMRES
+            ( applyA, ilu, B, ctrl.relTol, restart, ctrl.maxIts,
+              progress, orthAlg ); }, tol );
+    }
+    TestSolver
+    ( "Block CG", A, X,
+      [&]( DistMultiVec<Field>& B )
+      { return BlockCG( A, identity, B, ctrl ); }, tol );
+    TestSolver
+    ( "ILU(0) block CG", A, X,
+      [&]( DistMultiVec<Field>& B )
+      { return BlockCG( A, ilu, B, ctrl ); }, tol );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",4);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+
+        const Grid grid( comm );
+
+        TestKrylov<float>( n1, n2, n3, numRHS, progress, grid );
+        TestKrylov<Complex<float>>( n1, n2, n3, numRHS, progress, grid );
+        TestKrylov<double>( n1, n2, n3, numRHS, progress, grid );
+        TestKrylov<Complex<double>>( n1, n2, n3, numRHS, progress, grid );
+
+#ifdef EL_HAVE_QD
+        TestKrylov<DoubleDouble>( n1, n2, n3, numRHS, progress, grid );
+        TestKrylov<QuadDouble>( n1, n2, n3, numRHS, progress, grid );
+#endif
+
+#ifdef EL_HAVE_QUAD
+        TestKrylov<Quad>( n1, n2, n3, numRHS, progress, grid );
+#endif
+
+#ifdef EL_HAVE_MPC
+        TestKrylov<BigFloat>( n1, n2, n3, numRHS, progress, grid );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,322 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The neighbors of vertex i = x + y*n + z*n*n of an n x n x n 7-point stencil
+vector<Int> StencilNeighbors( Int i, Int n )
+{
+    const Int x = i % n;
+    const Int y = (i/n) % n;
+    const Int z = i/(n*n);
+    vector<Int> neighbors( 1, i );
+    if( x != 0 )   neighbors.push_back( i-1 );
+    if( x != n-1 ) neighbors.push_back( i+1 );
+    if( y != 0 )   neighbors.push_back( i-n );
+    if( y != n-1 ) neighbors.push_back( i+n );
+    if( z != 0 )   neighbors.push_back( i-n*n );
+    if( z != n-1 ) neighbors.push_back( i+n*n );
+    return neighbors;
+}
+
+// The new indices are ordered as the left side, the right side, and then
+// the separator
+Int Part( Int newIndex, Int leftSize, Int rightSize )
+{
+    if( newIndex < leftSize )
+        return 0;
+    else if( newIndex < leftSize+rightSize )
+        return 1;
+    else
+        return 2;
+}
+
+void CheckSeparator
+( Int numVertices, Int leftSize, Int rightSize, Int sepSize,
+  Int numCrossEdges, const BisectCtrl& ctrl, mpi::Comm comm )
+{
+    OutputFromRoot
+    (comm,"Partition sizes were: ",leftSize,",",rightSize,",",sepSize);
+    if( leftSize+rightSize+sepSize != numVertices )
+        LogicError("The partition sizes did not sum to ",numVertices);
+    if( leftSize == 0 || rightSize == 0 )
+        LogicError("One of the halves was empty");
+    if( numCrossEdges != 0 )
+        LogicError
+        ("There were ",numCrossEdges," edges between the two halves");
+    const Int maxSize = Int(Ceil(ctrl.imbalance*numVertices/2.));
+    if( Max(leftSize,rightSize) > maxSize )
+        LogicError
+        ("The larger half had ",Max(leftSize,rightSize)," vertices, but at "
+         "most ",maxSize," were allowed");
+}
+
+// Bisect the graph of an n x n x n 7-point stencil with the built-in
+// multilevel engine (sequentially and, with multiple processes, distributed)
+// and ensure that the result is a permutation whose separator disconnects
+// two halves which are within the requested imbalance. The optimal separator
+// is an n x n plane, so the separator is also required to be no more than
+// twice as large.
+void TestMultilevelBisect( Int n, const BisectCtrl& ctrl, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    const int commRank = grid.Rank();
+    const Int numVertices = n*n*n;
+    const Int maxSepSize = 2*n*n;
+
+    if( commRank == 0 )
+    {
+        Output("Sequential bisection");
+        PushIndent();
+        Graph graph( numVertices );
+        graph.Reserve( 7*numVertices );
+        for( Int i=0; i<numVertices; ++i )
+            for( const Int j : StencilNeighbors(i,n) )
+                graph.QueueConnection( i, j );
+        graph.ProcessQueues();
+
+        Graph leftChild, rightChild;
+        vector<Int> perm;
+        Timer timer;
+        timer.Start();
+        const Int sepSize =
+          MultilevelBisect( graph, leftChild, rightChild, perm, ctrl );
+        Output("Bisection took ",timer.Stop()," seconds");
+        EnsurePermutation( perm );
+
+        const Int leftSize = leftChild.NumSources();
+        const Int rightSize = rightChild.NumSources();
+        Int numCrossEdges = 0;
+        for( Int i=0; i<numVertices; ++i )
+        {
+            const Int iPart = Part( perm[i], leftSize, rightSize );
+            for( const Int j : StencilNeighbors(i,n) )
+            {
+                const Int jPart = Part( perm[j], leftSize, rightSize );
+                if( iPart != 2 && jPart != 2 && iPart != jPart )
+                    ++numCrossEdges;
+            }
+        }
+        CheckSeparator
+        ( numVertices, leftSize, rightSize, sepSize, numCrossEdges, ctrl,
+          mpi::COMM_SELF );
+        if( sepSize > maxSepSize )
+            LogicError
+            ("The separator had ",sepSize," vertices, but at most ",
+             maxSepSize," were expected");
+        PopIndent();
+    }
+    if( mpi::Size(comm) == 1 )
+        return;
+
+    OutputFromRoot(comm,"Distributed bisection");
+    PushIndent();
+    DistGraph graph( numVertices, grid );
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int numLocalSources = graph.NumLocalSources();
+    graph.Reserve( 7*numLocalSources );
+    for( Int iLocal=0; iLocal<numLocalSources; ++iLocal )
+        for( const Int j : StencilNeighbors(firstLocalSource+iLocal,n) )
+            graph.QueueLocalConnection( iLocal, j );
+    graph.ProcessQueues();
+
+    unique_ptr<Grid> childGrid;
+    DistGraph child;
+    DistMap perm;
+    bool onLeft;
+    Timer timer;
+    timer.Start();
+    const Int sepSize =
+      MultilevelBisect( graph, childGrid, child, perm, onLeft, ctrl );
+    const double bisectTime = timer.Stop();
+    OutputFromRoot(comm,"Bisection took ",bisectTime," seconds");
+    EnsurePermutation( perm );
+
+    // Each process only belongs to the grid of one of the children
+    Int leftSize = ( onLeft ? child.NumSources() : 0 );
+    leftSize = mpi::AllReduce( leftSize, mpi::MAX, comm );
+    const Int rightSize = numVertices - leftSize - sepSize;
+
+    // Translate the sources and targets of the local edges into the new
+    // ordering and count the edges between the two halves
+    const Int numLocalEdges = graph.NumLocalEdges();
+    vector<Int> sources( numLocalEdges ), targets( numLocalEdges );
+    for( Int e=0; e<numLocalEdges; ++e )
+    {
+        sources[e] = graph.Source( e );
+        targets[e] = graph.Target( e );
+    }
+    perm.Translate( sources );
+    perm.Translate( targets );
+    Int numCrossEdges = 0;
+    for( Int e=0; e<numLocalEdges; ++e )
+    {
+        const Int sourcePart = Part( sources[e], leftSize, rightSize );
+        const Int targetPart = Part( targets[e], leftSize, rightSize );
+        if( sourcePart != 2 && targetPart != 2 && sourcePart != targetPart )
+            ++numCrossEdges;
+    }
+    numCrossEdges = mpi::AllReduce( numCrossEdges, comm );
+    CheckSeparator
+    ( numVertices, leftSize, rightSize, sepSize, numCrossEdges, ctrl, comm );
+    if( sepSize > maxSepSize )
+        LogicError
+        ("The separator had ",sepSize," vertices, but at most ",maxSepSize,
+         " were expected");
+    PopIndent();
+}
+
+// The weighted graph of an n x n x n 7-point stencil with varying vertex
+// and (symmetric) edge weights, restricted to the vertices in
+// [firstLocal,firstLocal+numLocal)
+multilevel::WeightedGraph WeightedStencil( Int n, Int firstLocal, Int numLocal )
+{
+    multilevel::WeightedGraph graph;
+    graph.numVertices = n*n*n;
+    graph.firstLocal = firstLocal;
+    graph.numLocal = numLocal;
+    graph.offsets.assign( 1, 0 );
+    for( Int i=firstLocal; i<firstLocal+numLocal; ++i )
+    {
+        graph.vertexWeights.push_back( 1 + i % 3 );
+        for( const Int j : StencilNeighbors(i,n) )
+        {
+            if( j == i )
+                continue;
+            graph.targets.push_back( j );
+            graph.edgeWeights.push_back( 1 + (i+j) % 4 );
+        }
+        graph.offsets.push_back( graph.targets.size() );
+    }
+    return graph;
+}
+
+// Coarsen a weighted stencil over several levels in parallel and ensure that
+// each level preserves the total vertex weight and agrees with the
+// sequential contraction of the (replicated) finer graph along the same map
+void TestDistCoarsen( Int n, Int numLevels, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    OutputFromRoot(comm,"Distributed coarsening");
+    PushIndent();
+
+    const Int numVertices = n*n*n;
+    vector<Int> vtxDist( commSize+1 );
+    for( int q=0; q<=commSize; ++q )
+        vtxDist[q] = (q*numVertices) / commSize;
+    multilevel::WeightedGraph graph =
+      WeightedStencil
+      ( n, vtxDist[commRank], vtxDist[commRank+1]-vtxDist[commRank] );
+    multilevel::WeightedGraph seqGraph = WeightedStencil( n, 0, numVertices );
+
+    for( Int level=0; level<numLevels; ++level )
+    {
+        multilevel::WeightedGraph coarse;
+        vector<Int> coarseVtxDist, coarseMap;
+        multilevel::Coarsen
+        ( graph, vtxDist, coarse, coarseVtxDist, coarseMap, level, comm );
+        OutputFromRoot
+        (comm,"Level ",level,": ",graph.numVertices," -> ",
+         coarse.numVertices," vertices");
+
+        Int weights[2] = { 0, 0 };
+        for( const Int weight : graph.vertexWeights )
+            weights[0] += weight;
+        for( const Int weight : coarse.vertexWeights )
+            weights[1] += weight;
+        mpi::AllReduce( weights, 2, comm );
+        if( weights[0] != weights[1] )
+            LogicError
+            ("The coarse vertex weights summed to ",weights[1],
+             " rather than ",weights[0]);
+
+        // Contract the replicated graph along the gathered coarse map
+        vector<int> counts( commSize ), offs( commSize );
+        for( int q=0; q<commSize; ++q )
+        {
+            counts[q] = vtxDist[q+1] - vtxDist[q];
+            offs[q] = vtxDist[q];
+        }
+        vector<Int> fullMap( graph.numVertices );
+        mpi::AllGather
+        ( coarseMap.data(), int(graph.numLocal),
+          fullMap.data(), counts.data(), offs.data(), comm );
+        multilevel::WeightedGraph seqCoarse;
+        multilevel::Contract
+        ( seqGraph, fullMap, coarse.numVertices, seqCoarse );
+
+        Int numMismatches = 0;
+        for( Int v=0; v<coarse.numLocal; ++v )
+        {
+            const Int c = coarse.firstLocal + v;
+            if( coarse.vertexWeights[v] != seqCoarse.vertexWeights[c] )
+                ++numMismatches;
+            vector<std::pair<Int,Int>> edges, seqEdges;
+            for( Int e=coarse.offsets[v]; e<coarse.offsets[v+1]; ++e )
+                edges.emplace_back( coarse.targets[e], coarse.edgeWeights[e] );
+            for( Int e=seqCoarse.offsets[c]; e<seqCoarse.offsets[c+1]; ++e )
+                seqEdges.emplace_back
+                ( seqCoarse.targets[e], seqCoarse.edgeWeights[e] );
+            std::sort( seqEdges.begin(), seqEdges.end() );
+            if( edges != seqEdges )
+                ++numMismatches;
+        }
+        numMismatches = mpi::AllReduce( numMismatches, comm );
+        if( numMismatches != 0 )
+            LogicError
+            (numMismatches," coarse vertices did not match the sequential "
+             "contraction");
+
+        graph = std::move( coarse );
+        vtxDist = std::move( coarseVtxDist );
+        seqGraph = std::move( seqCoarse );
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of n x n x n grid",30);
+        const Int numSeqSeps = Input
+            ("--numSeqSeps",
+             "number of separators to try per sequential partition",1);
+        const Int coarsestSize =
+          Input("--coarsestSize","number of vertices to coarsen to",128);
+        const Int numRefineSweeps =
+          Input("--numRefineSweeps","number of refinement sweeps",4);
+        const double imbalance =
+          Input("--imbalance","allowed imbalance of the halves",1.1);
+        const Int numCoarsenLevels =
+          Input("--numCoarsenLevels","number of levels to coarsen",3);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.engine = MULTILEVEL_BISECT;
+        ctrl.numSeqSeps = numSeqSeps;
+        ctrl.coarsestSize = coarsestSize;
+        ctrl.numRefineSweeps = numRefineSweeps;
+        ctrl.imbalance = imbalance;
+
+        const Grid grid( comm );
+        TestMultilevelBisect( n, ctrl, grid );
+        if( mpi::Size(comm) > 1 )
+            TestDistCoarsen( n, numCoarsenLevels, comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,304 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <sys/stat.h>
+using namespace El;
+
+bool FileExists( const string& filename )
+{
+    std::ifstream file( filename.c_str() );
+    return file.is_open();
+}
+
+void Corrupt( const string& filename )
+{
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    file << "not an ordering";
+}
+
+// Occupy the name of a cache file with a directory so that it cannot be
+// written (even by a privileged user)
+void Obstruct( const string& filename )
+{
+    std::remove( filename.c_str() );
+    mkdir( filename.c_str(), 0700 );
+}
+
+// Reorder a 3D Laplacian with an ordering cache and ensure that:
+//  - the first reordering stores its ordering,
+//  - a later reordering loads, rather than recomputes, the stored ordering
+//    (which is replaced by one computed with different parameters to
+//    distinguish the two),
+//  - changing the graph or the bisection parameters changes the cache file,
+//  - a corrupted cache file is recomputed and replaced,
+//  - a cache file which cannot be written only leads to a warning, and
+//  - a factorization which uses a cached ordering solves the system.
+void TestSequential
+( Int n1, Int n2, Int n3, const BisectCtrl& ctrl, double tol )
+{
+    Output("Sequential ordering cache");
+    PushIndent();
+    SparseMatrix<double> A;
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+    const Graph& graph = A.LockedGraph();
+    const Int N = graph.NumSources();
+
+    const string name = ldl::OrderingCacheName( graph, ctrl );
+    std::remove( name.c_str() );
+
+    vector<Int> map, mapFresh;
+    ldl::Separator sep;
+    ldl::NodeInfo info;
+    ldl::NestedDissection( graph, mapFresh, sep, info, ctrl );
+    if( !FileExists(name) )
+        LogicError("The ordering was not stored in ",name);
+    {
+        ldl::Separator loadedSep;
+        ldl::NodeInfo loadedInfo;
+        if( !ldl::LoadOrdering( name, loadedSep, loadedInfo ) )
+            LogicError("The stored ordering could not be loaded");
+    }
+    ldl::NestedDissection( graph, map, sep, info, ctrl );
+    if( map != mapFresh )
+        LogicError("The cached ordering differed from the original");
+
+    // Store an ordering computed with a different cutoff under the name of
+    // the original, which a cache hit must then return
+    BisectCtrl otherCtrl( ctrl );
+    otherCtrl.cutoff = 4*ctrl.cutoff;
+    otherCtrl.cacheDir = "";
+    vector<Int> mapOther;
+    ldl::NestedDissection( graph, mapOther, sep, info, otherCtrl );
+    if( mapOther == mapFresh )
+        LogicError("The cutoffs did not lead to different orderings");
+    if( !ldl::SaveOrdering( name, sep, info ) )
+        LogicError("The ordering could not be stored");
+    ldl::NestedDissection( graph, map, sep, info, ctrl );
+    if( map != mapOther )
+        LogicError("The cached ordering was not used");
+    Output("Cache hits returned the stored ordering");
+
+    // Changing the parameters or the graph must change the cache file
+    otherCtrl.cacheDir = ctrl.cacheDir;
+    if( ldl::OrderingCacheName( graph, otherCtrl ) == name )
+        LogicError("Changing the cutoff did not change the cache file");
+    Graph modifiedGraph( graph );
+    modifiedGraph.Connect( 0, N-1 );
+    modifiedGraph.Connect( N-1, 0 );
+    if( ldl::OrderingCacheName( modifiedGraph, ctrl ) == name )
+        LogicError("Changing the graph did not change the cache file");
+    Output("Changes to the graph and parameters invalidated the cache");
+
+    Corrupt( name );
+    ldl::NestedDissection( graph, map, sep, info, ctrl );
+    if( map != mapFresh )
+        LogicError("A corrupted cache file was not recomputed");
+    {
+        ldl::Separator loadedSep;
+        ldl::NodeInfo loadedInfo;
+        if( !ldl::LoadOrdering( name, loadedSep, loadedInfo ) )
+            LogicError("A corrupted cache file was not replaced");
+    }
+    Output("A corrupted cache file was recomputed");
+
+    Obstruct( name );
+    ldl::NestedDissection( graph, map, sep, info, ctrl );
+    if( map != mapFresh )
+        LogicError("The ordering changed when it could not be stored");
+    std::remove( name.c_str() );
+    Output("An unwritable cache file was skipped");
+
+    SparseLDLFactorization<double> sparseLDLFact;
+    sparseLDLFact.Initialize( A, true, ctrl );
+    sparseLDLFact.Factor();
+    Matrix<double> B, X;
+    Uniform( B, N, 1 );
+    X = B;
+    sparseLDLFact.Solve( X );
+    const double BFrob = FrobeniusNorm( B );
+    Multiply( NORMAL, -1., A, X, 1., B );
+    const double relResid = FrobeniusNorm( B ) / BFrob;
+    Output("|| B - A X ||_F / || B ||_F = ",relResid);
+    if( relResid > tol )
+        LogicError("Relative residual was unacceptably large");
+
+    std::remove( name.c_str() );
+    PopIndent();
+}
+
+bool SameMaps( const DistMap& map0, const DistMap& map1 )
+{
+    const bool localSame = ( map0.Map() == map1.Map() );
+    return mpi::AllReduce
+      ( int(localSame), mpi::MIN, map0.Grid().Comm() ) != 0;
+}
+
+// The distributed analogue of TestSequential, with the corruption of the
+// cache file of only one process (which must invalidate all of them) and with
+// only one process failing to write its cache file (which must neither throw
+// nor leave the other processes waiting)
+void TestDistributed
+( Int n1, Int n2, Int n3,
+  const BisectCtrl& ctrl, double tol, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot(comm,"Distributed ordering cache");
+    PushIndent();
+    DistSparseMatrix<double> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+    const DistGraph& graph = A.LockedDistGraph();
+    const Int N = graph.NumSources();
+
+    const string name = ldl::OrderingCacheName( graph, ctrl );
+    std::remove( name.c_str() );
+    mpi::Barrier( comm );
+
+    DistMap map(grid), mapFresh(grid);
+    {
+        ldl::DistSeparator sep;
+        ldl::DistNodeInfo info(grid);
+        ldl::NestedDissection( graph, mapFresh, sep, info, ctrl );
+    }
+    if( !mpi::AllReduce( int(FileExists(name)), mpi::MIN, comm ) )
+        LogicError("The ordering was not stored");
+    {
+        ldl::DistSeparator sep;
+        ldl::DistNodeInfo info(grid);
+        ldl::NestedDissection( graph, map, sep, info, ctrl );
+    }
+    if( !SameMaps( map, mapFresh ) )
+        LogicError("The cached ordering differed from the original");
+
+    BisectCtrl otherCtrl( ctrl );
+    otherCtrl.cutoff = 4*ctrl.cutoff;
+    otherCtrl.cacheDir = "";
+    DistMap mapOther(grid);
+    {
+        ldl::DistSeparator sep;
+        ldl::DistNodeInfo info(grid);
+        ldl::NestedDissection( graph, mapOther, sep, info, otherCtrl );
+        if( !ldl::SaveOrdering( name, sep, info ) )
+            LogicError("The ordering could not be stored");
+    }
+    if( SameMaps( mapOther, mapFresh ) )
+        LogicError("The cutoffs did not lead to different orderings");
+    mpi::Barrier( comm );
+    {
+        ldl::DistSeparator sep;
+        ldl::DistNodeInfo info(grid);
+        ldl::NestedDissection( graph, map, sep, info, ctrl );
+    }
+    if( !SameMaps( map, mapOther ) )
+        LogicError("The cached ordering was not used");
+    OutputFromRoot(comm,"Cache hits returned the stored ordering");
+
+    otherCtrl.cacheDir = ctrl.cacheDir;
+    const bool sameCtrlName =
+      ( ldl::OrderingCacheName(graph,otherCtrl) == name );
+    DistGraph modifiedGraph( graph );
+    if( modifiedGraph.FirstLocalSource() == 0 )
+        modifiedGraph.ConnectLocal( 0, N-1 );
+    const bool sameGraphName =
+      ( ldl::OrderingCacheName(modifiedGraph,ctrl) == name );
+    if( mpi::AllReduce( int(sameCtrlName), mpi::MAX, comm ) )
+        LogicError("Changing the cutoff did not change the cache files");
+    if( mpi::AllReduce( int(sameGraphName), mpi::MAX, comm ) )
+        LogicError("Changing the graph did not change the cache files");
+    OutputFromRoot
+    (comm,"Changes to the graph and parameters invalidated the cache");
+
+    if( grid.Rank() == 0 )
+        Corrupt( name );
+    mpi::Barrier( comm );
+    {
+        ldl::DistSeparator sep;
+        ldl::DistNodeInfo info(grid);
+        ldl::NestedDissection( graph, map, sep, info, ctrl );
+    }
+    if( !SameMaps( map, mapFresh ) )
+        LogicError("A corrupted cache file was not recomputed");
+    {
+        ldl::DistSeparator sep;
+        ldl::DistNodeInfo info(grid);
+        info.SetRootGrid( grid );
+        if( !ldl::LoadOrdering( name, sep, info ) )
+            LogicError("A corrupted cache file was not replaced");
+    }
+    OutputFromRoot(comm,"A corrupted cache file was recomputed");
+
+    if( grid.Rank() == 0 )
+        Obstruct( name );
+    mpi::Barrier( comm );
+    {
+        ldl::DistSeparator sep;
+        ldl::DistNodeInfo info(grid);
+        ldl::NestedDissection( graph, map, sep, info, ctrl );
+    }
+    if( !SameMaps( map, mapFresh ) )
+        LogicError("The ordering changed when it could not be stored");
+    {
+        ldl::DistSeparator sep;
+        ldl::DistNodeInfo info(grid);
+        info.SetRootGrid( grid );
+        if( ldl::LoadOrdering( name, sep, info ) )
+            LogicError("An incompletely stored ordering was loaded");
+    }
+    OutputFromRoot(comm,"An unwritable cache file was skipped");
+
+    DistSparseLDLFactorization<double> sparseLDLFact;
+    sparseLDLFact.Initialize( A, true, ctrl );
+    sparseLDLFact.Factor();
+    DistMultiVec<double> B(grid), X(grid);
+    Uniform( B, N, 1 );
+    X = B;
+    sparseLDLFact.Solve( X );
+    const double BFrob = FrobeniusNorm( B );
+    Multiply( NORMAL, -1., A, X, 1., B );
+    const double relResid = FrobeniusNorm( B ) / BFrob;
+    OutputFromRoot(comm,"|| B - A X ||_F / || B ||_F = ",relResid);
+    if( relResid > tol )
+        LogicError("Relative residual was unacceptably large");
+
+    std::remove( name.c_str() );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",15);
+        const Int n2 = Input("--n2","second grid dimension",15);
+        const Int n3 = Input("--n3","third grid dimension",15);
+        const string scratchDir =
+          Input("--scratchDir","directory of the cached orderings",
+                string("/tmp"));
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",32);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+        ctrl.cacheDir = scratchDir;
+
+        const double tol = Sqrt(limits::Epsilon<double>());
+        const El::Grid grid( comm );
+        if( grid.Rank() == 0 )
+            TestSequential( n1, n2, n3, ctrl, tol );
+        TestDistributed( n1, n2, n3, ctrl, tol, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compute the spectral cloud of a random upper-triangular matrix both with
+// all of the shifts handled at once and with them split into groups which are
+// scheduled over the loop threads, and compare both against the two-norms of
+// the inverses of the shifted matrices (the reciprocals of their smallest
+// singular values)
+template<typename Real>
+void TestPseudospectra
+( Int n, Int numShifts, Int groupSize, bool arnoldi, bool print )
+{
+    typedef Complex<Real> C;
+    Output("Testing with ",TypeName<C>());
+    PushIndent();
+
+    Matrix<C> U;
+    Uniform( U, n, n );
+    MakeTrapezoidal( UPPER, U );
+    // Keep the departure from normality modest so that the resolvent norms
+    // remain well within the working precision
+    ScaleTrapezoid( C(Real(1)/Real(n)), UPPER, U, 1 );
+    ShiftDiagonal( U, C(2) );
+
+    Matrix<C> shifts;
+    Uniform( shifts, numShifts, 1, C(2), Real(1) );
+    if( print )
+    {
+        Print( U, "U" );
+        Print( shifts, "shifts" );
+    }
+
+    PseudospecCtrl<Real> psCtrl;
+    psCtrl.arnoldi = arnoldi;
+    psCtrl.tol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    psCtrl.maxIts = 200;
+
+    Matrix<Real> invNorms, groupInvNorms;
+    Timer timer;
+    psCtrl.shiftGroupSize = 0;
+    timer.Start();
+    TriangularSpectralCloud( U, shifts, invNorms, psCtrl );
+    Output("All shifts at once: ",timer.Stop()," seconds");
+    psCtrl.shiftGroupSize = groupSize;
+    timer.Start();
+    TriangularSpectralCloud( U, shifts, groupInvNorms, psCtrl );
+    Output("Groups of ",groupSize," shifts: ",timer.Stop()," seconds");
+    if( print )
+    {
+        Print( invNorms, "invNorms" );
+        Print( groupInvNorms, "groupInvNorms" );
+    }
+
+    // The estimates converge to roughly sqrt(tol) relative accuracy
+    const Real tol = 10*Sqrt(psCtrl.tol);
+    Real maxGroupDiff=0, maxError=0;
+    Matrix<C> UShift;
+    Matrix<Real> sigma;
+    for( Int j=0; j<numShifts; ++j )
+    {
+        UShift = U;
+        ShiftDiagonal( UShift, -shifts(j) );
+        SVD( UShift, sigma );
+        const Real sigmaMin = sigma(n-1);
+        maxError = Max( maxError, Abs(invNorms(j)*sigmaMin-Real(1)) );
+        maxError = Max( maxError, Abs(groupInvNorms(j)*sigmaMin-Real(1)) );
+        maxGroupDiff =
+          Max( maxGroupDiff, Abs(groupInvNorms(j)-invNorms(j))/invNorms(j) );
+    }
+    Output("max relative error vs. SVD:          ",maxError);
+    Output("max relative grouped vs. ungrouped:  ",maxGroupDiff);
+    if( maxError > tol || maxGroupDiff > tol )
+        LogicError("Pseudospectral error was unacceptably large");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","matrix size",40);
+        const Int numShifts = Input("--numShifts","number of shifts",30);
+        const Int groupSize = Input("--groupSize","shifts per group",4);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            for( const bool arnoldi : { true, false } )
+            {
+                Output("Testing with arnoldi=",arnoldi);
+                TestPseudospectra<float>
+                ( n, numShifts, groupSize, arnoldi, print );
+                TestPseudospectra<double>
+                ( n, numShifts, groupSize, arnoldi, print );
+            }
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,233 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Ensure that the leading singular values are accurate to within 'singValTol',
+// that U has orthonormal columns, and that U diag(s) V^H is nearly as accurate
+// as the best rank-k approximation of A = X diag(sigma) Y^H
+template<typename Field>
+void CheckRandomizedSVD
+(       Matrix<Field> A,
+  const Matrix<Base<Field>>& sigma,
+        Matrix<Field> U,
+  const Matrix<Base<Field>>& s,
+  const Matrix<Field>& V,
+        Base<Field> singValTol )
+{
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int rank = s.Height();
+    const Int minDim = sigma.Height();
+    const Real eps = limits::Epsilon<Real>();
+
+    Real maxRelSingValError = 0;
+    for( Int j=0; j<rank; ++j )
+        maxRelSingValError =
+          Max( maxRelSingValError, Abs(s(j)-sigma(j))/sigma(j) );
+    Output("max_j |s_j - sigma_j| / sigma_j = ",maxRelSingValError);
+
+    Matrix<Field> Z;
+    Identity( Z, rank, rank );
+    Herk( LOWER, ADJOINT, Real(-1), U, Real(1), Z );
+    const Real orthogError = HermitianFrobeniusNorm( LOWER, Z ) / (eps*m);
+    Output("||U' U - I||_F / (eps m) = ",orthogError);
+
+    // The best rank-k approximation has error sqrt(sum_{j>=k} sigma_j^2)
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, Field(-1), U, V, Field(1), A );
+    Real tailNorm = 0;
+    for( Int j=rank; j<minDim; ++j )
+        tailNorm += sigma(j)*sigma(j);
+    tailNorm = Sqrt( tailNorm );
+    const Real relError = FrobeniusNorm( A ) / tailNorm;
+    Output("||A - U S V'||_F / ||A - A_k||_F = ",relError);
+
+    if( maxRelSingValError > singValTol )
+        LogicError("Unacceptably large singular value error");
+    if( orthogError > Real(10) )
+        LogicError("Unacceptably large orthogonality error for U");
+    if( relError > Real(2) )
+        LogicError("Low-rank approximation is far from optimal");
+}
+
+template<typename Field>
+void CheckRandomizedSVD
+(       DistMatrix<Field> A,
+  const DistMatrix<Base<Field>,STAR,STAR>& sigma,
+        DistMatrix<Field> U,
+  const DistMatrix<Base<Field>,STAR,STAR>& s,
+  const DistMatrix<Field>& V,
+        Base<Field> singValTol )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = A.Grid();
+    const Int m = A.Height();
+    const Int rank = s.Height();
+    const Int minDim = sigma.Height();
+    const Real eps = limits::Epsilon<Real>();
+
+    Real maxRelSingValError = 0;
+    for( Int j=0; j<rank; ++j )
+    {
+        const Real sigmaj = sigma.GetLocal(j,0);
+        maxRelSingValError =
+          Max( maxRelSingValError, Abs(s.GetLocal(j,0)-sigmaj)/sigmaj );
+    }
+    OutputFromRoot
+    (grid.Comm(),"max_j |s_j - sigma_j| / sigma_j = ",maxRelSingValError);
+
+    DistMatrix<Field> Z(grid);
+    Identity( Z, rank, rank );
+    Herk( LOWER, ADJOINT, Real(-1), U, Real(1), Z );
+    const Real orthogError = HermitianFrobeniusNorm( LOWER, Z ) / (eps*m);
+    OutputFromRoot(grid.Comm(),"||U' U - I||_F / (eps m) = ",orthogError);
+
+    // The best rank-k approximation has error sqrt(sum_{j>=k} sigma_j^2)
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, Field(-1), U, V, Field(1), A );
+    Real tailNorm = 0;
+    for( Int j=rank; j<minDim; ++j )
+        tailNorm += sigma.GetLocal(j,0)*sigma.GetLocal(j,0);
+    tailNorm = Sqrt( tailNorm );
+    const Real relError = FrobeniusNorm( A ) / tailNorm;
+    OutputFromRoot
+    (grid.Comm(),"||A - U S V'||_F / ||A - A_k||_F = ",relError);
+
+    if( maxRelSingValError > singValTol )
+        LogicError("Unacceptably large singular value error");
+    if( orthogError > Real(10) )
+        LogicError("Unacceptably large orthogonality error for U");
+    if( relError > Real(2) )
+        LogicError("Low-rank approximation is far from optimal");
+}
+
+template<typename Field>
+void TestRandomizedSVD
+( const Grid& grid,
+  Int m,
+  Int n,
+  Int rank,
+  Base<Field> decay,
+  const RandomizedSVDCtrl& ctrl,
+  bool print )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    const Int minDim = Min(m,n);
+    const Real eps = limits::Epsilon<Real>();
+
+    // Form A = X diag(sigma) Y^H with geometrically decaying singular values
+    DistMatrix<Field> X(grid), Y(grid), A(grid);
+    Gaussian( X, m, minDim );
+    Gaussian( Y, n, minDim );
+    qr::ExplicitUnitary( X );
+    qr::ExplicitUnitary( Y );
+    DistMatrix<Real,STAR,STAR> sigma( minDim, 1, grid );
+    for( Int j=0; j<minDim; ++j )
+        sigma.SetLocal( j, 0, Pow(decay,Real(j)) );
+    DiagonalScale( RIGHT, NORMAL, sigma, X );
+    Gemm( NORMAL, ADJOINT, Field(1), X, Y, A );
+    if( print )
+        Print( A, "A" );
+
+    // With q power iterations and p oversamples, the sampled subspace
+    // captures the leading k singular vectors to within a factor of
+    // (sigma_{k+p} / sigma_{k-1})^(2q+1), and the singular values converge
+    // at twice that rate
+    const Real gapRatio = Pow( decay, Real(ctrl.oversample+1) );
+    const Real singValTol =
+      100*minDim*Max( Pow(gapRatio,Real(4*ctrl.numPowerIts+2)), eps );
+
+    DistMatrix<Field,CIRC,CIRC> ACirc( A );
+    if( grid.Rank() == 0 )
+    {
+        Output("Sequential randomized SVD");
+        PushIndent();
+        const Matrix<Field>& ASeq = ACirc.Matrix();
+        Matrix<Field> U, V;
+        Matrix<Real> s;
+        Timer timer;
+        timer.Start();
+        RandomizedSVD( ASeq, rank, U, s, V, ctrl );
+        Output("Time = ",timer.Stop()," seconds");
+        if( print )
+        {
+            Print( U, "U" );
+            Print( s, "s" );
+            Print( V, "V" );
+        }
+        CheckRandomizedSVD( ASeq, sigma.Matrix(), U, s, V, singValTol );
+        PopIndent();
+    }
+
+    OutputFromRoot(grid.Comm(),"Distributed randomized SVD");
+    PushIndent();
+    DistMatrix<Field> U(grid), V(grid);
+    DistMatrix<Real,STAR,STAR> s(grid);
+    mpi::Barrier( grid.Comm() );
+    Timer timer;
+    timer.Start();
+    RandomizedSVD( A, rank, U, s, V, ctrl );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot(grid.Comm(),"Time = ",timer.Stop()," seconds");
+    if( print )
+    {
+        Print( U, "U" );
+        Print( s, "s" );
+        Print( V, "V" );
+    }
+    CheckRandomizedSVD( A, sigma, U, s, V, singValTol );
+    PopIndent();
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",300);
+        const Int n = Input("--width","width of matrix",120);
+        const Int rank = Input("--rank","target rank",10);
+        const Int oversample = Input("--oversample","oversampling",10);
+        const Int numPowerIts = Input("--numPowerIts","power iterations",2);
+        const Int panelWidth = Input("--panelWidth","panel width of A",0);
+        const double decay = Input("--decay","singular value decay",0.8);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        RandomizedSVDCtrl ctrl;
+        ctrl.oversample = oversample;
+        ctrl.numPowerIts = numPowerIts;
+        ctrl.panelWidth = panelWidth;
+
+        TestRandomizedSVD<float>
+        ( grid, m, n, rank, float(decay), ctrl, print );
+        TestRandomizedSVD<Complex<float>>
+        ( grid, m, n, rank, float(decay), ctrl, print );
+        TestRandomizedSVD<double>
+        ( grid, m, n, rank, decay, ctrl, print );
+        TestRandomizedSVD<Complex<double>>
+        ( grid, m, n, rank, decay, ctrl, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
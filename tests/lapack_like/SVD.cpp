@@ -22,9 +22,11 @@ void TestSequentialSVD
   bool useQR,
   bool penalizeDerivative,
   Int divideCutoff,
+  bool useQDWH,
   bool print )
 {
-    Output("Sequential test with ",TypeName<F>());
+    Output
+    ("Sequential ",useQDWH ? "QDWH-SVD " : "","test with ",TypeName<F>());
     typedef Base<F> Real;
     Timer timer;
 
@@ -51,6 +53,7 @@ void TestSequentialSVD
       penalizeDerivative;
     ctrl.bidiagSVDCtrl.dcCtrl.secularCtrl.progress = progress;
     ctrl.time = time;
+    ctrl.useQDWH = useQDWH;
 
     Matrix<Real> s;
     Matrix<F> U, V;
@@ -168,12 +171,15 @@ void TestDistributedSVD
   bool useQR,
   bool penalizeDerivative,
   Int divideCutoff,
+  bool useQDWH,
   bool print )
 {
     typedef Base<F> Real;
     const int commRank = mpi::Rank();
     if( commRank == 0 )
-        Output("Distributed test with ",TypeName<F>());
+        Output
+        ("Distributed ",useQDWH ? "QDWH-SVD " : "","test with ",
+         TypeName<F>());
     Timer timer;
 
     Grid grid( mpi::COMM_WORLD );
@@ -203,6 +209,7 @@ void TestDistributedSVD
 
     ctrl.time = time;
     ctrl.useScaLAPACK = scalapack;
+    ctrl.useQDWH = useQDWH;
     mpi::Barrier( mpi::COMM_WORLD );
     if( commRank == 0 )
         timer.Start();
@@ -346,20 +353,33 @@ void TestSVD
   bool useQR,
   bool penalizeDerivative,
   Int divideCutoff,
+  bool testQDWH,
   bool print )
 {
     const int commRank = mpi::Rank();
+    // QDWH-SVD only computes thin SVDs
+    const bool qdwh = testQDWH && approach == THIN_SVD;
     if( testSeq && commRank == 0 )
     {
         TestSequentialSVD<F>
         ( m, n, rank, approach, tolType, tol, time, progress, wantU, wantV,
-          useQR, penalizeDerivative, divideCutoff, print );
+          useQR, penalizeDerivative, divideCutoff, false, print );
+        if( qdwh )
+            TestSequentialSVD<F>
+            ( m, n, rank, approach, tolType, tol, time, progress, wantU,
+              wantV, useQR, penalizeDerivative, divideCutoff, true, print );
     }
     if( testDist )
     {
         TestDistributedSVD<F> 
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          wantU, wantV, useQR, penalizeDerivative, divideCutoff, print );
+          wantU, wantV, useQR, penalizeDerivative, divideCutoff, false,
+          print );
+        if( qdwh )
+            TestDistributedSVD<F>
+            ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+              wantU, wantV, useQR, penalizeDerivative, divideCutoff, true,
+              print );
     }
 }
 
@@ -398,6 +418,8 @@ main( int argc, char* argv[] )
           Input
           ("--penalizeDerivative","penalize secular derivative in D&C?",false);
         const Int divideCutoff = Input("--divideCutoff","D&C cutoff?",60);
+        const bool testQDWH =
+          Input("--testQDWH","also test QDWH-SVD (for thin SVDs)?",true);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -422,61 +444,61 @@ main( int argc, char* argv[] )
         TestSVD<float>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
         TestSVD<Complex<float>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
 
         TestSVD<double>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
         TestSVD<Complex<double>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
 
 #ifdef EL_HAVE_QD
         TestSVD<DoubleDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
         TestSVD<Complex<DoubleDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
 
         TestSVD<QuadDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
         TestSVD<Complex<QuadDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestSVD<Quad>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
         TestSVD<Complex<Quad>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestSVD<BigFloat>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
         TestSVD<Complex<BigFloat>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, testQDWH, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
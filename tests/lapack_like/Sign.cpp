@@ -0,0 +1,255 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A = Q T Q^H, where Q is Haar-distributed and T is upper triangular with
+// half of its eigenvalues in [1,2] and the other half in [-2,-1], so that the
+// spectrum is well separated from the imaginary axis. The strictly upper
+// triangle of T is scaled by 'nonnormality'; large values lead to many slowly
+// converging Newton iterations during which || X^2 - I ||_F remains large.
+template<typename Field>
+void SeparatedSpectrum
+( Matrix<Field>& A, Int n, Base<Field> nonnormality=Base<Field>(1) )
+{
+    typedef Base<Field> Real;
+    Matrix<Field> T, Q;
+    Uniform( T, n, n );
+    MakeTrapezoidal( UPPER, T );
+    T *= Field(nonnormality)/Sqrt(Real(n));
+    for( Int j=0; j<n; ++j )
+    {
+        const Real lambda = Real(1) + SampleUniform<Real>(0,1);
+        T(j,j) = ( j % 2 == 0 ? lambda : -lambda );
+    }
+    Haar( Q, n );
+    Matrix<Field> QT;
+    Gemm( NORMAL, NORMAL, Field(1), Q, T, QT );
+    Gemm( NORMAL, ADJOINT, Field(1), QT, Q, A );
+}
+
+template<typename Field>
+void CheckSign
+( const Matrix<Field>& A, const Matrix<Field>& S, Base<Field> tol )
+{
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Real AFrob = FrobeniusNorm( A );
+    const Real SFrob = FrobeniusNorm( S );
+
+    Matrix<Field> E;
+    Identity( E, n, n );
+    Gemm( NORMAL, NORMAL, Field(1), S, S, Field(-1), E );
+    const Real involutionErr = FrobeniusNorm( E ) / (SFrob*SFrob);
+
+    Gemm( NORMAL, NORMAL, Field(1), A, S, E );
+    Gemm( NORMAL, NORMAL, Field(-1), S, A, Field(1), E );
+    const Real commuteErr = FrobeniusNorm( E ) / (AFrob*SFrob);
+
+    Output("|| S^2 - I ||_F / || S ||_F^2 = ",involutionErr);
+    Output("|| A S - S A ||_F / (|| A ||_F || S ||_F) = ",commuteErr);
+    if( involutionErr > tol || commuteErr > tol )
+        LogicError("Sign function error was unacceptably large");
+}
+
+template<typename Field>
+void CheckSign
+( const DistMatrix<Field>& A, const DistMatrix<Field>& S, Base<Field> tol )
+{
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Real AFrob = FrobeniusNorm( A );
+    const Real SFrob = FrobeniusNorm( S );
+
+    DistMatrix<Field> E(g);
+    Identity( E, n, n );
+    Gemm( NORMAL, NORMAL, Field(1), S, S, Field(-1), E );
+    const Real involutionErr = FrobeniusNorm( E ) / (SFrob*SFrob);
+
+    Gemm( NORMAL, NORMAL, Field(1), A, S, E );
+    Gemm( NORMAL, NORMAL, Field(-1), S, A, Field(1), E );
+    const Real commuteErr = FrobeniusNorm( E ) / (AFrob*SFrob);
+
+    OutputFromRoot(g.Comm(),"|| S^2 - I ||_F / || S ||_F^2 = ",involutionErr);
+    OutputFromRoot
+    (g.Comm(),"|| A S - S A ||_F / (|| A ||_F || S ||_F) = ",commuteErr);
+    if( involutionErr > tol || commuteErr > tol )
+        LogicError("Sign function error was unacceptably large");
+}
+
+void ReportInfo( const Grid& g, const SignInfo& info )
+{
+    OutputFromRoot
+    (g.Comm(),info.numIts," iterations, ",info.numNewtonSchulzIts,
+     " Newton-Schulz, ",info.numNewtonSchulzRejections," rejected");
+}
+
+// Compute the sign of a matrix whose spectrum is separated from the imaginary
+// axis, both sequentially and distributed, with and without the switch to
+// Newton-Schulz iterations, and ensure that the result is an involution which
+// commutes with the original matrix
+template<typename Field>
+void TestSign( Int n, const SignCtrl<double>& ctrlDbl, const Grid& g )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 100*n*eps;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    SignCtrl<Real> ctrl;
+    ctrl.maxIts = ctrlDbl.maxIts;
+    ctrl.scaling = ctrlDbl.scaling;
+    ctrl.newtonSchulzTol = Real(ctrlDbl.newtonSchulzTol);
+    ctrl.progress = ctrlDbl.progress;
+
+    Matrix<Field> ASeq;
+    if( g.Rank() == 0 )
+        SeparatedSpectrum( ASeq, n );
+    DistMatrix<Field,CIRC,CIRC> ACirc( g );
+    ACirc.Resize( n, n );
+    if( g.Rank() == 0 )
+        ACirc.Matrix() = ASeq;
+    DistMatrix<Field> A( ACirc );
+
+    for( const bool newtonSchulz : { false, true } )
+    {
+        ctrl.newtonSchulz = newtonSchulz;
+        if( g.Rank() == 0 )
+        {
+            Output
+            ("Sequential ",newtonSchulz ? "Newton/Newton-Schulz" : "Newton",
+             " iteration");
+            PushIndent();
+            Matrix<Field> S( ASeq );
+            Timer timer;
+            timer.Start();
+            const SignInfo info = Sign( S, ctrl );
+            Output("Sign: ",timer.Stop()," seconds");
+            ReportInfo( g, info );
+            CheckSign( ASeq, S, tol );
+            PopIndent();
+        }
+
+        OutputFromRoot
+        (g.Comm(),"Distributed ",
+         newtonSchulz ? "Newton/Newton-Schulz" : "Newton"," iteration");
+        PushIndent();
+        DistMatrix<Field> S( A );
+        Timer timer;
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        const SignInfo info = Sign( S, ctrl );
+        mpi::Barrier( g.Comm() );
+        const double runTime = timer.Stop();
+        OutputFromRoot(g.Comm(),"Sign: ",runTime," seconds");
+        ReportInfo( g, info );
+        CheckSign( A, S, tol );
+        PopIndent();
+    }
+
+    PopIndent();
+}
+
+// Compute the sign of a strongly non-normal matrix, for which the relative
+// difference of the Newton iterates drops below the Newton-Schulz switch
+// tolerance long before || X^2 - I ||_F does, and ensure that the
+// Newton-Schulz trial is rejected exactly once rather than on every
+// subsequent iteration
+template<typename Field>
+void TestNewtonSchulzFallback
+( Int n, Base<Field> nonnormality, const SignCtrl<double>& ctrlDbl,
+  const Grid& g )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    SignCtrl<Real> ctrl;
+    ctrl.maxIts = ctrlDbl.maxIts;
+    ctrl.scaling = ctrlDbl.scaling;
+    ctrl.newtonSchulzTol = Real(ctrlDbl.newtonSchulzTol);
+    ctrl.progress = ctrlDbl.progress;
+
+    Matrix<Field> ASeq;
+    if( g.Rank() == 0 )
+        SeparatedSpectrum( ASeq, n, nonnormality );
+    DistMatrix<Field,CIRC,CIRC> ACirc( g );
+    ACirc.Resize( n, n );
+    if( g.Rank() == 0 )
+        ACirc.Matrix() = ASeq;
+    DistMatrix<Field> A( ACirc );
+
+    auto checkInfo = [&]( const SignInfo& info )
+      {
+          ReportInfo( g, info );
+          if( info.numNewtonSchulzRejections != 1 )
+              LogicError
+              ("Expected exactly one rejected Newton-Schulz step but saw ",
+               info.numNewtonSchulzRejections);
+      };
+    if( g.Rank() == 0 )
+    {
+        Output("Sequential");
+        PushIndent();
+        Matrix<Field> S( ASeq );
+        checkInfo( Sign( S, ctrl ) );
+        PopIndent();
+    }
+    OutputFromRoot(g.Comm(),"Distributed");
+    PushIndent();
+    DistMatrix<Field> S( A );
+    checkInfo( Sign( S, ctrl ) );
+    PopIndent();
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--size","size of matrix",100);
+        const double nonnormality =
+          Input("--nonnormality","scale of the slowly converging input",10.);
+        const Int maxIts = Input("--maxIts","max number of iter's",100);
+        const Int scaleInt = Input("--scaling","scaling strategy",2);
+        const double newtonSchulzTol =
+          Input("--newtonSchulzTol","Newton-Schulz switch tolerance",0.5);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SignCtrl<double> ctrl;
+        ctrl.maxIts = maxIts;
+        ctrl.scaling = static_cast<SignScaling>(scaleInt);
+        ctrl.newtonSchulzTol = newtonSchulzTol;
+        ctrl.progress = progress;
+
+        const Grid g( comm );
+        TestSign<float>( n, ctrl, g );
+        TestSign<double>( n, ctrl, g );
+        TestSign<Complex<double>>( n, ctrl, g );
+
+        OutputFromRoot(comm,"Slowly converging input");
+        PushIndent();
+        TestNewtonSchulzFallback<float>( n, nonnormality, ctrl, g );
+        TestNewtonSchulzFallback<double>( n, nonnormality, ctrl, g );
+        TestNewtonSchulzFallback<Complex<double>>( n, nonnormality, ctrl, g );
+        PopIndent();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The number of leaves which a Cholesky factorization expanded into dense
+// fronts
+template<typename Field>
+Int NumDenseLeaves( const ldl::Front<Field>& front )
+{
+    Int numDenseLeaves =
+      ( front.children.empty() && !front.sparseLeaf ? 1 : 0 );
+    for( const auto& child : front.children )
+        numDenseLeaves += NumDenseLeaves( *child );
+    return numDenseLeaves;
+}
+
+template<typename Field>
+Int NumDenseLeaves( const ldl::DistFront<Field>& front )
+{
+    if( front.child.get() != nullptr )
+        return NumDenseLeaves( *front.child );
+    else
+        return NumDenseLeaves( *front.duplicate );
+}
+
+template<typename Field>
+void CheckResidual
+( const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Field>& X,
+  Base<Field> tol )
+{
+    Matrix<Field> R( B );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+    const Base<Field> relResid = FrobeniusNorm( R ) / FrobeniusNorm( B );
+    Output("|| B - A X ||_F / || B ||_F = ",relResid);
+    if( relResid > tol )
+        LogicError("Relative residual was unacceptably large");
+}
+
+template<typename Field>
+void CheckResidual
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+  const DistMultiVec<Field>& X,
+  Base<Field> tol )
+{
+    DistMultiVec<Field> R( B );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+    const Base<Field> relResid = FrobeniusNorm( R ) / FrobeniusNorm( B );
+    OutputFromRoot
+    (A.Grid().Comm(),"|| B - A X ||_F / || B ||_F = ",relResid);
+    if( relResid > tol )
+        LogicError("Relative residual was unacceptably large");
+}
+
+// Solve HPD systems with the (negated) 3D Laplacian using supernodal Cholesky
+// fronts, both sequentially and distributed: factor, solve, change the values
+// of the matrix, refactor, and solve again, and then solve through HPDSolve.
+// The cutoff should be small enough that some of the leaves are densified.
+template<typename Field>
+void TestSparseCholesky
+( Int n1, Int n2, Int n3, Int numRHS, const BisectCtrl& ctrl,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    const int commRank = grid.Rank();
+    const Int N = n1*n2*n3;
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    if( commRank == 0 )
+    {
+        Output("Sequential factorization");
+        PushIndent();
+        SparseMatrix<Field> A;
+        Laplacian( A, n1, n2, n3 );
+        A *= -1;
+
+        SparseLDLFactorization<Field> sparseLDLFact;
+        sparseLDLFact.Initialize( A, true, ctrl );
+        Matrix<Field> B, X;
+        Uniform( B, N, numRHS );
+        for( Int repeat=0; repeat<2; ++repeat )
+        {
+            if( repeat != 0 )
+            {
+                ShiftDiagonal( A, Field(1) );
+                sparseLDLFact.ChangeNonzeroValues( A );
+            }
+            sparseLDLFact.Factor( CHOLESKY_2D );
+            Output
+            (NumDenseLeaves(sparseLDLFact.Front())," leaves were densified");
+            X = B;
+            sparseLDLFact.Solve( X );
+            CheckResidual( A, B, X, tol );
+        }
+
+        Output("HPDSolve");
+        X = B;
+        HPDSolve( A, X, ctrl );
+        CheckResidual( A, B, X, tol );
+        PopIndent();
+    }
+
+    OutputFromRoot(grid.Comm(),"Distributed factorization");
+    PushIndent();
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, true, ctrl );
+    DistMultiVec<Field> B(grid), X(grid);
+    Uniform( B, N, numRHS );
+    for( Int repeat=0; repeat<2; ++repeat )
+    {
+        if( repeat != 0 )
+        {
+            ShiftDiagonal( A, Field(1) );
+            sparseLDLFact.ChangeNonzeroValues( A );
+        }
+        sparseLDLFact.Factor( CHOLESKY_2D );
+        const Int numDenseLeaves = mpi::AllReduce
+          ( NumDenseLeaves(sparseLDLFact.Front()), grid.Comm() );
+        OutputFromRoot(grid.Comm(),numDenseLeaves," leaves were densified");
+        X = B;
+        sparseLDLFact.Solve( X );
+        CheckResidual( A, B, X, tol );
+    }
+
+    OutputFromRoot(grid.Comm(),"HPDSolve");
+    X = B;
+    HPDSolve( A, X, ctrl );
+    CheckResidual( A, B, X, tol );
+    PopIndent();
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",16);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+
+        const El::Grid grid( comm );
+        TestSparseCholesky<float>( n1, n2, n3, numRHS, ctrl, grid );
+        TestSparseCholesky<double>( n1, n2, n3, numRHS, ctrl, grid );
+        TestSparseCholesky<Complex<double>>( n1, n2, n3, numRHS, ctrl, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
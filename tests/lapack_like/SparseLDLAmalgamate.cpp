@@ -0,0 +1,196 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+Int NumFronts( const ldl::NodeInfo& info )
+{
+    Int numFronts = 1;
+    for( const auto& child : info.children )
+        numFronts += NumFronts( *child );
+    return numFronts;
+}
+
+// The number of fronts in the sequential subtree of this process
+Int NumFronts( const ldl::DistNodeInfo& info )
+{
+    if( info.child.get() != nullptr )
+        return NumFronts( *info.child );
+    else
+        return NumFronts( *info.duplicate );
+}
+
+template<typename Field>
+void CheckSolution
+( const Matrix<Field>& B,
+  const Matrix<Field>& X,
+  const Matrix<Field>& XRef,
+  const SparseMatrix<Field>& A,
+  Base<Field> residTol,
+  Base<Field> diffTol )
+{
+    Matrix<Field> R( B );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+    const Base<Field> relResid = FrobeniusNorm( R ) / FrobeniusNorm( B );
+    Matrix<Field> E( X );
+    E -= XRef;
+    const Base<Field> relDiff = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    Output("|| B - A X ||_F / || B ||_F = ",relResid);
+    Output("|| X - X_ref ||_F / || X_ref ||_F = ",relDiff);
+    if( relResid > residTol || relDiff > diffTol )
+        LogicError("Amalgamated solution error was unacceptably large");
+}
+
+template<typename Field>
+void CheckSolution
+( const DistMultiVec<Field>& B,
+  const DistMultiVec<Field>& X,
+  const DistMultiVec<Field>& XRef,
+  const DistSparseMatrix<Field>& A,
+  Base<Field> residTol,
+  Base<Field> diffTol )
+{
+    mpi::Comm comm = A.Grid().Comm();
+    DistMultiVec<Field> R( B );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+    const Base<Field> relResid = FrobeniusNorm( R ) / FrobeniusNorm( B );
+    DistMultiVec<Field> E( X );
+    E -= XRef;
+    const Base<Field> relDiff = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    OutputFromRoot(comm,"|| B - A X ||_F / || B ||_F = ",relResid);
+    OutputFromRoot(comm,"|| X - X_ref ||_F / || X_ref ||_F = ",relDiff);
+    if( relResid > residTol || relDiff > diffTol )
+        LogicError("Amalgamated solution error was unacceptably large");
+}
+
+// Factor and solve a 3D Laplacian with and without relaxed supernode
+// amalgamation (sequentially and distributed) with LDL and Cholesky fronts
+// and ensure that amalgamation reduced the number of fronts while the
+// solutions still agree and solve the system
+template<typename Field>
+void TestAmalgamation
+( Int n1, Int n2, Int n3, Int numRHS,
+  const BisectCtrl& ctrl,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    mpi::Comm comm = grid.Comm();
+    const int commRank = grid.Rank();
+    const Int N = n1*n2*n3;
+    const Real eps = limits::Epsilon<Real>();
+    const Real residTol = Sqrt(eps);
+    const Real diffTol = N*eps;
+    OutputFromRoot(comm,"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    BisectCtrl amalgCtrl( ctrl );
+    amalgCtrl.amalgamate = true;
+    for( const auto frontType : { LDL_2D, CHOLESKY_2D } )
+    {
+        if( commRank == 0 )
+        {
+            Output
+            ("Sequential ",frontType==LDL_2D ? "LDL" : "Cholesky",
+             " factorization");
+            PushIndent();
+            SparseMatrix<Field> A;
+            Laplacian( A, n1, n2, n3 );
+            A *= -1;
+
+            SparseLDLFactorization<Field> fact, amalgFact;
+            fact.Initialize( A, true, ctrl );
+            fact.Factor( frontType );
+            amalgFact.Initialize( A, true, amalgCtrl );
+            amalgFact.Factor( frontType );
+            const Int numFronts = NumFronts( fact.NodeInfo() );
+            const Int numAmalgFronts = NumFronts( amalgFact.NodeInfo() );
+            Output
+            ("Amalgamation reduced ",numFronts," fronts to ",numAmalgFronts);
+            if( numAmalgFronts >= numFronts )
+                LogicError("Amalgamation did not merge any fronts");
+
+            Matrix<Field> B, XRef, X;
+            Uniform( B, N, numRHS );
+            XRef = B;
+            fact.Solve( XRef );
+            X = B;
+            amalgFact.Solve( X );
+            CheckSolution( B, X, XRef, A, residTol, diffTol );
+            PopIndent();
+        }
+
+        OutputFromRoot
+        (comm,"Distributed ",frontType==LDL_2D ? "LDL" : "Cholesky",
+         " factorization");
+        PushIndent();
+        DistSparseMatrix<Field> A(grid);
+        Laplacian( A, n1, n2, n3 );
+        A *= -1;
+
+        DistSparseLDLFactorization<Field> fact, amalgFact;
+        fact.Initialize( A, true, ctrl );
+        fact.Factor( frontType );
+        amalgFact.Initialize( A, true, amalgCtrl );
+        amalgFact.Factor( frontType );
+        const Int numFronts =
+          mpi::AllReduce( NumFronts(fact.NodeInfo()), comm );
+        const Int numAmalgFronts =
+          mpi::AllReduce( NumFronts(amalgFact.NodeInfo()), comm );
+        OutputFromRoot
+        (comm,"Amalgamation reduced ",numFronts," sequential fronts to ",
+         numAmalgFronts);
+        if( numAmalgFronts >= numFronts )
+            LogicError("Amalgamation did not merge any fronts");
+
+        DistMultiVec<Field> B(grid), XRef(grid), X(grid);
+        Uniform( B, N, numRHS );
+        XRef = B;
+        fact.Solve( XRef );
+        X = B;
+        amalgFact.Solve( X );
+        CheckSolution( B, X, XRef, A, residTol, diffTol );
+        PopIndent();
+    }
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",16);
+        const Int amalgamationSize =
+          Input("--amalgamationSize","max size of a merged front",16);
+        const double amalgamationTol =
+          Input("--amalgamationTol","max fraction of explicit zeros",0.1);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+        ctrl.amalgamationSize = amalgamationSize;
+        ctrl.amalgamationTol = amalgamationTol;
+
+        const El::Grid grid( comm );
+        TestAmalgamation<float>( n1, n2, n3, numRHS, ctrl, grid );
+        TestAmalgamation<double>( n1, n2, n3, numRHS, ctrl, grid );
+        TestAmalgamation<Complex<double>>( n1, n2, n3, numRHS, ctrl, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+Int NumCompressedFronts( const ldl::Front<Field>& front )
+{
+    Int numCompressed = ( front.LBLR.Height() > 0 ? 1 : 0 );
+    for( const auto& child : front.children )
+        numCompressed += NumCompressedFronts( *child );
+    return numCompressed;
+}
+
+template<typename Field>
+Int NumCompressedFronts( const ldl::DistFront<Field>& front )
+{
+    if( front.child.get() != nullptr )
+        return NumCompressedFronts( *front.child );
+    else
+        return NumCompressedFronts( *front.duplicate );
+}
+
+// Factor a 3D Laplacian with block low-rank fronts, then repeatedly change
+// the values (but not the sparsity pattern) of the matrix and refactor. The
+// fronts compressed by each factorization must be restored to their dense
+// dimensions before the new values are written into them.
+template<typename Field>
+void TestBLR
+( Int n1, Int n2, Int n3, Int numRepeats,
+  const ldl::BLRCtrl<Base<Field>>& blrCtrl,
+  const BisectCtrl& ctrl,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    const int commRank = grid.Rank();
+    const Int N = n1*n2*n3;
+    const Real residTol = Sqrt(limits::Epsilon<Real>());
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    if( commRank == 0 )
+    {
+        Output("Sequential factorization");
+        PushIndent();
+        SparseMatrix<Field> A;
+        Laplacian( A, n1, n2, n3 );
+        A *= -1;
+
+        SparseLDLFactorization<Field> sparseLDLFact;
+        sparseLDLFact.SetBLRCtrl( blrCtrl );
+        sparseLDLFact.Initialize( A, true, ctrl );
+        for( Int repeat=0; repeat<numRepeats; ++repeat )
+        {
+            if( repeat != 0 )
+            {
+                ShiftDiagonal( A, Field(1) );
+                sparseLDLFact.ChangeNonzeroValues( A );
+            }
+            sparseLDLFact.Factor( LDL_BLR_2D );
+            const Int numCompressed =
+              NumCompressedFronts( sparseLDLFact.Front() );
+            if( numCompressed == 0 )
+                LogicError("None of the fronts were compressed");
+
+            Matrix<Field> B, X;
+            Uniform( B, N, 1 );
+            X = B;
+            sparseLDLFact.Solve( X );
+            const Real BFrob = FrobeniusNorm( B );
+            Multiply( NORMAL, Field(-1), A, X, Field(1), B );
+            const Real relResid = FrobeniusNorm( B ) / BFrob;
+            Output
+            (numCompressed," compressed fronts, || B - A X ||_F / || B ||_F = ",
+             relResid);
+            if( relResid > residTol )
+                LogicError("Relative residual was unacceptably large");
+        }
+        PopIndent();
+    }
+
+    OutputFromRoot(grid.Comm(),"Distributed factorization");
+    PushIndent();
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.SetBLRCtrl( blrCtrl );
+    sparseLDLFact.Initialize( A, true, ctrl );
+    for( Int repeat=0; repeat<numRepeats; ++repeat )
+    {
+        if( repeat != 0 )
+        {
+            // The second call reuses the pull metadata to only communicate
+            // the nonzero values
+            ShiftDiagonal( A, Field(1) );
+            sparseLDLFact.ChangeNonzeroValues( A );
+        }
+        sparseLDLFact.Factor( LDL_BLR_2D );
+        const Int numCompressed = mpi::AllReduce
+          ( NumCompressedFronts( sparseLDLFact.Front() ), grid.Comm() );
+        if( numCompressed == 0 )
+            LogicError("None of the fronts were compressed");
+
+        DistMultiVec<Field> B(grid), X(grid);
+        Uniform( B, N, 1 );
+        X = B;
+        sparseLDLFact.Solve( X );
+        const Real BFrob = FrobeniusNorm( B );
+        Multiply( NORMAL, Field(-1), A, X, Field(1), B );
+        const Real relResid = FrobeniusNorm( B ) / BFrob;
+        OutputFromRoot
+        (grid.Comm(),numCompressed,
+         " compressed fronts, || B - A X ||_F / || B ||_F = ",relResid);
+        if( relResid > residTol )
+            LogicError("Relative residual was unacceptably large");
+    }
+    PopIndent();
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int numRepeats =
+          Input("--numRepeats","number of repeated factorizations",3);
+        const Int minSize =
+          Input("--minSize","minimum height of compressed fronts",64);
+        const Int tileSize = Input("--tileSize","BLR tile size",32);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",64);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+
+        // The compression tolerance is chosen small enough that the
+        // factorization remains a direct solver for these well-conditioned
+        // matrices
+        ldl::BLRCtrl<double> blrCtrl;
+        blrCtrl.minSize = minSize;
+        blrCtrl.tileSize = tileSize;
+        blrCtrl.tol = Pow(limits::Epsilon<double>(),0.75);
+
+        const El::Grid grid( comm );
+        TestBLR<double>( n1, n2, n3, numRepeats, blrCtrl, ctrl, grid );
+        TestBLR<Complex<double>>
+        ( n1, n2, n3, numRepeats, blrCtrl, ctrl, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
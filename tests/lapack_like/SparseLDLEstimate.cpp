@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void CheckPrediction
+( const string& quantity, double estimate, double actual, double tol,
+  bool print )
+{
+    const double relError = Abs(estimate-actual) / Max(actual,1.);
+    if( print )
+        Output(quantity,": estimated ",estimate,", actual ",actual);
+    if( relError > tol )
+        LogicError
+        ("The estimated ",quantity," had a relative error of ",relError,
+         ", which is unacceptably large");
+}
+
+void CheckBounds( const ldl::FactorEstimate& estimate, Int fieldSize )
+{
+    if( estimate.localPeakBytes < fieldSize*estimate.localFactorEntries )
+        LogicError("The peak memory was less than that of the factors");
+    if( estimate.maxPeakBytes < estimate.localPeakBytes )
+        LogicError("The maximum peak memory was less than the local peak");
+    if( estimate.peakImbalance < 1 || estimate.factorImbalance < 1 )
+        LogicError("The imbalances were less than one");
+}
+
+// Predict the cost of factoring a 3D Laplacian with each front type before
+// any fronts are formed and then ensure that the predicted numbers of
+// entries and flops agree with those of the factorization (which mirror
+// them), both sequentially and distributed
+template<typename Field>
+void TestEstimate
+( Int n1, Int n2, Int n3, const BisectCtrl& ctrl, const Grid& grid )
+{
+    const int commRank = grid.Rank();
+    mpi::Comm comm = grid.Comm();
+    const double tol = 1e-10;
+    OutputFromRoot(comm,"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    if( commRank == 0 )
+    {
+        SparseMatrix<Field> A;
+        Laplacian( A, n1, n2, n3 );
+        A *= -1;
+        for( const auto frontType : { LDL_2D, CHOLESKY_2D } )
+        {
+            Output("Sequential ",frontType==LDL_2D ? "LDL" : "Cholesky");
+            PushIndent();
+            SparseLDLFactorization<Field> sparseLDLFact;
+            sparseLDLFact.Initialize( A, true, ctrl );
+            const auto estimate = sparseLDLFact.Estimate( frontType );
+            CheckBounds( estimate, sizeof(Field) );
+            sparseLDLFact.Factor( frontType );
+            CheckPrediction
+            ( "entries", estimate.factorEntries,
+              sparseLDLFact.NumEntries(), tol, true );
+            CheckPrediction
+            ( "factor GFlops", estimate.factorGFlops,
+              sparseLDLFact.FactorGFlops(), tol, true );
+            CheckPrediction
+            ( "solve GFlops", estimate.solveGFlops,
+              sparseLDLFact.SolveGFlops(), tol, true );
+            PopIndent();
+        }
+    }
+
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+    for( const auto frontType : { LDL_2D, LDL_SELINV_2D, CHOLESKY_2D } )
+    {
+        OutputFromRoot
+        (comm,"Distributed ",
+         frontType==LDL_2D ? "LDL" :
+         frontType==LDL_SELINV_2D ? "selectively-inverted LDL" : "Cholesky");
+        PushIndent();
+        DistSparseLDLFactorization<Field> sparseLDLFact;
+        sparseLDLFact.Initialize( A, true, ctrl );
+        const auto estimate = sparseLDLFact.Estimate( frontType );
+        CheckBounds( estimate, sizeof(Field) );
+        sparseLDLFact.Factor( frontType );
+
+        const bool selInv = SelInvFactorization( frontType );
+        const double numEntries =
+          mpi::AllReduce( double(sparseLDLFact.NumLocalEntries()), comm );
+        const double factorGFlops =
+          mpi::AllReduce( sparseLDLFact.LocalFactorGFlops(selInv), comm );
+        const double solveGFlops =
+          mpi::AllReduce( sparseLDLFact.LocalSolveGFlops(), comm );
+        // The local shares of the distributed fronts are predicted as even
+        // splits, which only hold approximately when the grid dimensions
+        // do not divide the front sizes
+        CheckPrediction
+        ( "local entries", estimate.localFactorEntries,
+          sparseLDLFact.NumLocalEntries(), 0.01, false );
+        CheckPrediction
+        ( "entries", estimate.factorEntries, numEntries, tol,
+          commRank == 0 );
+        CheckPrediction
+        ( "factor GFlops", estimate.factorGFlops, factorGFlops, tol,
+          commRank == 0 );
+        CheckPrediction
+        ( "solve GFlops", estimate.solveGFlops, solveGFlops, tol,
+          commRank == 0 );
+        PopIndent();
+    }
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",64);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+
+        const El::Grid grid( comm );
+        TestEstimate<double>( n1, n2, n3, ctrl, grid );
+        TestEstimate<Complex<double>>( n1, n2, n3, ctrl, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
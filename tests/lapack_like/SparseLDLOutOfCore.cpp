@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void CheckStats( const ldl::OutOfCoreStats& stats, bool print )
+{
+    if( print )
+        Output
+        ("Spilled ",stats.numFrontsSpilled," fronts (",stats.bytesSpilled,
+         " bytes) and read back ",stats.numFrontsRead," (",stats.bytesRead,
+         " bytes)");
+    if( stats.numFrontsSpilled == 0 || stats.numFrontsRead == 0 )
+        LogicError("The out-of-core factorization did not spill any fronts");
+}
+
+// Factor a 3D Laplacian (sequentially and distributed) in memory and with an
+// out-of-core memory budget small enough to spill (nearly) every sequential
+// front, and ensure that the solutions agree and solve the system
+template<typename Field>
+void TestOutOfCore
+( Int n1, Int n2, Int n3, Int numRHS,
+  const ldl::OutOfCoreCtrl& outOfCoreCtrl,
+  const BisectCtrl& ctrl,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    const int commRank = grid.Rank();
+    const Int N = n1*n2*n3;
+    const Real eps = limits::Epsilon<Real>();
+    const Real residTol = Sqrt(eps);
+    const Real diffTol = N*eps;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    if( commRank == 0 )
+    {
+        Output("Sequential factorization");
+        PushIndent();
+        SparseMatrix<Field> A;
+        Laplacian( A, n1, n2, n3 );
+        A *= -1;
+
+        SparseLDLFactorization<Field> inCoreFact, outOfCoreFact;
+        inCoreFact.Initialize( A, true, ctrl );
+        inCoreFact.Factor();
+        outOfCoreFact.SetOutOfCoreCtrl( outOfCoreCtrl );
+        outOfCoreFact.Initialize( A, true, ctrl );
+        outOfCoreFact.Factor();
+
+        Matrix<Field> B, XInCore, X;
+        Uniform( B, N, numRHS );
+        XInCore = B;
+        inCoreFact.Solve( XInCore );
+        X = B;
+        outOfCoreFact.Solve( X );
+        CheckStats( outOfCoreFact.OutOfCoreStats(), true );
+
+        const Real BFrob = FrobeniusNorm( B );
+        Multiply( NORMAL, Field(-1), A, X, Field(1), B );
+        const Real relResid = FrobeniusNorm( B ) / BFrob;
+        X -= XInCore;
+        const Real relDiff = FrobeniusNorm( X ) / FrobeniusNorm( XInCore );
+        Output("|| B - A X ||_F / || B ||_F = ",relResid);
+        Output("|| X - X_inCore ||_F / || X_inCore ||_F = ",relDiff);
+        if( relResid > residTol || relDiff > diffTol )
+            LogicError("Out-of-core error was unacceptably large");
+        PopIndent();
+    }
+
+    OutputFromRoot(grid.Comm(),"Distributed factorization");
+    PushIndent();
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+
+    DistSparseLDLFactorization<Field> inCoreFact, outOfCoreFact;
+    inCoreFact.Initialize( A, true, ctrl );
+    inCoreFact.Factor();
+    outOfCoreFact.SetOutOfCoreCtrl( outOfCoreCtrl );
+    outOfCoreFact.Initialize( A, true, ctrl );
+    outOfCoreFact.Factor();
+
+    DistMultiVec<Field> B(grid), XInCore(grid), X(grid);
+    Uniform( B, N, numRHS );
+    XInCore = B;
+    inCoreFact.Solve( XInCore );
+    X = B;
+    outOfCoreFact.Solve( X );
+    CheckStats( outOfCoreFact.OutOfCoreStats(), commRank == 0 );
+
+    const Real BFrob = FrobeniusNorm( B );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), B );
+    const Real relResid = FrobeniusNorm( B ) / BFrob;
+    X -= XInCore;
+    const Real relDiff = FrobeniusNorm( X ) / FrobeniusNorm( XInCore );
+    OutputFromRoot(grid.Comm(),"|| B - A X ||_F / || B ||_F = ",relResid);
+    OutputFromRoot
+    (grid.Comm(),"|| X - X_inCore ||_F / || X_inCore ||_F = ",relDiff);
+    if( relResid > residTol || relDiff > diffTol )
+        LogicError("Out-of-core error was unacceptably large");
+    PopIndent();
+
+    PopIndent();
+}
+
+// A scratch directory which cannot be written to must result in an exception
+// (on the calling thread) rather than a crash or silently corrupt factors
+template<typename Field>
+void TestBadScratchDir
+( Int n1, Int n2, Int n3,
+  const ldl::OutOfCoreCtrl& outOfCoreCtrl,
+  const BisectCtrl& ctrl )
+{
+    Output("Testing an unusable scratch directory with ",TypeName<Field>());
+    SparseMatrix<Field> A;
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+
+    ldl::OutOfCoreCtrl badCtrl( outOfCoreCtrl );
+    badCtrl.scratchDir = outOfCoreCtrl.scratchDir + "/El-missing-directory";
+    SparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.SetOutOfCoreCtrl( badCtrl );
+    sparseLDLFact.Initialize( A, true, ctrl );
+    bool threw = false;
+    try { sparseLDLFact.Factor(); }
+    catch( std::exception& e )
+    {
+        Output("Caught: ",e.what());
+        threw = true;
+    }
+    if( !threw )
+        LogicError("Factoring with an unusable scratch directory succeeded");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const string scratchDir =
+          Input("--scratchDir","scratch directory",string("/tmp"));
+        const Int memoryBudget =
+          Input("--memoryBudget","bytes of resident dense factors",1024);
+        const Int readAhead =
+          Input("--readAhead","number of fronts to read ahead",2);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",64);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+
+        ldl::OutOfCoreCtrl outOfCoreCtrl;
+        outOfCoreCtrl.enabled = true;
+        outOfCoreCtrl.scratchDir = scratchDir;
+        outOfCoreCtrl.memoryBudget = memoryBudget;
+        outOfCoreCtrl.readAhead = readAhead;
+
+        const El::Grid grid( comm );
+        TestOutOfCore<float>( n1, n2, n3, numRHS, outOfCoreCtrl, ctrl, grid );
+        TestOutOfCore<double>( n1, n2, n3, numRHS, outOfCoreCtrl, ctrl, grid );
+        TestOutOfCore<Complex<double>>
+        ( n1, n2, n3, numRHS, outOfCoreCtrl, ctrl, grid );
+
+        if( mpi::Rank(comm) == 0 )
+            TestBadScratchDir<double>( n1, n2, n3, outOfCoreCtrl, ctrl );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -75,12 +75,26 @@ void TestSparseDirect
     const Int rootSepSize = sparseLDLFact.NodeInfo().size;
     OutputFromRoot(grid.Comm(),rootSepSize," vertices in root separator\n");
 
+    typedef Base<Field> Real;
+    const Real tol = Sqrt(limits::Epsilon<Real>());
     for( Int repeat=0; repeat<numRepeats; ++repeat )
     {
         if( repeat != 0 )
         {
+            // Overwrite the fronts with garbage to ensure that the new values
+            // replace, rather than update, the previous ones
             sparseLDLFact.ChangeFrontType( SYMM_2D );
             MakeFrontsUniform( sparseLDLFact.Front() );
+
+            // Change the values, but not the sparsity pattern, of A
+            ShiftDiagonal( A, Field(1) );
+            OutputFromRoot(grid.Comm(),"Changing the nonzero values...");
+            mpi::Barrier( grid.Comm() );
+            timer.Start();
+            sparseLDLFact.ChangeNonzeroValues( A );
+            mpi::Barrier( grid.Comm() );
+            timer.Stop();
+            OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
         }
 
         OutputFromRoot(grid.Comm(),"Running LDL^T and redistribution...");
@@ -95,15 +109,22 @@ void TestSparseDirect
         OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
 
         OutputFromRoot(grid.Comm(),"Solving against random right-hand side...");
-        DistMultiVec<Field> y( N, 1, grid );
-        MakeUniform( y );
+        DistMultiVec<Field> b( N, 1, grid ), x( grid );
+        MakeUniform( b );
+        x = b;
         timer.Start();
-        sparseLDLFact.Solve( y );
+        sparseLDLFact.Solve( x );
         mpi::Barrier( grid.Comm() );
         timer.Stop();
         OutputFromRoot(grid.Comm(),"Time = ",timer.Partial()," seconds");
 
-        // TODO(poulson): Check residual error
+        const Real bNorm = FrobeniusNorm( b );
+        Multiply( NORMAL, Field(-1), A, x, Field(1), b );
+        const Real relResid = FrobeniusNorm( b ) / bNorm;
+        OutputFromRoot
+        (grid.Comm(),"|| b - A x ||_2 / || b ||_2 = ",relResid);
+        if( relResid > tol )
+            LogicError("Relative residual was unacceptably large");
     }
 }
 
@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void CompareSolutions
+( const Matrix<Field>& XSerial,
+  const Matrix<Field>& XThreaded,
+  Base<Field> tol )
+{
+    Matrix<Field> E( XThreaded );
+    E -= XSerial;
+    const Base<Field> relDiff = FrobeniusNorm(E) / FrobeniusNorm(XSerial);
+    Output("|| X_threaded - X_serial ||_F / || X_serial ||_F = ",relDiff);
+    if( relDiff > tol )
+        LogicError
+        ("Threaded and serial solutions differed by an unacceptably large "
+         "amount");
+}
+
+template<typename Field>
+void SolveWithLoopThreads
+( const SparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Field>& X,
+  Int numLoopThreads )
+{
+    ThreadingCtrl threadingCtrl;
+    threadingCtrl.numLoopThreads = numLoopThreads;
+    PushThreadingCtrl( threadingCtrl );
+    Timer timer;
+    timer.Start();
+    sparseLDLFact.Solve( X );
+    Output(NumLoopThreads()," loop threads: ",timer.Stop()," seconds");
+    PopThreadingCtrl();
+}
+
+template<typename Field>
+void SolveWithLoopThreads
+( const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& X,
+  Int numLoopThreads )
+{
+    ThreadingCtrl threadingCtrl;
+    threadingCtrl.numLoopThreads = numLoopThreads;
+    PushThreadingCtrl( threadingCtrl );
+    Timer timer;
+    timer.Start();
+    sparseLDLFact.Solve( X );
+    const double solveTime = timer.Stop();
+    OutputFromRoot
+    (X.Grid().Comm(),NumLoopThreads()," loop threads: ",solveTime," seconds");
+    PopThreadingCtrl();
+}
+
+// Solve against the (sequential or distributed) factorization of a 3D
+// Laplacian with a single loop thread, which solves the sequential portion of
+// the elimination tree one front at a time, and with 'numThreads' loop threads,
+// which solve independent subtrees concurrently, and ensure that the results
+// agree and solve the system
+template<typename Field>
+void TestSparseLDLThreads
+( Int n1, Int n2, Int n3, Int numRHS, Int numThreads,
+  const BisectCtrl& ctrl, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    const int commRank = grid.Rank();
+    const Int N = n1*n2*n3;
+    const Real eps = limits::Epsilon<Real>();
+    const Real residTol = Sqrt(eps);
+    const Real diffTol = N*eps;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    if( commRank == 0 )
+    {
+        Output("Sequential factorization");
+        PushIndent();
+        SparseMatrix<Field> A;
+        Laplacian( A, n1, n2, n3 );
+        A *= -1;
+
+        SparseLDLFactorization<Field> sparseLDLFact;
+        sparseLDLFact.Initialize( A, true, ctrl );
+        sparseLDLFact.Factor();
+
+        Matrix<Field> B, XSerial, XThreaded;
+        Uniform( B, N, numRHS );
+        XSerial = B;
+        SolveWithLoopThreads( sparseLDLFact, XSerial, 1 );
+        XThreaded = B;
+        SolveWithLoopThreads( sparseLDLFact, XThreaded, numThreads );
+        CompareSolutions( XSerial, XThreaded, diffTol );
+
+        const Real BFrob = FrobeniusNorm( B );
+        Multiply( NORMAL, Field(-1), A, XThreaded, Field(1), B );
+        const Real relResid = FrobeniusNorm( B ) / BFrob;
+        Output("|| B - A X ||_F / || B ||_F = ",relResid);
+        if( relResid > residTol )
+            LogicError("Relative residual was unacceptably large");
+        PopIndent();
+    }
+
+    OutputFromRoot(grid.Comm(),"Distributed factorization");
+    PushIndent();
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, true, ctrl );
+    sparseLDLFact.Factor();
+
+    DistMultiVec<Field> B(grid), XSerial(grid), XThreaded(grid);
+    Uniform( B, N, numRHS );
+    XSerial = B;
+    SolveWithLoopThreads( sparseLDLFact, XSerial, 1 );
+    XThreaded = B;
+    SolveWithLoopThreads( sparseLDLFact, XThreaded, numThreads );
+    // Each process compares its own rows of the solutions
+    Matrix<Field> E( XThreaded.Matrix() );
+    E -= XSerial.Matrix();
+    const Real relDiff = FrobeniusNorm(E) / FrobeniusNorm(XSerial.Matrix());
+    if( relDiff > diffTol )
+        RuntimeError
+        ("Threaded and serial solutions on process ",commRank," differed by ",
+         relDiff,", which is unacceptably large");
+
+    const Real BFrob = FrobeniusNorm( B );
+    Multiply( NORMAL, Field(-1), A, XThreaded, Field(1), B );
+    const Real relResid = FrobeniusNorm( B ) / BFrob;
+    OutputFromRoot(grid.Comm(),"|| B - A X ||_F / || B ||_F = ",relResid);
+    if( relResid > residTol )
+        LogicError("Relative residual was unacceptably large");
+    PopIndent();
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int numThreads =
+          Input("--numThreads","number of loop threads (0 for all)",0);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",64);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+
+        const El::Grid grid( comm );
+        TestSparseLDLThreads<float>
+        ( n1, n2, n3, numRHS, numThreads, ctrl, grid );
+        TestSparseLDLThreads<double>
+        ( n1, n2, n3, numRHS, numThreads, ctrl, grid );
+        TestSparseLDLThreads<Complex<double>>
+        ( n1, n2, n3, numRHS, numThreads, ctrl, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
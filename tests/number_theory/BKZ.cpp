@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Real>
+void CheckUnimodularTransform
+( const Matrix<Real>& BOrig,
+  const Matrix<Real>& B,
+  const Matrix<Real>& U )
+{
+    Matrix<Real> E( B );
+    Gemm( NORMAL, NORMAL, Real(-1), BOrig, U, Real(1), E );
+    const Real errorNorm = FrobeniusNorm( E );
+    const Real UDet = Determinant( U );
+    Output("|| BOrig U - B ||_F = ",errorNorm,", det(U)=",UDet);
+    if( errorNorm > Real(0) || Abs(Abs(UDet)-Real(1)) > Real(1)/Real(2) )
+        LogicError("BKZ did not apply a unimodular transformation");
+}
+
+Int CountLines( const std::string& filename )
+{
+    std::ifstream file( filename.c_str() );
+    Int numLines = 0;
+    std::string line;
+    while( std::getline( file, line ) )
+        ++numLines;
+    return numLines;
+}
+
+// Reduce a random integer lattice with the sequential BKZ tours and with the
+// tours which enumerate several windows concurrently. The two schedules need
+// not produce the same basis, but both must produce a basis of the same
+// lattice which a subsequent sequential BKZ pass cannot improve.
+template<typename Real>
+void TestBKZ
+( Int n, Int blocksize, Int numConcurrentWindows, bool progress, bool print )
+{
+    Output("Testing with ",TypeName<Real>());
+    PushIndent();
+
+    Matrix<Real> BOrig;
+    Uniform( BOrig, n, n, Real(0), Real(1000) );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            BOrig(i,j) = Round( BOrig(i,j) );
+    if( print )
+        Print( BOrig, "BOrig" );
+
+    BKZCtrl<Real> ctrl;
+    ctrl.blocksize = blocksize;
+    ctrl.subBKZ = false;
+    ctrl.progress = progress;
+
+    Timer timer;
+    Matrix<Real> BSeq( BOrig ), USeq, RSeq;
+    timer.Start();
+    auto seqInfo = BKZ( BSeq, USeq, RSeq, ctrl );
+    Output
+    ("Sequential tours: ",timer.Stop()," seconds, ",seqInfo.numEnums,
+     " enums, ",seqInfo.numEnumFailures," nontrivial, || b_0 ||_2 = ",
+     FrobeniusNorm(BSeq(ALL,IR(0))));
+    CheckUnimodularTransform( BOrig, BSeq, USeq );
+
+    const std::string failedEnumFile = "BKZParallelFailedEnums.txt";
+    ctrl.numConcurrentWindows = numConcurrentWindows;
+    ctrl.logFailedEnums = true;
+    ctrl.failedEnumFile = failedEnumFile;
+    Matrix<Real> BPar( BOrig ), UPar, RPar;
+    timer.Start();
+    auto parInfo = BKZ( BPar, UPar, RPar, ctrl );
+    Output
+    ("Parallel tours: ",timer.Stop()," seconds, ",parInfo.numEnums,
+     " enums, ",parInfo.numEnumFailures," nontrivial, || b_0 ||_2 = ",
+     FrobeniusNorm(BPar(ALL,IR(0))));
+    CheckUnimodularTransform( BOrig, BPar, UPar );
+    if( print )
+    {
+        Print( BSeq, "BSeq" );
+        Print( BPar, "BPar" );
+    }
+
+    const Int numLogged = CountLines( failedEnumFile );
+    std::remove( failedEnumFile.c_str() );
+    if( numLogged != parInfo.numEnumFailures )
+        LogicError
+        ("Parallel tours logged ",numLogged," nontrivial enumerations but "
+         "reported ",parInfo.numEnumFailures);
+
+    const Real logVolDiff = Abs(seqInfo.logVol-parInfo.logVol);
+    Output("| logVol_seq - logVol_par | = ",logVolDiff);
+    if( logVolDiff > Sqrt(limits::Epsilon<Real>())*Abs(seqInfo.logVol) )
+        LogicError("Lattice volumes differed by an unacceptably large amount");
+
+    // A sequential tour over the result of the parallel tours should not find
+    // any improvements
+    ctrl.numConcurrentWindows = 1;
+    ctrl.logFailedEnums = false;
+    Matrix<Real> BCheck( BPar ), UCheck, RCheck;
+    auto checkInfo = BKZ( BCheck, UCheck, RCheck, ctrl );
+    Output
+    ("Sequential tour over parallel result: ",checkInfo.numEnumFailures,
+     " nontrivial enumerations");
+    if( checkInfo.numEnumFailures != 0 )
+        LogicError("The parallel tours did not return a BKZ-reduced basis");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","lattice dimension",30);
+        const Int blocksize = Input("--blocksize","BKZ blocksize",10);
+        const Int numConcurrentWindows =
+          Input("--numConcurrentWindows","concurrent windows per stage",4);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+            TestBKZ<double>
+            ( n, blocksize, numConcurrentWindows, progress, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
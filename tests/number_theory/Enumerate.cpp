@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Real>
+Real LatticeMemberNorm( const Matrix<Real>& B, const Matrix<Real>& v )
+{
+    Matrix<Real> b;
+    Zeros( b, B.Height(), 1 );
+    Gemv( NORMAL, Real(1), B, v, Real(0), b );
+    return FrobeniusNorm( b );
+}
+
+// Find the shortest vector of an LLL-reduced random integer lattice with the
+// sequential enumeration and with the subtree-parallel enumeration for several
+// splitting depths, and ensure that the (unique up to sign) shortest norms
+// agree
+template<typename Real>
+void TestEnumerate( Int n, Int maxDepth, bool print )
+{
+    Output("Testing with ",TypeName<Real>());
+    PushIndent();
+
+    Matrix<Real> B;
+    Uniform( B, n, n, Real(0), Real(20) );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            B(i,j) = Round( B(i,j) );
+    Matrix<Real> R;
+    LLL( B, R );
+    if( print )
+        Print( B, "B" );
+
+    const Real tol = n*Pow(limits::Epsilon<Real>(),Real(0.5));
+    EnumCtrl<Real> ctrl;
+    ctrl.enumType = FULL_ENUM;
+    ctrl.disablePrecDrop = true;
+
+    Timer timer;
+    Matrix<Real> v;
+    timer.Start();
+    const Real serialNorm = ShortestVectorEnumeration( B, R, v, ctrl );
+    Output("Sequential: || B v ||_2 = ",serialNorm," in ",timer.Stop()," sec");
+    if( print )
+        Print( v, "v" );
+    if( Abs(LatticeMemberNorm(B,v)-serialNorm) > tol*serialNorm )
+        LogicError("Sequential enumeration returned an inconsistent norm");
+    if( serialNorm > FrobeniusNorm(B(ALL,IR(0))) )
+        LogicError("Sequential enumeration did not find a short vector");
+
+    for( Int depth=1; depth<=maxDepth; ++depth )
+    {
+        ctrl.parallelDepth = depth;
+        timer.Start();
+        const Real parallelNorm = ShortestVectorEnumeration( B, R, v, ctrl );
+        Output
+        ("Depth ",depth,": || B v ||_2 = ",parallelNorm," in ",timer.Stop(),
+         " sec");
+        if( print )
+            Print( v, "v" );
+        if( Abs(LatticeMemberNorm(B,v)-parallelNorm) > tol*parallelNorm )
+            LogicError("Parallel enumeration returned an inconsistent norm");
+        if( Abs(parallelNorm-serialNorm) > tol*serialNorm )
+            LogicError
+            ("Parallel and sequential shortest norms differed by ",
+             Abs(parallelNorm-serialNorm),", which is unacceptably large");
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","lattice dimension",20);
+        const Int maxDepth = Input("--maxDepth","max splitting depth",3);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+            TestEnumerate<double>( n, maxDepth, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,267 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form the sparse direct-form quadratic program
+//
+//   min 1/2 x^T Q x + c^T x, s.t. A x = b, x >= 0,
+//
+// where Q is a diagonally-dominant tridiagonal matrix and A a banded matrix.
+// The entries of Q and A are scaled by 'scale' so that their values can be
+// changed without changing their sparsity patterns, and all of the data is
+// deterministic so that the sequential and distributed problems agree.
+template<typename Real>
+Real QEntry( Int i, Int j, Real scale )
+{ return i == j ? 4*scale : -scale; }
+
+template<typename Real>
+Real AEntry( Int i, Int k, Real scale )
+{ return scale*(1 + Real((3*i+k) % 7)/Real(7)); }
+
+template<typename Real>
+Real XEntry( Int j )
+{ return 1 + Real(j % 5)/Real(5); }
+
+template<typename Real>
+Real CEntry( Int j )
+{ return Sin( Real(j) ); }
+
+const Int bandwidth = 3;
+
+// Row i of A has entries in columns [ratio*i,ratio*i+bandwidth)
+inline Int AColumn( Int i, Int k, Int m, Int n )
+{ return Min( (n/m)*i+k, n-1 ); }
+
+template<typename Real>
+void FormQP
+( Int m, Int n, Real scale,
+  SparseMatrix<Real>& Q,
+  SparseMatrix<Real>& A,
+  Matrix<Real>& b,
+  Matrix<Real>& c )
+{
+    Zeros( Q, n, n );
+    Q.Reserve( 3*n );
+    for( Int i=0; i<n; ++i )
+        for( Int j=Max(i-1,Int(0)); j<=Min(i+1,n-1); ++j )
+            Q.QueueUpdate( i, j, QEntry(i,j,scale) );
+    Q.ProcessQueues();
+
+    Zeros( A, m, n );
+    A.Reserve( bandwidth*m );
+    for( Int i=0; i<m; ++i )
+        for( Int k=0; k<bandwidth; ++k )
+            A.QueueUpdate( i, AColumn(i,k,m,n), AEntry(i,k,scale) );
+    A.ProcessQueues();
+
+    // Ensure that the problem is feasible by choosing b = A x0 for a positive
+    // x0 (Q is positive-definite, so the problem is also bounded)
+    Matrix<Real> x0;
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        x0(j) = XEntry<Real>(j);
+        c(j) = CEntry<Real>(j);
+    }
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+}
+
+template<typename Real>
+void FormQP
+( Int m, Int n, Real scale,
+  DistSparseMatrix<Real>& Q,
+  DistSparseMatrix<Real>& A,
+  DistMultiVec<Real>& b,
+  DistMultiVec<Real>& c )
+{
+    Zeros( Q, n, n );
+    Q.Reserve( 3*Q.LocalHeight() );
+    for( Int iLoc=0; iLoc<Q.LocalHeight(); ++iLoc )
+    {
+        const Int i = Q.GlobalRow(iLoc);
+        for( Int j=Max(i-1,Int(0)); j<=Min(i+1,n-1); ++j )
+            Q.QueueLocalUpdate( iLoc, j, QEntry(i,j,scale) );
+    }
+    Q.ProcessLocalQueues();
+
+    Zeros( A, m, n );
+    A.Reserve( bandwidth*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int k=0; k<bandwidth; ++k )
+            A.QueueLocalUpdate( iLoc, AColumn(i,k,m,n), AEntry(i,k,scale) );
+    }
+    A.ProcessLocalQueues();
+
+    DistMultiVec<Real> x0(A.Grid());
+    Zeros( x0, n, 1 );
+    Zeros( c, n, 1 );
+    for( Int jLoc=0; jLoc<x0.LocalHeight(); ++jLoc )
+    {
+        const Int j = x0.GlobalRow(jLoc);
+        x0.SetLocal( jLoc, 0, XEntry<Real>(j) );
+        c.SetLocal( jLoc, 0, CEntry<Real>(j) );
+    }
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+}
+
+template<typename Real>
+Real MinEntry( const Matrix<Real>& x )
+{
+    Real minEntry = limits::Max<Real>();
+    for( Int i=0; i<x.Height(); ++i )
+        minEntry = Min( minEntry, x(i) );
+    return minEntry;
+}
+
+template<typename Real>
+Real MinEntry( const DistMultiVec<Real>& x )
+{
+    Real localMin = limits::Max<Real>();
+    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+        localMin = Min( localMin, x.GetLocal(iLoc,0) );
+    return mpi::AllReduce( localMin, mpi::MIN, x.Grid().Comm() );
+}
+
+template<typename SparseMatrixType,typename VectorType,typename Real>
+void CheckSolution
+( const SparseMatrixType& Q,
+  const SparseMatrixType& A,
+  const VectorType& b,
+  const VectorType& c,
+  const VectorType& x,
+  const VectorType& y,
+  const VectorType& z,
+  Real tol,
+  bool output )
+{
+    // r_b = A x - b
+    VectorType rb( b );
+    Multiply( NORMAL, Real(1), A, x, Real(-1), rb );
+    const Real rbRel = FrobeniusNorm(rb) / (1+FrobeniusNorm(b));
+
+    // r_c = Q x + A^T y - z + c
+    VectorType rc( c );
+    Multiply( NORMAL, Real(1), Q, x, Real(1), rc );
+    Multiply( TRANSPOSE, Real(1), A, y, Real(1), rc );
+    rc -= z;
+    const Real rcRel = FrobeniusNorm(rc) / (1+FrobeniusNorm(c));
+
+    const Real xMin = MinEntry(x);
+    const Real zMin = MinEntry(z);
+    const Real gap = Dot(x,z) / (1+FrobeniusNorm(x)*FrobeniusNorm(z));
+    if( output )
+    {
+        Output("|| A x - b ||_2 / (1 + || b ||_2) = ",rbRel);
+        Output("|| Q x + A^T y - z + c ||_2 / (1 + || c ||_2) = ",rcRel);
+        Output("x^T z / (1 + || x ||_2 || z ||_2) = ",gap);
+        Output("min(x) = ",xMin,", min(z) = ",zMin);
+    }
+    if( rbRel > tol || rcRel > tol || gap > tol )
+        LogicError("QP residuals were unacceptably large");
+    if( xMin < Real(0) || zMin < Real(0) )
+        LogicError("QP solution left the positive orthant");
+}
+
+// Solve a sparse QP with the full KKT system, then change the values (but not
+// the sparsity patterns) of Q and A and solve again, both sequentially and
+// distributed. Each solve must assemble its own KKT system rather than reuse
+// the values of Q and A from a previous one.
+template<typename Real>
+void TestQP
+( Int m, Int n, const Grid& grid, bool progress, bool print )
+{
+    const int commRank = grid.Rank();
+    if( commRank == 0 )
+        Output("Testing with ",TypeName<Real>());
+    PushIndent();
+
+    qp::direct::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.system = FULL_KKT;
+    ctrl.mehrotraCtrl.print = progress;
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.25));
+
+    DistSparseMatrix<Real> Q(grid), A(grid);
+    DistMultiVec<Real> b(grid), c(grid), x(grid), y(grid), z(grid);
+    SparseMatrix<Real> QSeq, ASeq;
+    Matrix<Real> bSeq, cSeq, xSeq, ySeq, zSeq, xDist;
+    Timer timer;
+    for( const Real scale : { Real(1), Real(3) } )
+    {
+        if( commRank == 0 )
+            Output("scale=",scale);
+        PushIndent();
+
+        FormQP( m, n, scale, Q, A, b, c );
+        if( print )
+        {
+            Print( Q, "Q" );
+            Print( A, "A" );
+        }
+        if( commRank == 0 )
+            timer.Start();
+        QP( Q, A, b, c, x, y, z, ctrl );
+        if( commRank == 0 )
+            Output("Distributed solve: ",timer.Stop()," seconds");
+        CheckSolution( Q, A, b, c, x, y, z, tol, commRank == 0 );
+
+        if( commRank == 0 )
+        {
+            CopyFromRoot( x, xDist );
+
+            FormQP( m, n, scale, QSeq, ASeq, bSeq, cSeq );
+            timer.Start();
+            QP( QSeq, ASeq, bSeq, cSeq, xSeq, ySeq, zSeq, ctrl );
+            Output("Sequential solve: ",timer.Stop()," seconds");
+            CheckSolution
+            ( QSeq, ASeq, bSeq, cSeq, xSeq, ySeq, zSeq, tol, true );
+
+            xSeq -= xDist;
+            const Real xDiff = FrobeniusNorm(xSeq) / (1+FrobeniusNorm(xDist));
+            Output("|| x_seq - x_dist ||_2 / (1 + || x_dist ||_2) = ",xDiff);
+            if( xDiff > tol )
+                LogicError
+                ("Sequential and distributed solutions differed by an "
+                 "unacceptably large amount");
+        }
+        else
+            CopyFromNonRoot( x, 0 );
+
+        PopIndent();
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","number of equality constraints",50);
+        const Int n = Input("--n","number of variables",200);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( mpi::COMM_WORLD );
+        TestQP<double>( m, n, grid, progress, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}